@@ -31,6 +31,12 @@
 
 #include "stmlib/stmlib.h"
 
+#ifdef TEST
+// Render the wavetable engine from float, band-limited mip levels rather than
+// from the integrated int16 waves.
+#define WAVETABLE_MIPMAPS
+#endif
+
 namespace plaits
 {
 
@@ -66,21 +66,14 @@ namespace plaits
 		float const margin = (1.0f / slope - 1.0f) / (1.0f + bumps);
 		float const center = centroid * (n + margin) - 0.5f * margin;
 
-		float sum = 0.001f;
-
+		float gain[kNumHarmonics];
 		for (size_t i = 0; i < num_harmonics; ++i) {
-			float order = fabsf(static_cast<float>(i) - center) * slope;
-			float gain = 1.0f - order;
-			gain += fabsf(gain);
-			gain *= gain;
-
-			float b = 0.25f + order * bumps;
-			float bump_factor = 1.0f + InterpolateWrap(lut_sine, b, 1024.0f);
+			gain[i] = AdditiveGain(static_cast<float>(i), center, slope, bumps);
+		}
 
-			gain *= bump_factor;
-			gain *= gain;
-			gain *= gain;
+		float sum = 0.001f;
 
+		for (size_t i = 0; i < num_harmonics; ++i) {
 			int j = harmonic_indices[i];
 
 			// Warning about the following line: this is not a proper LP filter because
@@ -91,7 +84,7 @@ namespace plaits
 			// normalized spectrum, and both of them cause more annoyances than this
 			// "incorrect" solution.
 
-			ONE_POLE(amplitudes[j], gain, 0.001f);
+			ONE_POLE(amplitudes[j], gain[i], 0.001f);
 			sum += amplitudes[j];
 		}
 
@@ -29,6 +29,8 @@
 #ifndef PLAITS_DSP_ENGINE_ADDITIVE_ENGINE_H_
 #define PLAITS_DSP_ENGINE_ADDITIVE_ENGINE_H_
 
+#include "stmlib/dsp/dsp.h"
+
 #include "plaits/dsp/engine/engine.h"
 #include "plaits/dsp/oscillator/harmonic_oscillator.h"
 
@@ -39,6 +41,24 @@ namespace plaits
 	int const kNumHarmonics = 36;
 	int const kNumHarmonicOscillators = kNumHarmonics / kHarmonicBatchSize;
 
+	// Spectral envelope shared by the additive engines: gain of the partial of
+	// rank i, before smoothing and normalization. There is no table lookup, so
+	// that loops over many partials can be vectorized.
+	inline float AdditiveGain(float i, float center, float slope, float bumps) {
+		float order = fabsf(i - center) * slope;
+		float gain = 1.0f - order;
+		gain += fabsf(gain);
+		gain *= gain;
+
+		float b = 0.25f + order * bumps;
+		float bump_factor = 1.0f + stmlib::SinePolynomial(b);
+
+		gain *= bump_factor;
+		gain *= gain;
+		gain *= gain;
+		return gain;
+	}
+
 	class AdditiveEngine : public Engine
 	{
 	public:
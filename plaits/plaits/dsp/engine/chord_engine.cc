@@ -93,6 +93,8 @@ namespace plaits
 		timbre_lp_ = 0.0f;
 
 		ratios_ = allocator->Allocate<float>(kChordNumChords * kChordNumNotes);
+
+		set_bank(NULL);
 	}
 
 	void ChordEngine::Reset() {
@@ -103,6 +105,13 @@ namespace plaits
 		}
 	}
 
+	void ChordEngine::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		for (int i = 0; i < kChordNumWaves; ++i) {
+			pointers->Add(&wavetable_[i]);
+		}
+		pointers->Add(&ratios_);
+	}
+
 	float const fade_point[kChordNumVoices] = {
 		0.55f, 0.47f, 0.49f, 0.51f, 0.53f
 	};
@@ -185,9 +194,9 @@ namespace plaits
 		return mask;
 	}
 
-#define WAVE(bank, row, column) &wav_integrated_waves[(bank * 64 + row * 8 + column) * 260]
+#define WAVE(bank, row, column) (bank * 64 + row * 8 + column)
 
-	int16_t const* wavetable[] = {
+	int const wavetable_index[kChordNumWaves] = {
 		WAVE(2, 6, 1),
 		WAVE(2, 6, 6),
 		WAVE(2, 6, 4),
@@ -205,6 +214,16 @@ namespace plaits
 		WAVE(2, 4, 0),
 	};
 
+#undef WAVE
+
+	void ChordEngine::set_bank(WavetableBank const* bank) {
+		for (int i = 0; i < kChordNumWaves; ++i) {
+			wavetable_[i] = bank
+			    ? bank->wave(wavetable_index[i])
+			    : &wav_integrated_waves[wavetable_index[i] * 260];
+		}
+	}
+
 	void ChordEngine::Render(
 	    EngineParameters const& parameters,
 	    float* out,
@@ -257,7 +276,7 @@ namespace plaits
 				    note_f0 * 1.004f,
 				    note_amplitudes[note] * wavetable_amount,
 				    waveform,
-				    wavetable,
+				    wavetable_,
 				    destination,
 				    size
 				);
@@ -33,6 +33,7 @@
 
 #include "plaits/dsp/engine/engine.h"
 #include "plaits/dsp/oscillator/string_synth_oscillator.h"
+#include "plaits/dsp/oscillator/wavetable_bank.h"
 #include "plaits/dsp/oscillator/wavetable_oscillator.h"
 
 namespace plaits
@@ -41,6 +42,7 @@ namespace plaits
 	int const kChordNumNotes = 4;
 	int const kChordNumVoices = 5;
 	int const kChordNumHarmonics = 3;
+	int const kChordNumWaves = 15;
 
 	// #define JON_CHORDS
 
@@ -61,6 +63,12 @@ namespace plaits
 		virtual void Init(stmlib::BufferAllocator* allocator);
 		virtual void Reset();
 		virtual void Render(EngineParameters const& parameters, float* out, float* aux, size_t size, bool* already_enveloped);
+		virtual void ListPointers(stmlib::SnapshotPointers* pointers) const;
+
+		// Reads the waves from a bank loaded at runtime rather than from the
+		// built-in waves. Must be called after Init(), NULL restores the
+		// built-in waves. The bank is not owned and must outlive the engine.
+		void set_bank(WavetableBank const* bank);
 
 	private:
 		void ComputeRegistration(float registration, float* amplitudes);
@@ -72,7 +80,8 @@ namespace plaits
 		);
 
 		StringSynthOscillator divide_down_voice_[kChordNumVoices];
-		WavetableOscillator<256, 15> wavetable_voice_[kChordNumVoices];
+		WavetableOscillator<256, kChordNumWaves> wavetable_voice_[kChordNumVoices];
+		int16_t const* wavetable_[kChordNumWaves];
 		stmlib::HysteresisQuantizer chord_index_quantizer_;
 
 		float morph_lp_;
@@ -0,0 +1,320 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Swarm of sawtooths and sines with up to 512 voices.
+
+#include "plaits/dsp/engine/dense_swarm_engine.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "stmlib/dsp/dsp.h"
+#include "stmlib/dsp/polyblep.h"
+#include "stmlib/dsp/rsqrt.h"
+#include "stmlib/dsp/units.h"
+
+#include "plaits/dsp/oscillator/oscillator.h"
+#include "plaits/dsp/oscillator/sine_oscillator.h"
+
+namespace plaits
+{
+
+	using namespace std;
+	using namespace stmlib;
+
+	void DenseSwarmEngine::Init(BufferAllocator* allocator) {
+		max_num_blocks_ = min(
+		    static_cast<int>(allocator->free(kVectorAlignment) / sizeof(Block)),
+		    kDenseSwarmMaxNumVoices / kDenseSwarmStride
+		);
+		block_ = allocator->Allocate<Block>(max_num_blocks_, kVectorAlignment);
+		if (!block_) {
+			max_num_blocks_ = 0;
+		}
+		num_blocks_ = 0;
+		set_num_voices(kDenseSwarmMaxNumVoices);
+		Reset();
+	}
+
+	void DenseSwarmEngine::Reset() {
+		for (int i = 0; i < max_num_blocks_; ++i) {
+			Block* b = &block_[i];
+			for (int j = 0; j < kDenseSwarmStride; ++j) {
+				uint32_t const index = i * kDenseSwarmStride + j;
+				b->from[j] = 0.0f;
+				b->interval[j] = 1.0f;
+				b->phase[j] = 1.0f;
+				b->fm[j] = 0.0f;
+				b->amplitude[j] = 0.5f;
+				b->previous_size_ratio[j] = 0.0f;
+				b->filter_coefficient[j] = 0.0f;
+				b->rng_state[j] = (index + 1) * 2654435761u;
+
+				b->saw_phase[j] = 0.0f;
+				b->saw_next_sample[j] = 0.0f;
+				b->saw_frequency[j] = 0.01f;
+				b->saw_frequency_increment[j] = 0.0f;
+				b->saw_gain[j] = 0.0f;
+				b->saw_gain_increment[j] = 0.0f;
+
+				b->sine_x[j] = 1.0f;
+				b->sine_y[j] = 0.0f;
+				b->sine_epsilon[j] = 0.0f;
+				b->sine_epsilon_increment[j] = 0.0f;
+				b->sine_amplitude[j] = 0.0f;
+				b->sine_amplitude_increment[j] = 0.0f;
+			}
+		}
+	}
+
+	void DenseSwarmEngine::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		pointers->Add(&block_);
+	}
+
+	void DenseSwarmEngine::set_num_voices(int num_voices) {
+		int num_blocks = (num_voices + kDenseSwarmStride - 1) / kDenseSwarmStride;
+		num_blocks = min(max(num_blocks, 1), max_num_blocks_);
+		if (num_blocks == num_blocks_) {
+			return;
+		}
+		num_blocks_ = num_blocks;
+
+		// Same ranks and size ratios as SwarmEngine for 8 voices, spread over the
+		// same range for more voices. The level of each voice is scaled down
+		// by the square root of the number of voices, since their phases are
+		// not correlated.
+		int const total = num_blocks_ * kDenseSwarmStride;
+		float const n_voices = static_cast<float>(total);
+		float const n = static_cast<float>((total - 1) / 2);
+		float const decay = 8.0f / n_voices;
+		for (int i = 0; i < num_blocks_; ++i) {
+			for (int j = 0; j < kDenseSwarmStride; ++j) {
+				float const index = static_cast<float>(i * kDenseSwarmStride + j);
+				block_[i].rank[j] = (index - n) / n;
+				block_[i].size_ratio_scale[j] = powf(0.97f, index * decay);
+			}
+		}
+		amplitude_scale_ = 1.0f / sqrtf(8.0f * n_voices);
+	}
+
+	// The loops below are written without branches or selects between computed
+	// values: since these could raise floating point exceptions, GCC would
+	// otherwise move their computation behind a branch, which prevents
+	// vectorization. Conditions are turned into 0.0f / 1.0f factors instead,
+	// and a * c + b * (1.0f - c) gives exactly a or b. The clamps of the
+	// envelope loop are still selects: it is only vectorized when building with
+	// -fno-trapping-math.
+
+	template<bool start_burst>
+	void DenseSwarmEngine::StepEnvelopes(
+	    float f0,
+	    float density,
+	    bool burst_mode,
+	    float spread,
+	    float size_ratio,
+	    size_t size
+	) {
+		float const one_over_size = 1.0f / static_cast<float>(size);
+		float const scale = amplitude_scale_;
+		float const burst = burst_mode ? 1.0f : 0.0f;
+
+		for (int i = 0; i < num_blocks_; ++i) {
+			Block* b = &block_[i];
+			for (int j = 0; j < kDenseSwarmStride; ++j) {
+				// GrainEnvelope::Step().
+				float phase = 0.5f;
+				float fm = 16.0f;
+				float randomize = 1.0f;
+				if (!start_burst) {
+					phase = b->phase[j] + density * b->fm[j];
+					float const integral = static_cast<float>(static_cast<int32_t>(phase));
+					phase -= integral;
+					fm = b->fm[j];
+					randomize = min(integral, 1.0f);
+				}
+
+				uint32_t const state = b->rng_state[j];
+				uint32_t const r1 = state * 1664525u + 1013904223u;
+				uint32_t const r2 = r1 * 1664525u + 1013904223u;
+				float const u1 = static_cast<float>(r1 >> 8) * (1.0f / 16777216.0f);
+				float const u2 = static_cast<float>(r2 >> 8) * (1.0f / 16777216.0f);
+				b->rng_state[j] = randomize != 0.0f ? r2 : state;
+
+				float const from = b->from[j] + randomize * b->interval[j];
+				float const interval = randomize * (u1 - from) + (1.0f - randomize) * b->interval[j];
+				float const next_fm = burst * fm * (0.8f + 0.2f * u2) + (1.0f - burst) * (0.5f + 1.5f * u2);
+				fm = randomize * next_fm + (1.0f - randomize) * fm;
+				b->from[j] = from;
+				b->interval[j] = interval;
+				b->phase[j] = phase;
+				b->fm[j] = fm;
+
+				// GrainEnvelope::amplitude() and frequency().
+				float const voice_size_ratio = size_ratio * b->size_ratio_scale[j];
+				float const long_grain = min(
+				    static_cast<float>(static_cast<int32_t>(voice_size_ratio)), 1.0f
+				);
+				float const was_long_grain = min(
+				    static_cast<float>(static_cast<int32_t>(b->previous_size_ratio[j])), 1.0f
+				);
+				float envelope_phase = (phase - 0.5f) * voice_size_ratio;
+				envelope_phase = max(min(envelope_phase, 1.0f), -1.0f);
+				float const e = SinePolynomial(0.5f * envelope_phase + 1.25f);
+				float const target_amplitude = long_grain * 0.5f * (e + 1.0f) + (1.0f - long_grain);
+				float const crossed = fabsf(long_grain - was_long_grain);
+				float const filter_coefficient = (
+				    crossed * 0.5f + (1.0f - crossed) * b->filter_coefficient[j]
+				) * 0.95f;
+				// Would otherwise decay into denormals.
+				b->filter_coefficient[j] = filter_coefficient < 1e-10f ? 0.0f : filter_coefficient;
+				b->previous_size_ratio[j] = voice_size_ratio;
+				float amplitude = b->amplitude[j];
+				ONE_POLE(amplitude, target_amplitude, 0.5f - filter_coefficient);
+				b->amplitude[j] = amplitude;
+
+				float const rank = b->rank[j];
+				float const glide = 2.0f * (from + interval * phase) - 1.0f;
+				float const expo_amount = long_grain * from + (1.0f - long_grain) * glide;
+				float const linear_amount = rank * (rank + 0.01f) * spread * 0.25f;
+				float const f = f0 * SemitonesToRatioPolynomial(48.0f * expo_amount * spread * rank) * (1.0f + linear_amount);
+				float const level = amplitude * scale;
+
+				// AdditiveSawOscillator and FastSineOscillator parameters.
+				float const saw_frequency = min(f, kMaxFrequency);
+				b->saw_frequency_increment[j] = (saw_frequency - b->saw_frequency[j]) * one_over_size;
+				b->saw_gain_increment[j] = (level - b->saw_gain[j]) * one_over_size;
+
+				float const epsilon = FastSineOscillator::Fast2Sin(min(f, 0.25f));
+				float const sine_amplitude = max(level * (1.0f - f * 4.0f), 0.0f);
+				b->sine_epsilon_increment[j] = (epsilon - b->sine_epsilon[j]) * one_over_size;
+				b->sine_amplitude_increment[j] = (sine_amplitude - b->sine_amplitude[j]) * one_over_size;
+			}
+		}
+	}
+
+	void DenseSwarmEngine::RenderSaws(float* out, size_t size) {
+		while (size--) {
+			float sum[kDenseSwarmStride] = { 0.0f };
+			for (int i = 0; i < num_blocks_; ++i) {
+				Block* b = &block_[i];
+				for (int j = 0; j < kDenseSwarmStride; ++j) {
+					float const frequency = b->saw_frequency[j] + b->saw_frequency_increment[j];
+					float const gain = b->saw_gain[j] + b->saw_gain_increment[j];
+					float phase = b->saw_phase[j] + frequency;
+					float const wrap = static_cast<float>(static_cast<int32_t>(phase));
+					phase -= wrap;
+					float const t = phase / frequency;
+					float const this_sample = b->saw_next_sample[j] - wrap * ThisBlepSample(t);
+					b->saw_next_sample[j] = phase - wrap * NextBlepSample(t);
+					b->saw_phase[j] = phase;
+					b->saw_frequency[j] = frequency;
+					b->saw_gain[j] = gain;
+					sum[j] += (2.0f * this_sample - 1.0f) * gain;
+				}
+			}
+			float total = 0.0f;
+			for (int j = 0; j < kDenseSwarmStride; ++j) {
+				total += sum[j];
+			}
+			*out++ = total;
+		}
+	}
+
+	void DenseSwarmEngine::RenderSines(float* out, size_t size) {
+		for (int i = 0; i < num_blocks_; ++i) {
+			Block* b = &block_[i];
+			for (int j = 0; j < kDenseSwarmStride; ++j) {
+				float const x = b->sine_x[j];
+				float const y = b->sine_y[j];
+				float const norm = x * x + y * y;
+				float const renormalize = static_cast<float>(
+				    static_cast<int32_t>((norm <= 0.5f) | (norm >= 2.0f))
+				);
+				float const scale = renormalize * fast_rsqrt_carmack(norm) + (1.0f - renormalize);
+				b->sine_x[j] = x * scale;
+				b->sine_y[j] = y * scale;
+			}
+		}
+
+		while (size--) {
+			float sum[kDenseSwarmStride] = { 0.0f };
+			for (int i = 0; i < num_blocks_; ++i) {
+				Block* b = &block_[i];
+				for (int j = 0; j < kDenseSwarmStride; ++j) {
+					float const e = b->sine_epsilon[j] + b->sine_epsilon_increment[j];
+					float const amplitude = b->sine_amplitude[j] + b->sine_amplitude_increment[j];
+					float const x = b->sine_x[j] + e * b->sine_y[j];
+					float const y = b->sine_y[j] - e * x;
+					b->sine_x[j] = x;
+					b->sine_y[j] = y;
+					b->sine_epsilon[j] = e;
+					b->sine_amplitude[j] = amplitude;
+					sum[j] += amplitude * x;
+				}
+			}
+			float total = 0.0f;
+			for (int j = 0; j < kDenseSwarmStride; ++j) {
+				total += sum[j];
+			}
+			*out++ = total;
+		}
+	}
+
+	void DenseSwarmEngine::Render(
+	    EngineParameters const& parameters,
+	    float* out,
+	    float* aux,
+	    size_t size,
+	    bool* /* already_enveloped */
+	) {
+		if (!num_blocks_) {
+			fill(&out[0], &out[size], 0.0f);
+			fill(&aux[0], &aux[size], 0.0f);
+			return;
+		}
+
+		float const f0 = NoteToFrequency(parameters.note);
+		float const control_rate = static_cast<float>(size);
+		float const density = NoteToFrequency(parameters.timbre * 120.0f) *
+		                      0.025f * control_rate;
+		float const spread = parameters.harmonics * parameters.harmonics *
+		                     parameters.harmonics;
+		float const size_ratio = 0.25f * SemitonesToRatio(
+		                                     (1.0f - parameters.morph) * 84.0f
+		                                 );
+
+		bool const burst_mode = !(parameters.trigger & TRIGGER_UNPATCHED);
+		bool const start_burst = parameters.trigger & TRIGGER_RISING_EDGE;
+
+		if (start_burst) {
+			StepEnvelopes<true>(f0, density, burst_mode, spread, size_ratio, size);
+		}
+		else {
+			StepEnvelopes<false>(f0, density, burst_mode, spread, size_ratio, size);
+		}
+		RenderSaws(out, size);
+		RenderSines(aux, size);
+	}
+
+} // namespace plaits
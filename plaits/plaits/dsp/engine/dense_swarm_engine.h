@@ -0,0 +1,123 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Swarm of sawtooths and sines with up to 512 voices.
+//
+// Same sound as SwarmEngine, with the state of the voices stored as structures
+// of arrays (blocks of 8 voices) so that each step of the grain envelopes,
+// sawtooths and sines is computed for all voices in a vectorizable loop.
+// Branches are replaced by selects, and each voice has its own LCG instead of
+// a crack::audio::RNG.
+
+#ifndef PLAITS_DSP_ENGINE_DENSE_SWARM_ENGINE_H_
+#define PLAITS_DSP_ENGINE_DENSE_SWARM_ENGINE_H_
+
+#include "plaits/dsp/engine/engine.h"
+
+namespace plaits
+{
+
+	int const kDenseSwarmMaxNumVoices = 512;
+	int const kDenseSwarmStride = 8;
+
+	class DenseSwarmEngine : public Engine
+	{
+	public:
+		DenseSwarmEngine() {
+		}
+		~DenseSwarmEngine() {
+		}
+
+		virtual void Init(stmlib::BufferAllocator* allocator);
+		virtual void Reset();
+		virtual void Render(EngineParameters const& parameters, float* out, float* aux, size_t size, bool* already_enveloped);
+		virtual void ListPointers(stmlib::SnapshotPointers* pointers) const;
+
+		// Rounded up to a multiple of kDenseSwarmStride, and limited by the
+		// amount of memory given to Init().
+		void set_num_voices(int num_voices);
+		inline int num_voices() const {
+			return num_blocks_ * kDenseSwarmStride;
+		}
+		inline int max_num_voices() const {
+			return max_num_blocks_ * kDenseSwarmStride;
+		}
+
+	private:
+		struct Block
+		{
+			// Grain envelope.
+			float from[kDenseSwarmStride];
+			float interval[kDenseSwarmStride];
+			float phase[kDenseSwarmStride];
+			float fm[kDenseSwarmStride];
+			float amplitude[kDenseSwarmStride];
+			float previous_size_ratio[kDenseSwarmStride];
+			float filter_coefficient[kDenseSwarmStride];
+			uint32_t rng_state[kDenseSwarmStride];
+
+			// Sawtooth.
+			float saw_phase[kDenseSwarmStride];
+			float saw_next_sample[kDenseSwarmStride];
+			float saw_frequency[kDenseSwarmStride];
+			float saw_frequency_increment[kDenseSwarmStride];
+			float saw_gain[kDenseSwarmStride];
+			float saw_gain_increment[kDenseSwarmStride];
+
+			// Sine (magic circle).
+			float sine_x[kDenseSwarmStride];
+			float sine_y[kDenseSwarmStride];
+			float sine_epsilon[kDenseSwarmStride];
+			float sine_epsilon_increment[kDenseSwarmStride];
+			float sine_amplitude[kDenseSwarmStride];
+			float sine_amplitude_increment[kDenseSwarmStride];
+
+			// Depend on the number of voices.
+			float rank[kDenseSwarmStride];
+			float size_ratio_scale[kDenseSwarmStride];
+		};
+
+		template<bool start_burst>
+		void StepEnvelopes(
+		    float f0,
+		    float density,
+		    bool burst_mode,
+		    float spread,
+		    float size_ratio,
+		    size_t size
+		);
+		void RenderSaws(float* out, size_t size);
+		void RenderSines(float* out, size_t size);
+
+		Block* block_;
+		int max_num_blocks_;
+		int num_blocks_;
+		float amplitude_scale_;
+
+		DISALLOW_COPY_AND_ASSIGN(DenseSwarmEngine);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_ENGINE_DENSE_SWARM_ENGINE_H_
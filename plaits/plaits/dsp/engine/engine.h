@@ -33,6 +33,7 @@
 
 #include "stmlib/dsp/units.h"
 #include "stmlib/utils/buffer_allocator.h"
+#include "stmlib/utils/snapshot.h"
 
 namespace plaits
 {
@@ -98,6 +99,12 @@ namespace plaits
 		    size_t size,
 		    bool* already_enveloped
 		) = 0;
+
+		// Lists the pointers held by the engine, for Voice::Snapshot(). Most
+		// engines only hold plain data.
+		virtual void ListPointers(stmlib::SnapshotPointers* /* pointers */) const {
+		}
+
 		PostProcessingSettings post_processing_settings;
 	};
 
@@ -139,6 +146,16 @@ namespace plaits
 			return num_engines_;
 		}
 
+		// The registered engines are members of the voice: the pointers to
+		// them, their vtables, and the pointers they hold.
+		void ListPointers(stmlib::SnapshotPointers* pointers) const {
+			for (int i = 0; i < num_engines_; ++i) {
+				pointers->Add(&engine_[i]);
+				pointers->AddVtable(engine_[i]);
+				engine_[i]->ListPointers(pointers);
+			}
+		}
+
 	private:
 		Engine* engine_[max_size];
 		int num_engines_;
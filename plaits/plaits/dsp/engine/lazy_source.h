@@ -0,0 +1,98 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bookkeeping for a source which is crossfaded with others, telling when it
+// can be left unrendered.
+//
+// A source is skipped once its weight has been zero for a whole block. When
+// its weight becomes nonzero again, it is first rendered silently for another
+// block, so that the state it kept while skipped (oscillator amplitudes,
+// pending BLEP residuals, filters) settles before it fades back in. State
+// which does not settle by itself, like the phase of an oscillator synced to
+// another source, is restored by the caller as the source wakes up.
+
+#ifndef PLAITS_DSP_ENGINE_LAZY_SOURCE_H_
+#define PLAITS_DSP_ENGINE_LAZY_SOURCE_H_
+
+#include <algorithm>
+
+#include "stmlib/stmlib.h"
+
+#include "plaits/dsp/dsp.h"
+
+namespace plaits
+{
+
+	class LazySource
+	{
+	public:
+		LazySource() {
+		}
+		~LazySource() {
+		}
+
+		inline void Init() {
+			idle_time_ = 0;
+			warm_up_time_ = 0;
+			warming_up_ = false;
+		}
+
+		// Call once per render with the weight of the source over the next
+		// size samples. When the caller smoothes the weight, pass the larger
+		// of the smoothed weight and its target, so that the source wakes up
+		// while the smoothed weight is still zero. Returns false when the
+		// source does not need to be rendered.
+		inline bool Process(float weight, size_t size) {
+			if (weight != 0.0f) {
+				idle_time_ = 0;
+			}
+			else if (idle_time_ < kBlockSize) {
+				idle_time_ += size;
+			}
+			else {
+				warm_up_time_ = kBlockSize;
+				warming_up_ = false;
+				return false;
+			}
+			warming_up_ = warm_up_time_ != 0;
+			warm_up_time_ -= warming_up_ ? std::min(size, warm_up_time_) : 0;
+			return true;
+		}
+
+		// True when the source must be rendered with a zero weight.
+		inline bool warming_up() const {
+			return warming_up_;
+		}
+
+	private:
+		size_t idle_time_;
+		size_t warm_up_time_;
+		bool warming_up_;
+
+		DISALLOW_COPY_AND_ASSIGN(LazySource);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_ENGINE_LAZY_SOURCE_H_
@@ -37,7 +37,7 @@ namespace plaits
 	using namespace stmlib;
 
 	void ModalEngine::Init(BufferAllocator* allocator) {
-		temp_buffer_ = allocator->Allocate<float>(kMaxBlockSize);
+		temp_buffer_ = allocator->Allocate<float>(kMaxBlockSize, kVectorAlignment);
 		harmonics_lp_ = 0.0f;
 		Reset();
 	}
@@ -46,6 +46,10 @@ namespace plaits
 		voice_.Init();
 	}
 
+	void ModalEngine::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		pointers->Add(&temp_buffer_);
+	}
+
 	void ModalEngine::Render(
 	    EngineParameters const& parameters,
 	    float* out,
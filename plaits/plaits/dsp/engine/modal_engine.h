@@ -46,6 +46,7 @@ namespace plaits
 		virtual void Init(stmlib::BufferAllocator* allocator);
 		virtual void Reset();
 		virtual void Render(EngineParameters const& parameters, float* out, float* aux, size_t size, bool* already_enveloped);
+		virtual void ListPointers(stmlib::SnapshotPointers* pointers) const;
 
 	private:
 		ModalVoice voice_;
@@ -48,12 +48,16 @@ namespace plaits
 		previous_q_ = 0.0f;
 		previous_mode_ = 0.0f;
 
-		temp_buffer_ = allocator->Allocate<float>(kMaxBlockSize);
+		temp_buffer_ = allocator->Allocate<float>(kMaxBlockSize, kVectorAlignment);
 	}
 
 	void NoiseEngine::Reset() {
 	}
 
+	void NoiseEngine::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		pointers->Add(&temp_buffer_);
+	}
+
 	void NoiseEngine::Render(
 	    EngineParameters const& parameters,
 	    float* out,
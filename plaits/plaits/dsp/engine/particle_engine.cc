@@ -37,9 +37,7 @@ namespace plaits
 	using namespace stmlib;
 
 	void ParticleEngine::Init(BufferAllocator* allocator) {
-		for (int i = 0; i < kNumParticles; ++i) {
-			particle_[i].Init();
-		}
+		particles_.Init(kNumParticles);
 		diffuser_.Init(allocator->Allocate<uint16_t>(8192));
 		post_filter_.Init();
 	}
@@ -48,6 +46,10 @@ namespace plaits
 		diffuser_.Clear();
 	}
 
+	void ParticleEngine::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		diffuser_.ListPointers(pointers);
+	}
+
 	void ParticleEngine::Render(
 	    EngineParameters const& parameters,
 	    float* out,
@@ -59,8 +61,9 @@ namespace plaits
 		float const density_sqrt = NoteToFrequency(
 		    60.0f + parameters.timbre * parameters.timbre * 72.0f
 		);
-		float const density = density_sqrt * density_sqrt * (1.0f / kNumParticles);
-		float const gain = 1.0f / density;
+		float const density = density_sqrt * density_sqrt / static_cast<float>(
+		                          particles_.num_particles()
+		                      );
 		float const q_sqrt = SemitonesToRatio(parameters.morph >= 0.5f ? (parameters.morph - 0.5f) * 120.0f : 0.0f);
 		float const q = 0.5f + q_sqrt * q_sqrt;
 		float const spread = 48.0f * parameters.harmonics * parameters.harmonics;
@@ -74,19 +77,7 @@ namespace plaits
 		fill(&out[0], &out[size], 0.0f);
 		fill(&aux[0], &aux[size], 0.0f);
 
-		for (int i = 0; i < kNumParticles; ++i) {
-			particle_[i].Render(
-			    sync,
-			    density,
-			    gain,
-			    f0,
-			    spread,
-			    q,
-			    out,
-			    aux,
-			    size
-			);
-		}
+		particles_.Render(sync, density, f0, spread, q, out, aux, size);
 
 		post_filter_.set_f_q<FREQUENCY_DIRTY>(min(f0, 0.49f), 0.5f);
 		post_filter_.Process<FILTER_MODE_LOW_PASS>(out, out, size);
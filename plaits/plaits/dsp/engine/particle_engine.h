@@ -31,7 +31,7 @@
 
 #include "plaits/dsp/engine/engine.h"
 #include "plaits/dsp/fx/diffuser.h"
-#include "plaits/dsp/noise/particle.h"
+#include "plaits/dsp/noise/particle_bank.h"
 
 namespace plaits
 {
@@ -49,9 +49,16 @@ namespace plaits
 		virtual void Init(stmlib::BufferAllocator* allocator);
 		virtual void Reset();
 		virtual void Render(EngineParameters const& parameters, float* out, float* aux, size_t size, bool* already_enveloped);
+		virtual void ListPointers(stmlib::SnapshotPointers* pointers) const;
+
+		// Up to kParticleBankMaxNumParticles. The overall density of impulses
+		// does not change, it is spread over more resonators.
+		inline void set_num_particles(int num_particles) {
+			particles_.set_num_particles(num_particles);
+		}
 
 	private:
-		Particle particle_[kNumParticles];
+		ParticleBank particles_;
 		Diffuser diffuser_;
 		stmlib::Svf post_filter_;
 
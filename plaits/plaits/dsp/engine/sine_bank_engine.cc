@@ -0,0 +1,139 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Additive synthesis with up to 512 partials, for pads.
+
+#include "plaits/dsp/engine/sine_bank_engine.h"
+
+#include <algorithm>
+
+#include "plaits/dsp/engine/additive_engine.h"
+
+namespace plaits
+{
+
+	using namespace std;
+	using namespace stmlib;
+
+	void SineBankEngine::Init(BufferAllocator* allocator) {
+		int const num_partials_fit = static_cast<int>(
+		    allocator->free(kVectorAlignment) / (sizeof(SineBankOscillator::Block) + kSineBankStride * sizeof(float))
+		) * kSineBankStride;
+		max_num_partials_ = min(kSineBankMaxNumPartials, num_partials_fit);
+		amplitudes_ = allocator->Allocate<float>(max_num_partials_, kVectorAlignment);
+		sine_bank_.Init(allocator, max_num_partials_);
+		max_num_partials_ = sine_bank_.max_num_partials();
+		Reset();
+	}
+
+	void SineBankEngine::Reset() {
+		sine_bank_.Reset();
+		fill(&amplitudes_[0], &amplitudes_[max_num_partials_], 0.0f);
+		control_counter_ = 0;
+	}
+
+	void SineBankEngine::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		sine_bank_.ListPointers(pointers);
+		pointers->Add(&amplitudes_);
+	}
+
+	void SineBankEngine::UpdateAmplitudes(
+	    float centroid,
+	    float slope,
+	    float bumps,
+	    int num_partials
+	) {
+		float const n = (static_cast<float>(num_partials) - 1.0f);
+		float const margin = (1.0f / slope - 1.0f) / (1.0f + bumps);
+		float const center = centroid * (n + margin) - 0.5f * margin;
+
+		// The envelope is updated once per block rather than once per sample as
+		// in AdditiveEngine, hence the larger coefficient for the same smoothing.
+		// Partials fading out would otherwise decay into denormals, which are
+		// very slow to process in the sine bank: they are silenced below -200dB.
+		for (int i = 0; i < num_partials; ++i) {
+			float const gain = AdditiveGain(static_cast<float>(i), center, slope, bumps);
+			float amplitude = amplitudes_[i];
+			ONE_POLE(amplitude, gain, 0.012f);
+			amplitudes_[i] = amplitude < 1e-10f ? 0.0f : amplitude;
+		}
+
+		float sum[kSineBankStride] = { 0.0f };
+		int const num_partials_stride = num_partials - num_partials % kSineBankStride;
+		for (int i = 0; i < num_partials_stride; i += kSineBankStride) {
+			for (int j = 0; j < kSineBankStride; ++j) {
+				sum[j] += amplitudes_[i + j];
+			}
+		}
+		float total = 0.001f;
+		for (int j = 0; j < kSineBankStride; ++j) {
+			total += sum[j];
+		}
+		for (int i = num_partials_stride; i < num_partials; ++i) {
+			total += amplitudes_[i];
+		}
+
+		float const scale = 1.0f / total;
+		for (int i = 0; i < num_partials; ++i) {
+			amplitudes_[i] *= scale;
+		}
+	}
+
+	void SineBankEngine::Render(
+	    EngineParameters const& parameters,
+	    float* out,
+	    float* aux,
+	    size_t size,
+	    bool* /* already_enveloped */
+	) {
+		float const f0 = NoteToFrequency(parameters.note);
+
+		while (size) {
+			if (!control_counter_) {
+				// Same controls as AdditiveEngine, with the slope scaled to the number
+				// of partials below Nyquist.
+				int const num_partials = SineBankOscillator::NumAudiblePartials(
+				    f0,
+				    max_num_partials_
+				);
+				float const centroid = parameters.timbre;
+				float const raw_bumps = parameters.harmonics;
+				float const raw_slope = (1.0f - 0.6f * raw_bumps) * parameters.morph;
+				float const slope = (0.01f + 1.99f * raw_slope * raw_slope * raw_slope) *
+				                    24.0f / static_cast<float>(max(num_partials, 24));
+				float const bumps = 16.0f * raw_bumps * raw_bumps;
+				UpdateAmplitudes(centroid, slope, bumps, num_partials);
+				sine_bank_.Update(f0, amplitudes_, num_partials, kBlockSize);
+				control_counter_ = kBlockSize;
+			}
+			size_t const n = min(size, control_counter_);
+			sine_bank_.Render(out, aux, n);
+			out += n;
+			aux += n;
+			size -= n;
+			control_counter_ -= n;
+		}
+	}
+
+} // namespace plaits
@@ -28,6 +28,8 @@
 
 #include "plaits/dsp/engine/speech_engine.h"
 
+#include <algorithm>
+
 #include "plaits/dsp/speech/lpc_speech_synth_words.h"
 
 namespace plaits
@@ -46,9 +48,11 @@ namespace plaits
 		);
 		lpc_speech_synth_controller_.Init(&lpc_speech_synth_word_bank_);
 		word_bank_quantizer_.Init();
+		model_source_.Init();
+		sam_source_.Init();
 
-		temp_buffer_[0] = allocator->Allocate<float>(kMaxBlockSize);
-		temp_buffer_[1] = allocator->Allocate<float>(kMaxBlockSize);
+		temp_buffer_[0] = allocator->Allocate<float>(kMaxBlockSize, kVectorAlignment);
+		temp_buffer_[1] = allocator->Allocate<float>(kMaxBlockSize, kVectorAlignment);
 
 		prosody_amount_ = 0.0f;
 		speed_ = 1.0f;
@@ -73,8 +77,16 @@ namespace plaits
 		if (group <= 2.0f) {
 			*already_enveloped = false;
 
-			float blend = group;
-			if (group <= 1.0f) {
+			float blend = group <= 1.0f ? group : 2.0f - group;
+			blend *= blend * (3.0f - 2.0f * blend);
+			blend *= blend * (3.0f - 2.0f * blend);
+
+			// At the ends of the crossfade, only one of the models is heard.
+			if (!model_source_.Process(1.0f - blend, size)) {
+				fill(&aux[0], &aux[size], 0.0f);
+				fill(&out[0], &out[size], 0.0f);
+			}
+			else if (group <= 1.0f) {
 				naive_speech_synth_.Render(
 				    parameters.trigger == TRIGGER_RISING_EDGE,
 				    f0,
@@ -101,7 +113,10 @@ namespace plaits
 				    out,
 				    size
 				);
-				blend = 2.0f - blend;
+			}
+
+			if (!sam_source_.Process(blend, size)) {
+				return;
 			}
 
 			sam_speech_synth_.Render(
@@ -114,8 +129,15 @@ namespace plaits
 			    size
 			);
 
-			blend *= blend * (3.0f - 2.0f * blend);
-			blend *= blend * (3.0f - 2.0f * blend);
+			if (sam_source_.warming_up()) {
+				return;
+			}
+			else if (model_source_.warming_up()) {
+				copy(&temp_buffer_[0][0], &temp_buffer_[0][size], &aux[0]);
+				copy(&temp_buffer_[1][0], &temp_buffer_[1][size], &out[0]);
+				return;
+			}
+
 			for (size_t i = 0; i < size; ++i) {
 				aux[i] += (temp_buffer_[0][i] - aux[i]) * blend;
 				out[i] += (temp_buffer_[1][i] - out[i]) * blend;
@@ -32,6 +32,7 @@
 #include "stmlib/dsp/hysteresis_quantizer.h"
 
 #include "plaits/dsp/engine/engine.h"
+#include "plaits/dsp/engine/lazy_source.h"
 #include "plaits/dsp/speech/lpc_speech_synth_controller.h"
 #include "plaits/dsp/speech/naive_speech_synth.h"
 #include "plaits/dsp/speech/sam_speech_synth.h"
@@ -62,6 +63,9 @@ namespace plaits
 	private:
 		stmlib::HysteresisQuantizer word_bank_quantizer_;
 
+		LazySource model_source_;
+		LazySource sam_source_;
+
 		NaiveSpeechSynth naive_speech_synth_;
 		SAMSpeechSynth sam_speech_synth_;
 
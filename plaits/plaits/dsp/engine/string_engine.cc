@@ -37,7 +37,7 @@ namespace plaits
 	using namespace stmlib;
 
 	void StringEngine::Init(BufferAllocator* allocator) {
-		temp_buffer_ = allocator->Allocate<float>(kMaxBlockSize);
+		temp_buffer_ = allocator->Allocate<float>(kMaxBlockSize, kVectorAlignment);
 		for (int i = 0; i < kNumStrings; ++i) {
 			voice_[i].Init(allocator);
 			f0_[i] = 0.01f;
@@ -53,6 +53,14 @@ namespace plaits
 		}
 	}
 
+	void StringEngine::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		for (int i = 0; i < kNumStrings; ++i) {
+			voice_[i].ListPointers(pointers);
+		}
+		f0_delay_.ListPointers(pointers);
+		pointers->Add(&temp_buffer_);
+	}
+
 	void StringEngine::Render(
 	    EngineParameters const& parameters,
 	    float* out,
@@ -32,9 +32,6 @@
 
 #include "stmlib/dsp/parameter_interpolator.h"
 
-#include <crack/audio/AudioConversions.h>
-#include <crack/audio/MathContext.h>
-
 namespace plaits
 {
 
@@ -46,6 +43,7 @@ namespace plaits
 		auxiliary_.Init();
 		sync_.Init();
 		variable_saw_.Init();
+		sync_source_.Init();
 
 		auxiliary_amount_ = 0.0f;
 		xmod_amount_ = 0.0f;
@@ -62,7 +60,8 @@ namespace plaits
 		return x * x * (3.0f - 2.0f * x);
 	}
 
-	float VirtualAnalogEngine::ComputeDetuning(float detune) const {
+	/* static */
+	float VirtualAnalogEngine::ComputeDetuning(float detune) {
 		detune = 2.05f * detune - 1.025f;
 		CONSTRAIN(detune, -1.0f, 1.0f);
 
@@ -147,15 +146,19 @@ namespace plaits
 		CONSTRAIN(pw, 0.5f, 0.99f);
 
 		primary_.Render<false>(primary_f, primary_f, pw, shape, out, size);
-		sync_.Render<true>(primary_f, sync_f, pw, shape, aux, size);
 
-		ParameterInterpolator xmod_amount_modulation(
-		    &xmod_amount_,
-		    squashed_xmod_amount * (2.0f - squashed_xmod_amount),
-		    size
-		);
-		for (size_t i = 0; i < size; ++i) {
-			out[i] += (aux[i] - out[i]) * xmod_amount_modulation.Next();
+		float const target_xmod_amount = squashed_xmod_amount * (2.0f - squashed_xmod_amount);
+		if (sync_source_.Process(max(xmod_amount_, target_xmod_amount), size)) {
+			sync_.Render<true>(primary_f, sync_f, pw, shape, aux, size);
+
+			ParameterInterpolator xmod_amount_modulation(
+			    &xmod_amount_,
+			    sync_source_.warming_up() ? 0.0f : target_xmod_amount,
+			    size
+			);
+			for (size_t i = 0; i < size; ++i) {
+				out[i] += (aux[i] - out[i]) * xmod_amount_modulation.Next();
+			}
 		}
 
 		auxiliary_.Render<false>(auxiliary_f, auxiliary_f, pw, shape, aux, size);
@@ -170,61 +173,98 @@ namespace plaits
 		}
 
 #elif VA_VARIANT == 2
-		using math = crack::audio::StdContext;
 
 		// 1 = variable square controlled by TIMBRE.
 		// 2 = variable saw controlled by MORPH.
 		// OUT = 1 + 2.
 		// AUX = dual variable waveshape controlled by MORPH, self sync by TIMBRE.
+		Controls c;
+		ComputeControls(parameters, &c);
+
+		// sync_ stops following the master phase it shares with primary_ while
+		// the square is muted, and picks it up again as it wakes up, along with
+		// the slave phase the sync would have given it.
+		bool const render_square = sync_source_.Process(c.square_gain, size);
+		if (render_square && sync_source_.warming_up()) {
+			sync_.set_master_phase(
+			    primary_.master_phase(),
+			    c.primary_f,
+			    c.square_sync_f,
+			    c.square_pw
+			);
+		}
+
+		// Render monster sync to AUX.
+		primary_.Render<true>(c.primary_f, c.primary_sync_f, c.pw, c.shape, out, size);
+		auxiliary_.Render<true>(c.auxiliary_f, c.auxiliary_sync_f, c.pw, c.shape, aux, size);
+		*aux = (*aux - *out) * 0.5f;
+
+		// Render double varishape to OUT.
+		float square = 0.0f;
+		if (render_square) {
+			sync_.Render<true>(c.primary_f, c.square_sync_f, c.square_pw, 1.0f, &square, size);
+			square = sync_source_.warming_up() ? 0.0f : square;
+		}
+		variable_saw_.Render(c.auxiliary_f, c.saw_pw, c.saw_shape, out, size);
+
+		float norm = 1.0f / (std::max(c.square_gain, c.saw_gain));
+
+		*out = (*out * c.saw_gain * 0.3f + square * c.square_gain * 0.5f) * norm;
+
+#endif // VA_VARIANT values
+	}
+
+#if VA_VARIANT == 2
 
+	/* static */
+	template<typename math>
+	void VirtualAnalogEngine::ComputeControls(
+	    EngineParameters const& parameters,
+	    Controls* c
+	) {
 		float const sync_amount = parameters.timbre * parameters.timbre;
 		float const auxiliary_detune = ComputeDetuning(parameters.harmonics);
-		float const primary_f = math::min(0.25f, parameters.samplePeriod * crack::audio::conversions::midiToFrequency(parameters.note, 440.0f));
-		float const auxiliary_f = math::min(0.25f, parameters.samplePeriod * crack::audio::conversions::midiToFrequency(parameters.note + auxiliary_detune, 440.0f));
-		float const primary_sync_f = math::min(0.25f, parameters.samplePeriod * crack::audio::conversions::midiToFrequency(parameters.note + sync_amount * 48.0f, 440.0f));
-		float const auxiliary_sync_f = math::min(0.25f, parameters.samplePeriod * crack::audio::conversions::midiToFrequency(parameters.note + auxiliary_detune + sync_amount * 48.0f, 440.0f));
+		c->primary_f = math::min(0.25f, parameters.samplePeriod * math::note_to_frequency(parameters.note, 440.0f));
+		c->auxiliary_f = math::min(0.25f, parameters.samplePeriod * math::note_to_frequency(parameters.note + auxiliary_detune, 440.0f));
+		c->primary_sync_f = math::min(0.25f, parameters.samplePeriod * math::note_to_frequency(parameters.note + sync_amount * 48.0f, 440.0f));
+		c->auxiliary_sync_f = math::min(0.25f, parameters.samplePeriod * math::note_to_frequency(parameters.note + auxiliary_detune + sync_amount * 48.0f, 440.0f));
 
-		float shape = math::clamp(parameters.morph * 1.5f, 0.0f, 1.0f);
+		c->shape = math::clamp(parameters.morph * 1.5f, 0.0f, 1.0f);
 
-		float pw = math::clamp(0.5f + (parameters.morph - 0.66f) * 1.46f, 0.5, 0.995f);
+		c->pw = math::clamp(0.5f + (parameters.morph - 0.66f) * 1.46f, 0.5, 0.995f);
 
-		// Render monster sync to AUX.
-		primary_.Render<true>(primary_f, primary_sync_f, pw, shape, out, size);
-		auxiliary_.Render<true>(auxiliary_f, auxiliary_sync_f, pw, shape, aux, size);
-		*aux = (*aux - *out) * 0.5f;
-
-		// Render double varishape to OUT.
-		float square_pw = math::clamp(1.3f * parameters.timbre - 0.15f, 0.005f, 0.5f);
+		c->square_pw = math::clamp(1.3f * parameters.timbre - 0.15f, 0.005f, 0.5f);
 
 		float const square_sync_ratio =
 		    parameters.timbre < 0.5f
 		        ? 0.0f
 		        : (parameters.timbre - 0.5f) * (parameters.timbre - 0.5f) * 4.0f * 48.0f;
 
-		float const square_gain = min(parameters.timbre * 8.0f, 1.0f);
+		c->square_gain = min(parameters.timbre * 8.0f, 1.0f);
 
 		float saw_pw =
 		    parameters.morph < 0.5f
 		        ? parameters.morph + 0.5f
 		        : 1.0f - (parameters.morph - 0.5f) * 2.0f;
 
-		saw_pw = math::clamp(saw_pw * 1.1f, 0.005f, 1.0f);
+		c->saw_pw = math::clamp(saw_pw * 1.1f, 0.005f, 1.0f);
 
-		float saw_shape = math::clamp(10.0f - 21.0f * parameters.morph, 0.0f, 1.0f);
+		c->saw_shape = math::clamp(10.0f - 21.0f * parameters.morph, 0.0f, 1.0f);
 
-		float saw_gain = math::clamp(8.0f * (1.0f - parameters.morph), 0.02f, 1.0f);
+		c->saw_gain = math::clamp(8.0f * (1.0f - parameters.morph), 0.02f, 1.0f);
 
-		float const square_sync_f = parameters.samplePeriod * crack::audio::conversions::midiToFrequency(parameters.note + square_sync_ratio, 440.0f);
-
-		float square = 0.0f;
-		sync_.Render<true>(primary_f, square_sync_f, square_pw, 1.0f, &square, size);
-		variable_saw_.Render(auxiliary_f, saw_pw, saw_shape, out, size);
-
-		float norm = 1.0f / (std::max(square_gain, saw_gain));
+		c->square_sync_f = parameters.samplePeriod * math::note_to_frequency(parameters.note + square_sync_ratio, 440.0f);
+	}
 
-		*out = (*out * saw_gain * 0.3f + square * square_gain * 0.5f) * norm;
+	template void VirtualAnalogEngine::ComputeControls<ExactMath>(
+	    EngineParameters const& parameters,
+	    Controls* c
+	);
+	template void VirtualAnalogEngine::ComputeControls<FastMath>(
+	    EngineParameters const& parameters,
+	    Controls* c
+	);
 
-#endif // VA_VARIANT values
-	}
+#endif // VA_VARIANT == 2
 
 } // namespace plaits
@@ -30,6 +30,7 @@
 #define PLAITS_DSP_ENGINE_VIRTUAL_ANALOG_ENGINE_H_
 
 #include "plaits/dsp/engine/engine.h"
+#include "plaits/dsp/engine/lazy_source.h"
 #include "plaits/dsp/oscillator/variable_saw_oscillator.h"
 #include "plaits/dsp/oscillator/variable_shape_oscillator.h"
 
@@ -50,8 +51,34 @@ namespace plaits
 		virtual void Reset();
 		virtual void Render(EngineParameters const& parameters, float* out, float* aux, size_t size, bool* already_enveloped);
 
+#if VA_VARIANT == 2
+		// Oscillator controls derived from the engine parameters, shared with
+		// VirtualAnalogEngineLanes.
+		struct Controls
+		{
+			float primary_f;
+			float auxiliary_f;
+			float primary_sync_f;
+			float auxiliary_sync_f;
+			float shape;
+			float pw;
+
+			float square_pw;
+			float square_sync_f;
+			float square_gain;
+			float saw_pw;
+			float saw_shape;
+			float saw_gain;
+		};
+		template<typename math = stmlib::DefaultMath>
+		static void ComputeControls(EngineParameters const& parameters, Controls* c);
+#endif // VA_VARIANT == 2
+
 	private:
-		float ComputeDetuning(float detune) const;
+		template<int num_lanes, typename math>
+		friend class VirtualAnalogEngineLanes;
+
+		static float ComputeDetuning(float detune);
 
 		VariableShapeOscillator primary_;
 		VariableShapeOscillator auxiliary_;
@@ -59,6 +86,9 @@ namespace plaits
 		VariableShapeOscillator sync_;
 		VariableSawOscillator variable_saw_;
 
+		// Skips sync_ when its square (or cross-modulation) is muted.
+		LazySource sync_source_;
+
 		float auxiliary_amount_;
 		float xmod_amount_;
 
@@ -0,0 +1,131 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// VirtualAnalogEngine rendering num_lanes voices in a single pass.
+
+#ifndef PLAITS_DSP_ENGINE_VIRTUAL_ANALOG_ENGINE_LANES_H_
+#define PLAITS_DSP_ENGINE_VIRTUAL_ANALOG_ENGINE_LANES_H_
+
+#include <algorithm>
+
+#include "plaits/dsp/engine/virtual_analog_engine.h"
+#include "plaits/dsp/oscillator/variable_saw_oscillator_lanes.h"
+#include "plaits/dsp/oscillator/variable_shape_oscillator_lanes.h"
+
+static_assert(VA_VARIANT == 2, "Only VA_VARIANT 2 has a lane-parallel renderer");
+
+namespace plaits
+{
+
+	// The math policy (see stmlib/dsp/math_policy.h) is used by the controls
+	// and the oscillators.
+	template<int num_lanes, typename math = stmlib::DefaultMath>
+	class VirtualAnalogEngineLanes
+	{
+	public:
+		VirtualAnalogEngineLanes() {
+		}
+		~VirtualAnalogEngineLanes() {
+		}
+
+		// Copies the oscillators of a scalar engine to, or back from, a lane.
+		void Load(int lane, VirtualAnalogEngine const& e) {
+			primary_.Load(lane, e.primary_);
+			auxiliary_.Load(lane, e.auxiliary_);
+			sync_.Load(lane, e.sync_);
+			variable_saw_.Load(lane, e.variable_saw_);
+		}
+
+		void Store(int lane, VirtualAnalogEngine* e) const {
+			primary_.Store(lane, &e->primary_);
+			auxiliary_.Store(lane, &e->auxiliary_);
+			sync_.Store(lane, &e->sync_);
+			variable_saw_.Store(lane, &e->variable_saw_);
+		}
+
+		// Renders one sample per lane, see VirtualAnalogEngine::Render().
+		void Render(EngineParameters const* parameters, float* out, float* aux) {
+			float primary_f[num_lanes];
+			float auxiliary_f[num_lanes];
+			float primary_sync_f[num_lanes];
+			float auxiliary_sync_f[num_lanes];
+			float shape[num_lanes];
+			float pw[num_lanes];
+			float square_pw[num_lanes];
+			float square_sync_f[num_lanes];
+			float saw_pw[num_lanes];
+			float saw_shape[num_lanes];
+			float square_gain[num_lanes];
+			float saw_gain[num_lanes];
+
+			for (int i = 0; i < num_lanes; ++i) {
+				VirtualAnalogEngine::Controls c;
+				VirtualAnalogEngine::ComputeControls<math>(parameters[i], &c);
+				primary_f[i] = c.primary_f;
+				auxiliary_f[i] = c.auxiliary_f;
+				primary_sync_f[i] = c.primary_sync_f;
+				auxiliary_sync_f[i] = c.auxiliary_sync_f;
+				shape[i] = c.shape;
+				pw[i] = c.pw;
+				square_pw[i] = c.square_pw;
+				square_sync_f[i] = c.square_sync_f;
+				saw_pw[i] = c.saw_pw;
+				saw_shape[i] = c.saw_shape;
+				square_gain[i] = c.square_gain;
+				saw_gain[i] = c.saw_gain;
+			}
+
+			// Render monster sync to AUX.
+			primary_.template Render<true, math>(primary_f, primary_sync_f, pw, shape, out);
+			auxiliary_.template Render<true, math>(auxiliary_f, auxiliary_sync_f, pw, shape, aux);
+			for (int i = 0; i < num_lanes; ++i) {
+				aux[i] = (aux[i] - out[i]) * 0.5f;
+			}
+
+			// Render double varishape to OUT.
+			float one[num_lanes];
+			float square[num_lanes];
+			std::fill(&one[0], &one[num_lanes], 1.0f);
+			sync_.template Render<true, math>(primary_f, square_sync_f, square_pw, one, square);
+			variable_saw_.template Render<math>(auxiliary_f, saw_pw, saw_shape, out);
+
+			for (int i = 0; i < num_lanes; ++i) {
+				float norm = 1.0f / (std::max(square_gain[i], saw_gain[i]));
+				out[i] = (out[i] * saw_gain[i] * 0.3f + square[i] * square_gain[i] * 0.5f) * norm;
+			}
+		}
+
+	private:
+		VariableShapeOscillatorLanes<num_lanes> primary_;
+		VariableShapeOscillatorLanes<num_lanes> auxiliary_;
+
+		VariableShapeOscillatorLanes<num_lanes> sync_;
+		VariableSawOscillatorLanes<num_lanes> variable_saw_;
+
+		DISALLOW_COPY_AND_ASSIGN(VirtualAnalogEngineLanes);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_ENGINE_VIRTUAL_ANALOG_ENGINE_LANES_H_
@@ -38,6 +38,9 @@ namespace plaits
 	using namespace std;
 	using namespace stmlib;
 
+	const size_t table_size = 256;
+	float const table_size_f = float(table_size);
+
 	void WavetableEngine::Init(BufferAllocator* allocator) {
 		phase_ = 0.0f;
 
@@ -55,11 +58,53 @@ namespace plaits
 		previous_f0_ = a0;
 
 		diff_out_.Init();
+
+		set_bank(NULL);
+	}
+
+	void WavetableEngine::set_bank(WavetableBank const* bank) {
+		if (bank) {
+			waves_ = bank->wave(0);
+			num_waves_ = int(bank->num_waves());
+		}
+		else {
+			waves_ = wav_integrated_waves;
+			num_waves_ = WAV_INTEGRATED_WAVES_SIZE / int(table_size + 4);
+		}
+#ifdef WAVETABLE_MIPMAPS
+		mipmaps_ = bank ? &bank->mipmaps() : &WavetableMipmaps::Default();
+		ComputeWaveIndices();
+#endif // WAVETABLE_MIPMAPS
 	}
 
+#ifdef WAVETABLE_MIPMAPS
+	void WavetableEngine::ComputeWaveIndices() {
+		for (int z = 0; z < 9; ++z) {
+			int const folded_z = z >= 4 ? 7 - z : z;
+			int const randomize = folded_z == 3 ? 101 : 1;
+			for (int y = 0; y < 9; ++y) {
+				for (int x = 0; x < 9; ++x) {
+					int wave = ((x + y * 8 + folded_z * 64) * randomize) % 192;
+					if (wave < 0) {
+						wave += 192;
+					}
+					wave_index_[z][y][x] = static_cast<uint8_t>(wave % num_waves_);
+				}
+			}
+		}
+	}
+#endif // WAVETABLE_MIPMAPS
+
 	void WavetableEngine::Reset() {
 	}
 
+	void WavetableEngine::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		pointers->Add(&waves_);
+#ifdef WAVETABLE_MIPMAPS
+		pointers->Add(&mipmaps_);
+#endif // WAVETABLE_MIPMAPS
+	}
+
 	inline float Clamp(float x, float amount) {
 		x = x - 0.5f;
 		x *= amount;
@@ -68,10 +113,9 @@ namespace plaits
 		return x;
 	}
 
-	const size_t table_size = 256;
-	float const table_size_f = float(table_size);
-
 	inline float ReadWave(
+	    int16_t const* waves,
+	    int num_waves,
 	    int x,
 	    int y,
 	    int z,
@@ -79,9 +123,9 @@ namespace plaits
 	    int phase_integral,
 	    float phase_fractional
 	) {
-		int wave = ((x + y * 8 + z * 64) * randomize) % 192;
+		int wave = ((x + y * 8 + z * 64) * randomize) % 192 % num_waves;
 		return InterpolateWaveHermite(
-		    wav_integrated_waves + wave * (table_size + 4),
+		    waves + wave * (table_size + 4),
 		    phase_integral,
 		    phase_fractional
 		);
@@ -127,14 +171,16 @@ namespace plaits
 		    &previous_z_, static_cast<float>(z_integral) + z_fractional, size
 		);
 
+#ifdef WAVETABLE_MIPMAPS
+		// Pick the level for the highest frequency reached during the block.
+		size_t const level = WavetableMipmaps::Level(max(previous_f0_, f0));
+#endif // WAVETABLE_MIPMAPS
+
 		ParameterInterpolator f0_modulation(&previous_f0_, f0, size);
 
 		while (size--) {
 			float const f0 = f0_modulation.Next();
 
-			float const gain = (1.0f / (f0 * 131072.0f)) * (0.95f - f0);
-			float const cutoff = min(table_size_f * f0, 1.0f);
-
 			ONE_POLE(x_lp_, x_modulation.Next(), lp_coefficient);
 			ONE_POLE(y_lp_, y_modulation.Next(), lp_coefficient);
 			ONE_POLE(z_lp_, z_modulation.Next(), lp_coefficient);
@@ -155,7 +201,44 @@ namespace plaits
 			float const p = phase_ * table_size_f;
 			MAKE_INTEGRAL_FRACTIONAL(p);
 
+#ifdef WAVETABLE_MIPMAPS
 			{
+				float const x_weight[2] = { 1.0f - x_fractional, x_fractional };
+				float const y_weight[2] = { 1.0f - y_fractional, y_fractional };
+				float const z_weight[2] = { 1.0f - z_fractional, z_fractional };
+
+				// The eight corners are processed as independent lanes.
+				float const* wave[8];
+				float weight[8];
+				for (int i = 0; i < 8; ++i) {
+					int const dx = i & 1;
+					int const dy = (i >> 1) & 1;
+					int const dz = i >> 2;
+					wave[i] = mipmaps_->wave(
+					    level,
+					    wave_index_[z_integral + dz][y_integral + dy][x_integral + dx]
+					);
+					weight[i] = x_weight[dx] * y_weight[dy] * z_weight[dz];
+				}
+
+				float corner[8];
+				for (int i = 0; i < 8; ++i) {
+					corner[i] = InterpolateWaveHermite(wave[i], p_integral, p_fractional);
+				}
+
+				float mix = 0.0f;
+				for (int i = 0; i < 8; ++i) {
+					mix += corner[i] * weight[i];
+				}
+				mix *= 0.95f - f0;
+				*out++ = mix;
+				*aux++ = static_cast<float>(static_cast<int>(mix * 32.0f)) / 32.0f;
+			}
+#else
+			{
+				float const gain = (1.0f / (f0 * 131072.0f)) * (0.95f - f0);
+				float const cutoff = min(table_size_f * f0, 1.0f);
+
 				int x0 = x_integral;
 				int x1 = x_integral + 1;
 				int y0 = y_integral;
@@ -173,22 +256,22 @@ namespace plaits
 				int r0 = z0 == 3 ? 101 : 1;
 				int r1 = z1 == 3 ? 101 : 1;
 
-				float x0y0z0 = ReadWave(x0, y0, z0, r0, p_integral, p_fractional);
-				float x1y0z0 = ReadWave(x1, y0, z0, r0, p_integral, p_fractional);
+				float x0y0z0 = ReadWave(waves_, num_waves_, x0, y0, z0, r0, p_integral, p_fractional);
+				float x1y0z0 = ReadWave(waves_, num_waves_, x1, y0, z0, r0, p_integral, p_fractional);
 				float xy0z0 = x0y0z0 + (x1y0z0 - x0y0z0) * x_fractional;
 
-				float x0y1z0 = ReadWave(x0, y1, z0, r0, p_integral, p_fractional);
-				float x1y1z0 = ReadWave(x1, y1, z0, r0, p_integral, p_fractional);
+				float x0y1z0 = ReadWave(waves_, num_waves_, x0, y1, z0, r0, p_integral, p_fractional);
+				float x1y1z0 = ReadWave(waves_, num_waves_, x1, y1, z0, r0, p_integral, p_fractional);
 				float xy1z0 = x0y1z0 + (x1y1z0 - x0y1z0) * x_fractional;
 
 				float xyz0 = xy0z0 + (xy1z0 - xy0z0) * y_fractional;
 
-				float x0y0z1 = ReadWave(x0, y0, z1, r1, p_integral, p_fractional);
-				float x1y0z1 = ReadWave(x1, y0, z1, r1, p_integral, p_fractional);
+				float x0y0z1 = ReadWave(waves_, num_waves_, x0, y0, z1, r1, p_integral, p_fractional);
+				float x1y0z1 = ReadWave(waves_, num_waves_, x1, y0, z1, r1, p_integral, p_fractional);
 				float xy0z1 = x0y0z1 + (x1y0z1 - x0y0z1) * x_fractional;
 
-				float x0y1z1 = ReadWave(x0, y1, z1, r1, p_integral, p_fractional);
-				float x1y1z1 = ReadWave(x1, y1, z1, r1, p_integral, p_fractional);
+				float x0y1z1 = ReadWave(waves_, num_waves_, x0, y1, z1, r1, p_integral, p_fractional);
+				float x1y1z1 = ReadWave(waves_, num_waves_, x1, y1, z1, r1, p_integral, p_fractional);
 				float xy1z1 = x0y1z1 + (x1y1z1 - x0y1z1) * x_fractional;
 
 				float xyz1 = xy0z1 + (xy1z1 - xy0z1) * y_fractional;
@@ -198,6 +281,7 @@ namespace plaits
 				*out++ = mix;
 				*aux++ = static_cast<float>(static_cast<int>(mix * 32.0f)) / 32.0f;
 			}
+#endif // WAVETABLE_MIPMAPS
 		}
 	}
 
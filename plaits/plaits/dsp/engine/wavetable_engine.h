@@ -32,6 +32,8 @@
 #include "stmlib/dsp/hysteresis_quantizer.h"
 
 #include "plaits/dsp/engine/engine.h"
+#include "plaits/dsp/oscillator/wavetable_bank.h"
+#include "plaits/dsp/oscillator/wavetable_mipmaps.h"
 #include "plaits/dsp/oscillator/wavetable_oscillator.h"
 
 namespace plaits
@@ -48,8 +50,18 @@ namespace plaits
 		virtual void Init(stmlib::BufferAllocator* allocator);
 		virtual void Reset();
 		virtual void Render(EngineParameters const& parameters, float* out, float* aux, size_t size, bool* already_enveloped);
+		virtual void ListPointers(stmlib::SnapshotPointers* pointers) const;
+
+		// Reads the waves from a bank loaded at runtime rather than from the
+		// built-in waves. Must be called after Init(), NULL restores the
+		// built-in waves. The bank is not owned and must outlive the engine.
+		void set_bank(WavetableBank const* bank);
 
 	private:
+#ifdef WAVETABLE_MIPMAPS
+		void ComputeWaveIndices();
+#endif // WAVETABLE_MIPMAPS
+
 		float phase_;
 
 		float x_pre_lp_;
@@ -67,6 +79,17 @@ namespace plaits
 
 		Differentiator diff_out_;
 
+		int16_t const* waves_;
+		int num_waves_;
+
+#ifdef WAVETABLE_MIPMAPS
+		WavetableMipmaps const* mipmaps_;
+
+		// Wave read at each corner of the terrain, with the z folding and the
+		// scrambling of the last row already applied.
+		uint8_t wave_index_[9][9][9];
+#endif // WAVETABLE_MIPMAPS
+
 		DISALLOW_COPY_AND_ASSIGN(WavetableEngine);
 	};
 
@@ -47,6 +47,7 @@ namespace plaits
 			gain_ = 1.0f;
 			frequency_ = 0.5f;
 			hf_bleed_ = 0.0f;
+			ramp_up_ = false;
 		}
 
 		inline void Trigger() {
@@ -54,6 +54,10 @@ namespace plaits
 			engine_.Clear();
 		}
 
+		void ListPointers(stmlib::SnapshotPointers* pointers) const {
+			engine_.ListPointers(pointers);
+		}
+
 		void Process(float amount, float rt, float* in_out, size_t size) {
 			typedef E::Reserve<126, E::Reserve<180, E::Reserve<269, E::Reserve<444, E::Reserve<1653, E::Reserve<2010, E::Reserve<3411>>>>>>> Memory;
 			E::DelayLine<Memory, 0> ap1;
@@ -90,7 +94,7 @@ namespace plaits
 				*in_out += amount * (wet - *in_out);
 				++in_out;
 			}
-			lp_decay_ = lp;
+			lp_decay_ = stmlib::FlushDenormal(lp);
 		}
 
 	private:
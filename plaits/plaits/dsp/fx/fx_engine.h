@@ -34,7 +34,9 @@
 #include "stmlib/stmlib.h"
 
 #include "stmlib/dsp/cosine_oscillator.h"
+#include "stmlib/dsp/denormal.h"
 #include "stmlib/dsp/dsp.h"
+#include "stmlib/utils/snapshot.h"
 
 namespace plaits
 {
@@ -102,7 +104,7 @@ namespace plaits
 		}
 
 		static inline T Compress(float value) {
-			return value;
+			return stmlib::FlushDenormal(value);
 		}
 	};
 
@@ -127,6 +129,10 @@ namespace plaits
 			write_ptr_ = 0;
 		}
 
+		void ListPointers(stmlib::SnapshotPointers* pointers) const {
+			pointers->Add(&buffer_);
+		}
+
 		struct Empty
 		{
 		};
@@ -0,0 +1,72 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Lookup tables computed at compile time.
+
+#include "plaits/dsp/lookup_tables.h"
+
+namespace plaits
+{
+	using namespace lookup_tables;
+
+	// The tables are evaluated in this translation unit only.
+	constexpr auto sine = Sine<1024>();
+	constexpr auto fm_frequency_quantizer = FmFrequencyQuantizer();
+	constexpr auto fold = Fold<512>();
+	constexpr auto fold_2 = Fold2<512>();
+	constexpr auto stiffness = Stiffness<64>();
+	constexpr auto svf_shift = SvfShift<257>();
+
+	float const lut_sine[LUT_SINE_SIZE] = {
+		STMLIB_LOOKUP_TABLE_VALUES_1024(sine, 0),
+		STMLIB_LOOKUP_TABLE_VALUES_256(sine, 1024),
+		STMLIB_LOOKUP_TABLE_VALUES_1(sine, 1280)
+	};
+
+	float const lut_fm_frequency_quantizer[LUT_FM_FREQUENCY_QUANTIZER_SIZE] = {
+		STMLIB_LOOKUP_TABLE_VALUES_128(fm_frequency_quantizer, 0),
+		STMLIB_LOOKUP_TABLE_VALUES_1(fm_frequency_quantizer, 128)
+	};
+
+	float const lut_fold[LUT_FOLD_SIZE] = {
+		STMLIB_LOOKUP_TABLE_VALUES_512(fold, 0),
+		STMLIB_LOOKUP_TABLE_VALUES_4(fold, 512)
+	};
+
+	float const lut_fold_2[LUT_FOLD_2_SIZE] = {
+		STMLIB_LOOKUP_TABLE_VALUES_512(fold_2, 0),
+		STMLIB_LOOKUP_TABLE_VALUES_4(fold_2, 512)
+	};
+
+	float const lut_stiffness[LUT_STIFFNESS_SIZE] = {
+		STMLIB_LOOKUP_TABLE_VALUES_64(stiffness, 0),
+		STMLIB_LOOKUP_TABLE_VALUES_1(stiffness, 64)
+	};
+
+	float const lut_svf_shift[LUT_SVF_SHIFT_SIZE] = {
+		STMLIB_LOOKUP_TABLE_VALUES_256(svf_shift, 0),
+		STMLIB_LOOKUP_TABLE_VALUES_1(svf_shift, 256)
+	};
+
+} // namespace plaits
@@ -0,0 +1,134 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Lookup tables computed at compile time. They used to be generated by
+// resources/lookup_tables.py; the generators follow the python code line by
+// line. Generators shared with other modules are in stmlib.
+
+#ifndef PLAITS_DSP_LOOKUP_TABLES_H_
+#define PLAITS_DSP_LOOKUP_TABLES_H_
+
+#include "stmlib/stmlib.h"
+#include "stmlib/dsp/constexpr_math.h"
+#include "stmlib/dsp/lookup_table_generators.h"
+
+namespace plaits
+{
+
+	namespace lookup_tables
+	{
+
+		using namespace stmlib::constexpr_math;
+		using namespace stmlib::lookup_table_generators;
+
+		// Bipolar fold (sine folder fading into a soft-clipper).
+		template<size_t size>
+		constexpr stmlib::LookupTable<size + 4> Fold() {
+			double fold[size + 4] = { };
+			double peak = 0.0;
+			for (size_t i = 0; i < size + 4; ++i) {
+				size_t const j = i == size + 3 ? size + 2 : i;
+				double const x = double(j) / (size / 2.0) - 1.0;
+				double const sine = Sin(8 * kPi * x);
+				double const window = Exp(-x * x * 4) * Exp(-x * x * 4);
+				fold[i] = sine * window + Atan(3 * x) * (1 - window);
+				peak = Abs(fold[i]) > peak ? Abs(fold[i]) : peak;
+			}
+			return stmlib::MakeLookupTable<size + 4>(
+			    [&fold, peak](size_t i) { return fold[i] / peak; }
+			);
+		}
+
+		constexpr double Deadband(
+		    double v_in,
+		    double r_in,
+		    double r_load,
+		    double r_fb = 150.0e3,
+		    double v_sat = 10.47
+		) {
+			double v_out = -r_fb / r_in * v_in;
+			if (v_out >= v_sat) {
+				v_out = v_sat;
+			}
+			if (v_out < -v_sat) {
+				v_out = -v_sat;
+			}
+			return (v_in * r_fb * r_load + v_out * r_in * r_load) / (r_fb * r_load + r_in * r_load + r_in * r_fb);
+		}
+
+		constexpr double Diode(double x) {
+			return 0.7 * x / (0.3 + Abs(x));
+		}
+
+		// Model of the wavefolder of the Buchla 259.
+		template<size_t size>
+		constexpr stmlib::LookupTable<size + 4> Fold2() {
+			double fold[size + 4] = { };
+			double peak = 0.0;
+			for (size_t i = 0; i < size + 4; ++i) {
+				size_t const j = i == size + 3 ? size + 2 : i;
+				double const x = double(j) / (size / 2.0) - 1.0;
+				double const v_in = x * 12.0;
+				double const stage_1 = Deadband(v_in, 10e3, 100e3);
+				double const stage_2 = Deadband(v_in, 49.9e3, 44.2e3);
+				double const stage_3 = Deadband(v_in, 91e3, 18e3);
+				double const stage_4 = Deadband(v_in, 30e3, 71.4e3);
+				double const stage_5 = Deadband(v_in, 68e3, 33.0e3);
+				double const stage_45 = -33.0 / 71.4 * stage_4 - 33.0 / 33.0 * stage_5 - 33.0 / 240.0 * v_in;
+				fold[i] = Diode(-150.0 / 100.0 * stage_1 - 150.0 / 44.2 * stage_2 - 150.0 / 18.0 * stage_3 - 150.0 / 33.0 * stage_45);
+				peak = i == 0 || fold[i] > peak ? fold[i] : peak;
+			}
+			return stmlib::MakeLookupTable<size + 4>(
+			    [&fold, peak](size_t i) { return fold[i] / peak; }
+			);
+		}
+
+		// Delay compensation factor for SVF, one entry per semitone.
+		template<size_t size>
+		constexpr stmlib::LookupTable<size> SvfShift() {
+			return stmlib::MakeLookupTable<size>([](size_t i) {
+				double const ratio = Pow(2.0, double(i) / 12.0);
+				return 1.0 - 2.0 * Atan(1.0 / ratio) / (2.0 * kPi);
+			});
+		}
+
+	} // namespace lookup_tables
+
+	constexpr auto LUT_SINE_SIZE = 1281;
+	constexpr auto LUT_FM_FREQUENCY_QUANTIZER_SIZE = 129;
+	constexpr auto LUT_FOLD_SIZE = 516;
+	constexpr auto LUT_FOLD_2_SIZE = 516;
+	constexpr auto LUT_STIFFNESS_SIZE = 65;
+	constexpr auto LUT_SVF_SHIFT_SIZE = 257;
+
+	extern float const lut_sine[LUT_SINE_SIZE];
+	extern float const lut_fm_frequency_quantizer[LUT_FM_FREQUENCY_QUANTIZER_SIZE];
+	extern float const lut_fold[LUT_FOLD_SIZE];
+	extern float const lut_fold_2[LUT_FOLD_2_SIZE];
+	extern float const lut_stiffness[LUT_STIFFNESS_SIZE];
+	extern float const lut_svf_shift[LUT_SVF_SHIFT_SIZE];
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_LOOKUP_TABLES_H_
@@ -0,0 +1,317 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of random impulse trains processed by resonant filters.
+//
+// Same as a set of Particle, but instead of drawing a random number for each
+// particle at each sample, the time to the next impulse of each particle is
+// drawn when it fires. Only the particles with an impulse in the block are
+// visited, and the band-pass filters of all particles run as a bank of Svf,
+// one per lane, in a single loop.
+
+#ifndef PLAITS_DSP_NOISE_PARTICLE_BANK_H_
+#define PLAITS_DSP_NOISE_PARTICLE_BANK_H_
+
+#include <algorithm>
+#include <cmath>
+
+#include "stmlib/dsp/dsp.h"
+#include "stmlib/dsp/filter.h"
+#include "stmlib/dsp/units.h"
+
+#include <crack/audio/Random.h>
+
+namespace plaits
+{
+
+	int const kParticleBankStride = 8;
+	int const kParticleBankMaxNumParticles = 64;
+	int const kParticleBankMaxNumEvents = 2 * kParticleBankMaxNumParticles;
+
+	// Countdown of the inactive particles.
+	float const kParticleBankNever = 1e30f;
+
+	class ParticleBank
+	{
+	public:
+		ParticleBank() {
+		}
+		~ParticleBank() {
+		}
+
+		void Init(int num_particles) {
+			for (int i = 0; i < kParticleBankMaxNumParticles / kParticleBankStride; ++i) {
+				Block* b = &block_[i];
+				for (int j = 0; j < kParticleBankStride; ++j) {
+					b->g[j] = stmlib::OnePole::tan<stmlib::FREQUENCY_DIRTY>(0.01f);
+					b->r[j] = 1.0f / 100.0f;
+					b->h[j] = 1.0f / (1.0f + b->r[j] * b->g[j] + b->g[j] * b->g[j]);
+					b->state_1[j] = 0.0f;
+					b->state_2[j] = 0.0f;
+					b->in[j] = 0.0f;
+					b->pre_gain[j] = 0.0f;
+					b->countdown[j] = kParticleBankNever;
+				}
+			}
+			num_events_ = 0;
+			num_particles_ = 0;
+			density_ = 0.0f;
+			log_no_impulse_ = 0.0f;
+			set_num_particles(num_particles);
+		}
+
+		// Rounded up to a multiple of kParticleBankStride for processing.
+		// Particles beyond num_particles are kept silent.
+		inline void set_num_particles(int num_particles) {
+			CONSTRAIN(num_particles, 1, kParticleBankMaxNumParticles);
+			for (int i = num_particles_; i < num_particles; ++i) {
+				countdown(i) = density_ != 0.0f ? NextInterval() - 1.0f : 0.0f;
+			}
+			for (int i = num_particles; i < num_particles_; ++i) {
+				countdown(i) = kParticleBankNever;
+			}
+			num_particles_ = num_particles;
+			num_blocks_ = (num_particles + kParticleBankStride - 1) / kParticleBankStride;
+		}
+
+		inline int num_particles() const {
+			return num_particles_;
+		}
+
+		// Each particle fires with a probability density at each sample. The
+		// impulses have a random amplitude between 0 and 1 (1 when synced).
+		void Render(
+		    bool sync,
+		    float density,
+		    float frequency,
+		    float spread,
+		    float q,
+		    float* out,
+		    float* aux,
+		    size_t size
+		) {
+			SetDensity(density);
+			ScheduleEvents(sync, density, frequency, spread, q, size);
+
+			int e = 0;
+			for (size_t t = 0; t < size; ++t) {
+				int const first_event = e;
+				float impulses = 0.0f;
+				for (; e < num_events_ && events_[e].time == static_cast<int32_t>(t); ++e) {
+					int const i = events_[e].particle;
+					Block* b = &block_[i / kParticleBankStride];
+					b->in[i % kParticleBankStride] = b->pre_gain[i % kParticleBankStride] * events_[e].amplitude;
+					impulses += events_[e].amplitude;
+				}
+
+				float sum[kParticleBankStride] = { 0.0f };
+				for (int i = 0; i < num_blocks_; ++i) {
+					Block* b = &block_[i];
+					for (int j = 0; j < kParticleBankStride; ++j) {
+						float const g = b->g[j];
+						float const hp = (b->in[j] - b->r[j] * b->state_1[j] - g * b->state_1[j] - b->state_2[j]) * b->h[j];
+						float const bp = g * hp + b->state_1[j];
+						float const lp = g * bp + b->state_2[j];
+						b->state_1[j] = g * hp + bp;
+						b->state_2[j] = g * bp + lp;
+						sum[j] += bp;
+					}
+				}
+				float total = 0.0f;
+				for (int j = 0; j < kParticleBankStride; ++j) {
+					total += sum[j];
+				}
+				out[t] += total;
+				aux[t] += impulses;
+
+				for (int k = first_event; k < e; ++k) {
+					int const i = events_[k].particle;
+					block_[i / kParticleBankStride].in[i % kParticleBankStride] = 0.0f;
+				}
+			}
+
+			// Ringing filters would otherwise decay into denormals.
+			for (int i = 0; i < num_blocks_; ++i) {
+				Block* b = &block_[i];
+				for (int j = 0; j < kParticleBankStride; ++j) {
+					float const s1 = b->state_1[j];
+					float const s2 = b->state_2[j];
+					b->state_1[j] = fabsf(s1) < 1e-10f ? 0.0f : s1;
+					b->state_2[j] = fabsf(s2) < 1e-10f ? 0.0f : s2;
+					b->countdown[j] -= static_cast<float>(size);
+				}
+			}
+		}
+
+	private:
+		struct Block
+		{
+			// Svf coefficients and state.
+			float g[kParticleBankStride];
+			float r[kParticleBankStride];
+			float h[kParticleBankStride];
+			float state_1[kParticleBankStride];
+			float state_2[kParticleBankStride];
+
+			// Impulse fed to the filter at the current sample.
+			float in[kParticleBankStride];
+			float pre_gain[kParticleBankStride];
+
+			// Number of samples until the next impulse.
+			float countdown[kParticleBankStride];
+		};
+
+		struct Event
+		{
+			int32_t time;
+			int32_t particle;
+			float amplitude;
+		};
+
+		// The number of samples without impulse before the next one follows a
+		// geometric distribution. When the density changes, the pending
+		// countdowns are rescaled so that particles respond immediately.
+		inline void SetDensity(float density) {
+			if (density == density_) {
+				return;
+			}
+			float const log_no_impulse = logf(1.0f - std::min(density, 0.5f));
+			float const ratio = log_no_impulse_ / log_no_impulse;
+			bool const first = density_ == 0.0f;
+			density_ = density;
+			log_no_impulse_ = log_no_impulse;
+			if (first) {
+				for (int i = 0; i < num_particles_; ++i) {
+					countdown(i) = NextInterval() - 1.0f;
+				}
+				return;
+			}
+			for (int i = 0; i < num_blocks_; ++i) {
+				for (int j = 0; j < kParticleBankStride; ++j) {
+					block_[i].countdown[j] *= ratio;
+				}
+			}
+		}
+
+		inline float& countdown(int i) {
+			return block_[i / kParticleBankStride].countdown[i % kParticleBankStride];
+		}
+
+		inline float NextInterval() {
+			float const u = std::max(this->rng.get(0.0f, 1.0f), 1e-20f);
+			return 1.0f + std::min(floorf(logf(u) / log_no_impulse_), 1e7f);
+		}
+
+		// Lists the impulses of this block, sorted by time. The filter of a
+		// particle firing in this block is retuned to a random frequency, once
+		// for the whole block.
+		void ScheduleEvents(
+		    bool sync,
+		    float density,
+		    float frequency,
+		    float spread,
+		    float q,
+		    size_t size
+		) {
+			float const block_end = static_cast<float>(size);
+			num_events_ = 0;
+
+			if (sync) {
+				// The parked particles beyond num_particles_ stay silent.
+				for (int i = 0; i < num_particles_; ++i) {
+					countdown(i) = 0.0f;
+				}
+			}
+			else {
+				float earliest = block_end;
+				for (int i = 0; i < num_blocks_; ++i) {
+					for (int j = 0; j < kParticleBankStride; ++j) {
+						earliest = std::min(earliest, block_[i].countdown[j]);
+					}
+				}
+				if (earliest >= block_end) {
+					return;
+				}
+			}
+
+			float const density_sqrt = stmlib::Sqrt(density);
+			for (int i = 0; i < num_particles_; ++i) {
+				Block* b = &block_[i / kParticleBankStride];
+				int const j = i % kParticleBankStride;
+				float countdown = b->countdown[j];
+				if (countdown >= block_end) {
+					continue;
+				}
+
+				float const u = this->rng.get(-1.0f, 1.0f);
+				float const f = std::min(
+				    stmlib::SemitonesToRatio(spread * u) * frequency,
+				    0.25f
+				);
+				b->pre_gain[j] = 0.5f / stmlib::Sqrt(q * f * density_sqrt);
+				b->g[j] = stmlib::OnePole::tan<stmlib::FREQUENCY_DIRTY>(f);
+				b->r[j] = 1.0f / q;
+				b->h[j] = 1.0f / (1.0f + b->r[j] * b->g[j] + b->g[j] * b->g[j]);
+
+				bool synced = sync;
+				while (countdown < block_end) {
+					if (num_events_ < kParticleBankMaxNumEvents) {
+						Event* e = &events_[num_events_++];
+						e->time = static_cast<int32_t>(countdown);
+						e->particle = i;
+						e->amplitude = synced ? 1.0f : this->rng.get(0.0f, 1.0f);
+					}
+					synced = false;
+					countdown += NextInterval();
+				}
+				b->countdown[j] = countdown;
+			}
+
+			for (int k = 1; k < num_events_; ++k) {
+				Event const e = events_[k];
+				int l = k;
+				for (; l > 0 && events_[l - 1].time > e.time; --l) {
+					events_[l] = events_[l - 1];
+				}
+				events_[l] = e;
+			}
+		}
+
+		Block block_[kParticleBankMaxNumParticles / kParticleBankStride];
+		Event events_[kParticleBankMaxNumEvents];
+		int num_events_;
+		int num_particles_;
+		int num_blocks_;
+
+		float density_;
+		float log_no_impulse_;
+
+		crack::audio::RNG rng{};
+
+		DISALLOW_COPY_AND_ASSIGN(ParticleBank);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_NOISE_PARTICLE_BANK_H_
@@ -0,0 +1,226 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of sine oscillators tuned to the harmonics of a fundamental. Each
+// partial is a complex phasor rotated once per sample. The rotations are
+// recomputed once per block, when new amplitudes are given, and the amplitudes
+// are linearly ramped over the block. Partials above Nyquist are faded out,
+// then no longer rendered.
+//
+// The state is stored as blocks of 8 partials, each block a structure of
+// arrays, and the partials of a block are summed in 8 separate accumulators,
+// so that the loops can be vectorized without reordering the floating point
+// additions.
+
+#ifndef PLAITS_DSP_OSCILLATOR_SINE_BANK_OSCILLATOR_H_
+#define PLAITS_DSP_OSCILLATOR_SINE_BANK_OSCILLATOR_H_
+
+#include <algorithm>
+
+#include "stmlib/dsp/dsp.h"
+#include "stmlib/utils/buffer_allocator.h"
+#include "stmlib/utils/snapshot.h"
+
+namespace plaits
+{
+
+	int const kSineBankStride = 8;
+
+	class SineBankOscillator
+	{
+	public:
+		SineBankOscillator() {
+		}
+		~SineBankOscillator() {
+		}
+
+		// State of kSineBankStride consecutive partials. Keeping the arrays of a
+		// block together (rather than in separate buffers) lets the compiler see
+		// that they do not overlap.
+		struct Block
+		{
+			float re[kSineBankStride];
+			float im[kSineBankStride];
+			float rotation_re[kSineBankStride];
+			float rotation_im[kSineBankStride];
+			float amplitude[kSineBankStride];
+			float amplitude_increment[kSineBankStride];
+		};
+
+		// Allocates the state of up to max_num_partials partials, fewer if the
+		// allocator runs out of memory.
+		void Init(stmlib::BufferAllocator* allocator, int max_num_partials) {
+			int const num_blocks_fit = static_cast<int>(
+			    allocator->free(stmlib::kVectorAlignment) / sizeof(Block)
+			);
+			num_blocks_ = std::min(max_num_partials / kSineBankStride, num_blocks_fit);
+			block_ = allocator->Allocate<Block>(num_blocks_, stmlib::kVectorAlignment);
+		}
+
+		void ListPointers(stmlib::SnapshotPointers* pointers) const {
+			pointers->Add(&block_);
+		}
+
+		// The memory can be shared with other engines, so the state is
+		// reinitialized when the engine is selected.
+		void Reset() {
+			int const n = max_num_partials();
+			for (int i = 0; i < n; ++i) {
+				Block* b = &block_[i / kSineBankStride];
+				int const j = i % kSineBankStride;
+
+				// Schroeder phases, to avoid the large peaks of a sum of harmonics
+				// which all start in phase.
+				float const k = static_cast<float>(i);
+				float const phase = 0.5f * k * k / static_cast<float>(n);
+				b->re[j] = stmlib::SinePolynomial(phase + 0.25f);
+				b->im[j] = stmlib::SinePolynomial(phase);
+				b->rotation_re[j] = 1.0f;
+				b->rotation_im[j] = 0.0f;
+				b->amplitude[j] = 0.0f;
+				b->amplitude_increment[j] = 0.0f;
+			}
+			num_rendered_blocks_ = 0;
+			num_next_rendered_blocks_ = 0;
+			ramp_remaining_ = 0;
+		}
+
+		inline int max_num_partials() const {
+			return num_blocks_ * kSineBankStride;
+		}
+
+		// Number of harmonics of frequency below Nyquist.
+		static inline int NumAudiblePartials(float frequency, int max_num_partials) {
+			if (frequency <= 0.0f) {
+				return max_num_partials;
+			}
+			float const n = 0.5f / frequency;
+			return n >= static_cast<float>(max_num_partials)
+			           ? max_num_partials
+			           : static_cast<int>(n);
+		}
+
+		// Sets the frequency of the fundamental, and the amplitudes reached
+		// by the num_partials first harmonics at the end of the next size samples.
+		void Update(
+		    float frequency,
+		    float const* amplitudes,
+		    int num_partials,
+		    size_t size
+		) {
+			num_partials = std::min(num_partials, max_num_partials());
+			int const num_audible = NumAudiblePartials(frequency, num_partials);
+			int const num_audible_blocks = (num_audible + kSineBankStride - 1) / kSineBankStride;
+			int const num_blocks = std::max(num_audible_blocks, num_rendered_blocks_);
+			float const ramp = 1.0f / static_cast<float>(std::max(size, size_t(1)));
+
+			for (int i = 0; i < num_blocks; ++i) {
+				Block* b = &block_[i];
+				for (int j = 0; j < kSineBankStride; ++j) {
+					int const k = i * kSineBankStride + j;
+					float const f = frequency * static_cast<float>(k + 1);
+
+					// Fade out the partials approaching Nyquist.
+					float const fade = std::max(1.0f - 2.0f * f, 0.0f);
+					float const target = k < num_partials ? amplitudes[k] * fade : 0.0f;
+
+					// The rounding errors left by the ramps would otherwise decay
+					// into denormals.
+					float const amplitude = fabsf(b->amplitude[j]) < 1e-10f
+					                            ? 0.0f
+					                            : b->amplitude[j];
+					b->amplitude[j] = amplitude;
+					b->amplitude_increment[j] = (target - amplitude) * ramp;
+
+					// Silent partials above Nyquist keep a valid rotation.
+					float const phase = std::min(f, 0.5f);
+					b->rotation_re[j] = stmlib::SinePolynomial(phase + 0.25f);
+					b->rotation_im[j] = stmlib::SinePolynomial(phase);
+
+					// Rotations accumulate rounding errors on the magnitude of the
+					// phasor. One Newton iteration per block brings it back to 1.
+					float const norm = b->re[j] * b->re[j] + b->im[j] * b->im[j];
+					float const g = 1.5f - 0.5f * norm;
+					b->re[j] *= g;
+					b->im[j] *= g;
+				}
+			}
+			// Partials which are now silent are no longer rendered after this ramp.
+			num_rendered_blocks_ = num_blocks;
+			num_next_rendered_blocks_ = num_audible_blocks;
+			ramp_remaining_ = size;
+		}
+
+		// Renders all partials to out, and only the odd harmonics to odd.
+		void Render(float* out, float* odd, size_t size) {
+			while (size--) {
+				if (ramp_remaining_) {
+					--ramp_remaining_;
+					Step<true>(out++, odd++);
+					if (!ramp_remaining_) {
+						num_rendered_blocks_ = num_next_rendered_blocks_;
+					}
+				}
+				else {
+					Step<false>(out++, odd++);
+				}
+			}
+		}
+
+	private:
+		template<bool ramp>
+		inline void Step(float* out, float* odd) {
+			float sum[kSineBankStride] = { 0.0f };
+			for (int i = 0; i < num_rendered_blocks_; ++i) {
+				Block* b = &block_[i];
+				for (int j = 0; j < kSineBankStride; ++j) {
+					float const re = b->re[j] * b->rotation_re[j] - b->im[j] * b->rotation_im[j];
+					float const im = b->re[j] * b->rotation_im[j] + b->im[j] * b->rotation_re[j];
+					b->re[j] = re;
+					b->im[j] = im;
+					if (ramp) {
+						b->amplitude[j] += b->amplitude_increment[j];
+					}
+					sum[j] += b->amplitude[j] * im;
+				}
+			}
+			// Partial k + 1 is odd when k is even.
+			float const odd_sum = (sum[0] + sum[2]) + (sum[4] + sum[6]);
+			float const even_sum = (sum[1] + sum[3]) + (sum[5] + sum[7]);
+			*out = odd_sum + even_sum;
+			*odd = odd_sum;
+		}
+
+		Block* block_;
+		int num_blocks_;
+		int num_rendered_blocks_;
+		int num_next_rendered_blocks_;
+		size_t ramp_remaining_;
+
+		DISALLOW_COPY_AND_ASSIGN(SineBankOscillator);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_OSCILLATOR_SINE_BANK_OSCILLATOR_H_
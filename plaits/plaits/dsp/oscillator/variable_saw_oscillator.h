@@ -61,6 +61,7 @@ namespace plaits
 			waveshape_ = 0.0f;
 		}
 
+		template<typename math = stmlib::DefaultMath>
 		void Render(
 		    float frequency,
 		    float pw,
@@ -68,7 +69,6 @@ namespace plaits
 		    float* out,
 		    size_t size
 		) {
-			using math = crack::audio::StdContext;
 			pw = math::clamp(pw, frequency * 2.0f, 1.0f - 2.0f * frequency);
 
 			float next_sample = next_sample_;
@@ -121,6 +121,9 @@ namespace plaits
 		}
 
 	private:
+		template<int num_lanes>
+		friend class VariableSawOscillatorLanes;
+
 		inline float ComputeNaiveSample(
 		    float phase,
 		    float pw,
@@ -0,0 +1,139 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// VariableSawOscillator running num_lanes independent voices side by side,
+// see VariableShapeOscillatorLanes.
+
+#ifndef PLAITS_DSP_OSCILLATOR_VARIABLE_SAW_OSCILLATOR_LANES_H_
+#define PLAITS_DSP_OSCILLATOR_VARIABLE_SAW_OSCILLATOR_LANES_H_
+
+#include "stmlib/dsp/dsp.h"
+#include "stmlib/dsp/polyblep.h"
+
+#include "plaits/dsp/oscillator/variable_saw_oscillator.h"
+
+namespace plaits
+{
+
+	template<int num_lanes>
+	class VariableSawOscillatorLanes
+	{
+	public:
+		VariableSawOscillatorLanes() {
+		}
+		~VariableSawOscillatorLanes() {
+		}
+
+		void Load(int lane, VariableSawOscillator const& o) {
+			phase_[lane] = o.phase_;
+			next_sample_[lane] = o.next_sample_;
+			previous_pw_[lane] = o.previous_pw_;
+			high_[lane] = o.high_ ? 1.0f : 0.0f;
+		}
+
+		void Store(int lane, VariableSawOscillator* o) const {
+			o->phase_ = phase_[lane];
+			o->next_sample_ = next_sample_[lane];
+			o->previous_pw_ = previous_pw_[lane];
+			o->high_ = high_[lane] != 0.0f;
+		}
+
+		// Renders one sample per lane.
+		template<typename math = stmlib::DefaultMath>
+		void Render(
+		    float const* frequency,
+		    float const* pw_in,
+		    float const* waveshape,
+		    float* out
+		) {
+			using namespace stmlib;
+
+			for (int i = 0; i < num_lanes; ++i) {
+				float const f = frequency[i];
+				float const pw = math::clamp(pw_in[i], f * 2.0f, 1.0f - 2.0f * f);
+
+				float s = next_sample_[i];
+				float n = 0.0f;
+
+				float const triangle_amount = waveshape[i];
+				float const notch_amount = 1.0f - waveshape[i];
+				float const slope_up = 1.0f / (pw);
+				float const slope_down = 1.0f / (1.0f - pw);
+				float const triangle_step = (slope_up + slope_down) * f * triangle_amount;
+
+				float phase = phase_[i] + f;
+				bool const high = high_[i] != 0.0f;
+
+				bool const rise = !high & (phase >= pw);
+				float const rise_notch = (kVariableSawNotchDepth + 1.0f - pw) * notch_amount;
+				float const t_rise = (phase - pw) / (previous_pw_[i] - pw + f);
+				float const this_rise = rise_notch * ThisBlepSample(t_rise);
+				float const next_rise = rise_notch * NextBlepSample(t_rise);
+				float const this_rise_slope = triangle_step * ThisIntegratedBlepSample(t_rise);
+				float const next_rise_slope = triangle_step * NextIntegratedBlepSample(t_rise);
+				s += rise ? this_rise : 0.0f;
+				n += rise ? next_rise : 0.0f;
+				s -= rise ? this_rise_slope : 0.0f;
+				n -= rise ? next_rise_slope : 0.0f;
+
+				bool const fall = !rise & (phase >= 1.0f);
+				phase = fall ? phase - 1.0f : phase;
+				float const fall_notch = (kVariableSawNotchDepth + 1.0f) * notch_amount;
+				float const t_fall = phase / f;
+				float const this_fall = fall_notch * ThisBlepSample(t_fall);
+				float const next_fall = fall_notch * NextBlepSample(t_fall);
+				float const this_fall_slope = triangle_step * ThisIntegratedBlepSample(t_fall);
+				float const next_fall_slope = triangle_step * NextIntegratedBlepSample(t_fall);
+				s -= fall ? this_fall : 0.0f;
+				n -= fall ? next_fall : 0.0f;
+				s += fall ? this_fall_slope : 0.0f;
+				n += fall ? next_fall_slope : 0.0f;
+
+				float const notch_saw = phase < pw ? phase : 1.0f + kVariableSawNotchDepth;
+				float const triangle = phase < pw
+				                           ? phase * slope_up
+				                           : 1.0f - (phase - pw) * slope_down;
+				n += notch_saw * notch_amount + triangle * triangle_amount;
+
+				phase_[i] = phase;
+				high_[i] = rise ? 1.0f : (fall ? 0.0f : high_[i]);
+				previous_pw_[i] = pw;
+				out[i] = (2.0f * s - 1.0f) / (1.0f + kVariableSawNotchDepth);
+				next_sample_[i] = n;
+			}
+		}
+
+	private:
+		// Oscillator state, one entry per lane.
+		float phase_[num_lanes];
+		float next_sample_[num_lanes];
+		float previous_pw_[num_lanes];
+		float high_[num_lanes];
+
+		DISALLOW_COPY_AND_ASSIGN(VariableSawOscillatorLanes);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_OSCILLATOR_VARIABLE_SAW_OSCILLATOR_LANES_H_
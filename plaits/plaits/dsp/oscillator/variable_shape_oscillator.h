@@ -61,7 +61,32 @@ namespace plaits
 			waveshape_ = 0.0f;
 		}
 
-		template<bool enable_sync>
+		// Phase of the master oscillator, for oscillators synced to the same
+		// master.
+		inline float master_phase() const {
+			return master_phase_;
+		}
+
+		// Picks up the master phase for an oscillator which was not rendered
+		// for a while. The slave phase is put back where the hard sync would
+		// have left it, assuming that both frequencies did not change since
+		// the last reset of the master.
+		template<typename math = stmlib::DefaultMath>
+		inline void set_master_phase(
+		    float master_phase,
+		    float master_frequency,
+		    float slave_frequency,
+		    float pw
+		) {
+			pw = math::clamp(pw, slave_frequency * 2.0f, 1.0f - 2.0f * slave_frequency);
+			master_phase_ = master_phase;
+			float const slave_phase = master_phase / master_frequency * slave_frequency;
+			slave_phase_ = slave_phase - static_cast<float>(static_cast<int32_t>(slave_phase));
+			high_ = slave_phase_ >= pw;
+			previous_pw_ = pw;
+		}
+
+		template<bool enable_sync, typename math = stmlib::DefaultMath>
 		void Render(
 		    float master_frequency,
 		    float slave_frequency,
@@ -70,7 +95,6 @@ namespace plaits
 		    float* out,
 		    size_t size
 		) {
-			using math = crack::audio::StdContext;
 			pw = math::clamp(pw, slave_frequency * 2.0f, 1.0f - 2.0f * slave_frequency);
 
 			float next_sample = next_sample_;
@@ -171,6 +195,9 @@ namespace plaits
 		}
 
 	private:
+		template<int num_lanes>
+		friend class VariableShapeOscillatorLanes;
+
 		inline float ComputeNaiveSample(
 		    float phase,
 		    float pw,
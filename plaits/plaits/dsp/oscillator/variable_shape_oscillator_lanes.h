@@ -0,0 +1,294 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// VariableShapeOscillator running num_lanes independent voices side by side.
+// The state is stored as structure of arrays and every sample is rendered by
+// loops over the lanes, with the per-lane PolyBLEP discontinuities handled
+// with selects rather than branches, so that the loops can be vectorized.
+// Renders the same samples as num_lanes scalar oscillators, up to the
+// rounding differences introduced by the compiler when contracting a*b+c.
+
+#ifndef PLAITS_DSP_OSCILLATOR_VARIABLE_SHAPE_OSCILLATOR_LANES_H_
+#define PLAITS_DSP_OSCILLATOR_VARIABLE_SHAPE_OSCILLATOR_LANES_H_
+
+#include "stmlib/dsp/dsp.h"
+#include "stmlib/dsp/polyblep.h"
+
+#include <algorithm>
+
+#include "plaits/dsp/oscillator/variable_shape_oscillator.h"
+
+namespace plaits
+{
+
+	template<int num_lanes>
+	class VariableShapeOscillatorLanes
+	{
+	public:
+		VariableShapeOscillatorLanes() {
+		}
+		~VariableShapeOscillatorLanes() {
+		}
+
+		void Load(int lane, VariableShapeOscillator const& o) {
+			master_phase_[lane] = o.master_phase_;
+			slave_phase_[lane] = o.slave_phase_;
+			next_sample_[lane] = o.next_sample_;
+			previous_pw_[lane] = o.previous_pw_;
+			high_[lane] = o.high_ ? 1.0f : 0.0f;
+		}
+
+		void Store(int lane, VariableShapeOscillator* o) const {
+			o->master_phase_ = master_phase_[lane];
+			o->slave_phase_ = slave_phase_[lane];
+			o->next_sample_ = next_sample_[lane];
+			o->previous_pw_ = previous_pw_[lane];
+			o->high_ = high_[lane] != 0.0f;
+		}
+
+		// Renders one sample per lane.
+		template<bool enable_sync, typename math = stmlib::DefaultMath>
+		void Render(
+		    float const* master_frequency,
+		    float const* slave_frequency,
+		    float const* pw_in,
+		    float const* waveshape,
+		    float* out
+		) {
+			using namespace stmlib;
+
+			float this_sample[num_lanes];
+			float next_sample[num_lanes];
+			float pw[num_lanes];
+			float slope_up[num_lanes];
+			float slope_down[num_lanes];
+			float triangle_amount[num_lanes];
+			float square_amount[num_lanes];
+			float reset_time[num_lanes];
+			float reset[num_lanes];
+			float reset_slave[num_lanes];
+
+			// Sync, then at most one rising edge followed by one reset of the
+			// slave oscillator.
+			for (int i = 0; i < num_lanes; ++i) {
+				float const f = slave_frequency[i];
+				pw[i] = math::clamp(pw_in[i], f * 2.0f, 1.0f - 2.0f * f);
+				square_amount[i] = std::max(waveshape[i] - 0.5f, 0.0f) * 2.0f;
+				triangle_amount[i] = std::max(1.0f - waveshape[i] * 2.0f, 0.0f);
+				slope_up[i] = 1.0f / (pw[i]);
+				slope_down[i] = 1.0f / (1.0f - pw[i]);
+
+				float s = next_sample_[i];
+				float n = 0.0f;
+				bool high = high_[i] != 0.0f;
+				bool run = true;
+				reset[i] = 0.0f;
+				reset_time[i] = 0.0f;
+
+				if constexpr (enable_sync) {
+					float master_phase = master_phase_[i] + master_frequency[i];
+					bool const r = master_phase >= 1.0f;
+					master_phase = r ? master_phase - 1.0f : master_phase;
+					float const t = master_phase / master_frequency[i];
+
+					float phase_at_reset = slave_phase_[i] + (1.0f - t) * f;
+					bool const wrap = phase_at_reset >= 1.0f;
+					phase_at_reset = wrap ? phase_at_reset - 1.0f : phase_at_reset;
+					bool const transition = wrap | (!high & (phase_at_reset >= pw[i]));
+
+					float const value = ComputeNaiveSample(
+					    phase_at_reset,
+					    pw[i],
+					    slope_up[i],
+					    slope_down[i],
+					    triangle_amount[i],
+					    square_amount[i]
+					);
+					float const this_blep = value * ThisBlepSample(t);
+					float const next_blep = value * NextBlepSample(t);
+					s -= r ? this_blep : 0.0f;
+					n -= r ? next_blep : 0.0f;
+
+					master_phase_[i] = master_phase;
+					reset[i] = r ? 1.0f : 0.0f;
+					reset_time[i] = r ? t : 0.0f;
+					run = !r | transition;
+				}
+
+				// The corrections are computed for all lanes, and only added to the
+				// lanes which have a discontinuity.
+				float phase = slave_phase_[i] + f;
+				float const triangle_step = (slope_up[i] + slope_down[i]) * f * triangle_amount[i];
+
+				bool const rise = run & !high & (phase >= pw[i]);
+				float const t_rise = (phase - pw[i]) / (previous_pw_[i] - pw[i] + f);
+				float const this_rise = square_amount[i] * ThisBlepSample(t_rise);
+				float const next_rise = square_amount[i] * NextBlepSample(t_rise);
+				float const this_rise_slope = triangle_step * ThisIntegratedBlepSample(t_rise);
+				float const next_rise_slope = triangle_step * NextIntegratedBlepSample(t_rise);
+				s += rise ? this_rise : 0.0f;
+				n += rise ? next_rise : 0.0f;
+				s -= rise ? this_rise_slope : 0.0f;
+				n -= rise ? next_rise_slope : 0.0f;
+				high = high | rise;
+
+				bool const fall = run & high & (phase >= 1.0f);
+				phase = fall ? phase - 1.0f : phase;
+				float const t_fall = phase / f;
+				float const this_fall = (1.0f - triangle_amount[i]) * ThisBlepSample(t_fall);
+				float const next_fall = (1.0f - triangle_amount[i]) * NextBlepSample(t_fall);
+				float const this_fall_slope = triangle_step * ThisIntegratedBlepSample(t_fall);
+				float const next_fall_slope = triangle_step * NextIntegratedBlepSample(t_fall);
+				s -= fall ? this_fall : 0.0f;
+				n -= fall ? next_fall : 0.0f;
+				s += fall ? this_fall_slope : 0.0f;
+				n += fall ? next_fall_slope : 0.0f;
+				high = high & !fall;
+
+				this_sample[i] = s;
+				next_sample[i] = n;
+				slave_phase_[i] = phase;
+				high_[i] = high ? 1.0f : 0.0f;
+				reset_slave[i] = fall ? 1.0f : 0.0f;
+			}
+
+			// Another rising edge after the reset of the slave only happens when its
+			// frequency is close to or above Nyquist: finish these lanes one by one.
+			for (int i = 0; i < num_lanes; ++i) {
+				if (reset_slave[i] != 0.0f && slave_phase_[i] >= pw[i]) {
+					ContinueTransitions(
+					    i,
+					    slave_frequency[i],
+					    pw[i],
+					    slope_up[i],
+					    slope_down[i],
+					    triangle_amount[i],
+					    square_amount[i],
+					    &this_sample[i],
+					    &next_sample[i]
+					);
+				}
+			}
+
+			for (int i = 0; i < num_lanes; ++i) {
+				float phase = slave_phase_[i];
+				float high = high_[i];
+				if constexpr (enable_sync) {
+					bool const r = reset[i] != 0.0f;
+					phase = r ? reset_time[i] * slave_frequency[i] : phase;
+					high = r ? 0.0f : high;
+				}
+				float const n = next_sample[i] + ComputeNaiveSample(
+				    phase,
+				    pw[i],
+				    slope_up[i],
+				    slope_down[i],
+				    triangle_amount[i],
+				    square_amount[i]
+				);
+				slave_phase_[i] = phase;
+				high_[i] = high;
+				previous_pw_[i] = pw[i];
+				out[i] = 2.0f * this_sample[i] - 1.0f;
+				next_sample_[i] = n;
+			}
+		}
+
+	private:
+		static inline float ComputeNaiveSample(
+		    float phase,
+		    float pw,
+		    float slope_up,
+		    float slope_down,
+		    float triangle_amount,
+		    float square_amount
+		) {
+			float saw = phase;
+			float square = phase < pw ? 0.0f : 1.0f;
+			float triangle = phase < pw
+			                     ? phase * slope_up
+			                     : 1.0f - (phase - pw) * slope_down;
+			saw += (square - saw) * square_amount;
+			saw += (triangle - saw) * triangle_amount;
+			return saw;
+		}
+
+		// Same loop as in VariableShapeOscillator::Render(), resumed on a lane
+		// which is low after a reset of the slave oscillator.
+		void ContinueTransitions(
+		    int i,
+		    float slave_frequency,
+		    float pw,
+		    float slope_up,
+		    float slope_down,
+		    float triangle_amount,
+		    float square_amount,
+		    float* this_sample,
+		    float* next_sample
+		) {
+			float& phase = slave_phase_[i];
+			bool high = false;
+			float const triangle_step = (slope_up + slope_down) * slave_frequency * triangle_amount;
+			while (true) {
+				if (!high) {
+					if (phase < pw) {
+						break;
+					}
+					float t = (phase - pw) / (previous_pw_[i] - pw + slave_frequency);
+					*this_sample += square_amount * stmlib::ThisBlepSample(t);
+					*next_sample += square_amount * stmlib::NextBlepSample(t);
+					*this_sample -= triangle_step * stmlib::ThisIntegratedBlepSample(t);
+					*next_sample -= triangle_step * stmlib::NextIntegratedBlepSample(t);
+					high = true;
+				}
+
+				if (high) {
+					if (phase < 1.0f) {
+						break;
+					}
+					phase -= 1.0f;
+					float t = phase / slave_frequency;
+					*this_sample -= (1.0f - triangle_amount) * stmlib::ThisBlepSample(t);
+					*next_sample -= (1.0f - triangle_amount) * stmlib::NextBlepSample(t);
+					*this_sample += triangle_step * stmlib::ThisIntegratedBlepSample(t);
+					*next_sample += triangle_step * stmlib::NextIntegratedBlepSample(t);
+					high = false;
+				}
+			}
+			high_[i] = high ? 1.0f : 0.0f;
+		}
+
+		// Oscillator state, one entry per lane.
+		float master_phase_[num_lanes];
+		float slave_phase_[num_lanes];
+		float next_sample_[num_lanes];
+		float previous_pw_[num_lanes];
+		float high_[num_lanes];
+
+		DISALLOW_COPY_AND_ASSIGN(VariableShapeOscillatorLanes);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_OSCILLATOR_VARIABLE_SHAPE_OSCILLATOR_LANES_H_
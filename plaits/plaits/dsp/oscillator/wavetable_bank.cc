@@ -0,0 +1,204 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Wavetable bank loaded at runtime from a file.
+
+#include "plaits/dsp/oscillator/wavetable_bank.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "stmlib/utils/crc32.h"
+
+namespace plaits
+{
+
+	using namespace std;
+
+	bool WavetableBank::Open(char const* path) {
+		Close();
+
+#ifndef _WIN32
+		int fd = open(path, O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+		struct stat st;
+		if (fstat(fd, &st) != 0 || st.st_size < off_t(sizeof(WavetableBankHeader))) {
+			close(fd);
+			return false;
+		}
+		size_t const size = size_t(st.st_size);
+		void* mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (mapping == MAP_FAILED) {
+			return false;
+		}
+		mapping_ = mapping;
+		mapping_size_ = size;
+		uint8_t const* data = static_cast<uint8_t const*>(mapping_);
+#else
+		FILE* fp = fopen(path, "rb");
+		if (!fp) {
+			return false;
+		}
+		fseek(fp, 0, SEEK_END);
+		long const length = ftell(fp);
+		fseek(fp, 0, SEEK_SET);
+		if (length < long(sizeof(WavetableBankHeader))) {
+			fclose(fp);
+			return false;
+		}
+		size_t const size = size_t(length);
+		contents_.resize(size);
+		bool const read = fread(&contents_[0], 1, size, fp) == size;
+		fclose(fp);
+		if (!read) {
+			contents_.clear();
+			return false;
+		}
+		uint8_t const* data = &contents_[0];
+#endif // _WIN32
+
+		if (!Load(data, size)) {
+			Close();
+			return false;
+		}
+
+		// Raw banks have been integrated into memory owned by the bank, the
+		// file contents are no longer needed.
+		if (!integrated_.empty()) {
+#ifndef _WIN32
+			munmap(mapping_, mapping_size_);
+			mapping_ = NULL;
+			mapping_size_ = 0;
+#else
+			contents_.clear();
+#endif // _WIN32
+		}
+		return true;
+	}
+
+	void WavetableBank::Close() {
+#ifndef _WIN32
+		if (mapping_) {
+			munmap(mapping_, mapping_size_);
+		}
+#endif // _WIN32
+		mapping_ = NULL;
+		mapping_size_ = 0;
+		contents_.clear();
+		integrated_.clear();
+		waves_ = NULL;
+		num_waves_ = 0;
+	}
+
+	bool WavetableBank::Load(uint8_t const* data, size_t size) {
+		WavetableBankHeader header;
+		memcpy(&header, data, sizeof(header));
+
+		if (header.magic != kMagic ||
+		    header.version != kVersion ||
+		    header.wave_size != kWaveSize ||
+		    header.num_waves == 0) {
+			return false;
+		}
+
+		size_t const samples_per_wave = header.format == WAVETABLE_BANK_FORMAT_RAW
+		    ? kWaveSize
+		    : kStride;
+		if (header.format != WAVETABLE_BANK_FORMAT_RAW &&
+		    header.format != WAVETABLE_BANK_FORMAT_INTEGRATED) {
+			return false;
+		}
+
+		uint8_t const* payload = data + sizeof(header);
+		size_t const payload_size = header.num_waves * samples_per_wave * sizeof(int16_t);
+		if (size - sizeof(header) != payload_size ||
+		    crc32(0, payload, payload_size) != header.crc) {
+			return false;
+		}
+
+		num_waves_ = header.num_waves;
+		int16_t const* samples = reinterpret_cast<int16_t const*>(payload);
+
+		if (header.format == WAVETABLE_BANK_FORMAT_INTEGRATED) {
+			waves_ = samples;
+		}
+		else {
+			// Same processing as in resources/wavetables.py: normalize, integrate
+			// two periods, and keep the last period plus the guard samples.
+			size_t const n = kWaveSize;
+			integrated_.resize(num_waves_ * kStride);
+			vector<double> x(2 * n);
+			for (size_t index = 0; index < num_waves_; ++index) {
+				int16_t const* wave = samples + index * n;
+
+				double mean = 0.0;
+				for (size_t i = 0; i < n; ++i) {
+					mean += wave[i];
+				}
+				mean /= double(n);
+
+				double peak = 0.0;
+				for (size_t i = 0; i < 2 * n; ++i) {
+					x[i] = wave[i % n] - mean;
+					peak = max(peak, fabs(x[i]));
+				}
+
+				double sum = 0.0;
+				mean = 0.0;
+				for (size_t i = 0; i < 2 * n; ++i) {
+					sum += peak > 0.0 ? x[i] / peak : 0.0;
+					x[i] = sum;
+					mean += sum;
+				}
+				mean /= double(2 * n);
+
+				int16_t* destination = &integrated_[index * kStride];
+				for (size_t i = 0; i < kStride; ++i) {
+					double s = (x[n - 4 + i] - mean) * (4.0 * 32768.0 / double(n));
+					s = floor(s + 0.5);
+					CONSTRAIN(s, -32768.0, 32767.0);
+					destination[i] = static_cast<int16_t>(s);
+				}
+			}
+			waves_ = &integrated_[0];
+		}
+
+#ifdef WAVETABLE_MIPMAPS
+		mipmaps_.Init(waves_, num_waves_);
+#endif // WAVETABLE_MIPMAPS
+		return true;
+	}
+
+} // namespace plaits
@@ -0,0 +1,130 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Wavetable bank loaded at runtime from a file.
+//
+// File layout (little endian):
+//
+//   WavetableBankHeader
+//   payload: num_waves * wave_size int16 samples (raw format), or
+//            num_waves * (wave_size + 4) int16 samples (integrated format,
+//            laid out like wav_integrated_waves).
+//
+// The header's crc field is the CRC32 of the payload. Integrated banks are
+// used in place from a read-only mapping of the file, so all the processes
+// using the same bank share one copy of it in the page cache. Raw banks are
+// integrated into memory owned by the bank when they are opened.
+
+#ifndef PLAITS_DSP_OSCILLATOR_WAVETABLE_BANK_H_
+#define PLAITS_DSP_OSCILLATOR_WAVETABLE_BANK_H_
+
+#include <vector>
+
+#include "stmlib/stmlib.h"
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/dsp/oscillator/wavetable_mipmaps.h"
+
+namespace plaits
+{
+
+	enum WavetableBankFormat
+	{
+		WAVETABLE_BANK_FORMAT_INTEGRATED,
+		WAVETABLE_BANK_FORMAT_RAW
+	};
+
+	struct WavetableBankHeader
+	{
+		uint32_t magic;
+		uint16_t version;
+		uint16_t format;
+		uint32_t num_waves;
+		uint32_t wave_size;
+		uint32_t crc;
+		uint32_t reserved;
+	};
+
+	class WavetableBank
+	{
+	public:
+		// "PWTB"
+		static uint32_t const kMagic = 0x42545750;
+		static uint16_t const kVersion = 1;
+		static size_t const kWaveSize = 256;
+		static size_t const kStride = kWaveSize + 4;
+
+		WavetableBank() : mapping_(NULL), mapping_size_(0), waves_(NULL), num_waves_(0) {
+		}
+		~WavetableBank() {
+			Close();
+		}
+
+		// Returns false if the file cannot be read, or is not a valid bank.
+		bool Open(char const* path);
+		void Close();
+
+		// Integrated wave, with its guard samples, that can be passed to a
+		// WavetableOscillator. Indices wrap around the number of waves.
+		inline int16_t const* wave(size_t index) const {
+			return waves_ + (index % num_waves_) * kStride;
+		}
+
+		inline size_t num_waves() const {
+			return num_waves_;
+		}
+
+		// True when the waves are read straight from the mapping of the file,
+		// without a copy: integrated banks, on POSIX systems.
+		inline bool mapped() const {
+			return mapping_ != NULL;
+		}
+
+#ifdef WAVETABLE_MIPMAPS
+		inline WavetableMipmaps const& mipmaps() const {
+			return mipmaps_;
+		}
+#endif // WAVETABLE_MIPMAPS
+
+	private:
+		bool Load(uint8_t const* data, size_t size);
+
+		void* mapping_;
+		size_t mapping_size_;
+		std::vector<uint8_t> contents_;
+		std::vector<int16_t> integrated_;
+
+		int16_t const* waves_;
+		size_t num_waves_;
+
+#ifdef WAVETABLE_MIPMAPS
+		WavetableMipmaps mipmaps_;
+#endif // WAVETABLE_MIPMAPS
+
+		DISALLOW_COPY_AND_ASSIGN(WavetableBank);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_OSCILLATOR_WAVETABLE_BANK_H_
@@ -0,0 +1,107 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Float, band-limited mip levels of the integrated wavetables.
+
+#include "plaits/dsp/oscillator/wavetable_mipmaps.h"
+
+#include <cmath>
+
+#include "plaits/resources.h"
+
+namespace plaits
+{
+
+	using namespace std;
+
+	void WavetableMipmaps::Init(int16_t const* integrated_waves, size_t num_waves) {
+		size_t const n = kTableSize;
+		size_t const num_harmonics = n / 2;
+
+		num_waves_ = num_waves;
+		data_.assign(num_waves * kNumLevels * kStride, 0.0f);
+
+		vector<double> cosine(n);
+		vector<double> sine(n);
+		for (size_t i = 0; i < n; ++i) {
+			double const t = 2.0 * M_PI * double(i) / double(n);
+			cosine[i] = cos(t);
+			sine[i] = sin(t);
+		}
+
+		vector<double> wave(n);
+		vector<double> re(num_harmonics + 1);
+		vector<double> im(num_harmonics + 1);
+
+		for (size_t index = 0; index < num_waves; ++index) {
+			// Undo the integration. The 512 scale factor is the one used by
+			// wavetables.py (4 * 32768 / 256).
+			int16_t const* integrated = integrated_waves + index * kStride;
+			for (size_t i = 0; i < n; ++i) {
+				wave[i] = double(integrated[i + 1] - integrated[i]) / 512.0;
+			}
+
+			// The DC component is dropped, as it was by the differentiator.
+			for (size_t h = 1; h <= num_harmonics; ++h) {
+				double a = 0.0;
+				double b = 0.0;
+				for (size_t i = 0; i < n; ++i) {
+					a += wave[i] * cosine[(h * i) % n];
+					b += wave[i] * sine[(h * i) % n];
+				}
+				double const scale = h == num_harmonics ? 1.0 : 2.0;
+				re[h] = a * scale / double(n);
+				im[h] = b * scale / double(n);
+			}
+
+			for (size_t level = 0; level < kNumLevels; ++level) {
+				size_t const highest_harmonic = num_harmonics >> level;
+				float* destination = &data_[(level * num_waves + index) * kStride];
+				for (size_t i = 0; i < n; ++i) {
+					double s = 0.0;
+					for (size_t h = 1; h <= highest_harmonic; ++h) {
+						s += re[h] * cosine[(h * i) % n] + im[h] * sine[(h * i) % n];
+					}
+					destination[i + 1] = static_cast<float>(s);
+				}
+				destination[0] = destination[n];
+				destination[n + 1] = destination[1];
+				destination[n + 2] = destination[2];
+				destination[n + 3] = destination[3];
+			}
+		}
+	}
+
+	/* static */
+	WavetableMipmaps const& WavetableMipmaps::Default() {
+		static WavetableMipmaps mipmaps;
+		static bool const initialized = (mipmaps.Init(
+		    wav_integrated_waves,
+		    WAV_INTEGRATED_WAVES_SIZE / kStride
+		), true);
+		(void)initialized;
+		return mipmaps;
+	}
+
+} // namespace plaits
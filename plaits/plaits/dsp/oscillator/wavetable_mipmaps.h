@@ -0,0 +1,110 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Float, band-limited mip levels of the integrated wavetables.
+//
+// The integrated int16 waves are differentiated back to the original waveform
+// once at startup, then resynthesized with one octave worth of harmonics less
+// at each level. At render time, the level is picked from the frequency, so
+// there is no need for the integrate/differentiate trick and its one-pole.
+
+#ifndef PLAITS_DSP_OSCILLATOR_WAVETABLE_MIPMAPS_H_
+#define PLAITS_DSP_OSCILLATOR_WAVETABLE_MIPMAPS_H_
+
+#include <vector>
+
+#include "stmlib/stmlib.h"
+
+namespace plaits
+{
+
+	class WavetableMipmaps
+	{
+	public:
+		static size_t const kTableSize = 256;
+		// One guard sample before, three after, for Hermite interpolation.
+		static size_t const kStride = kTableSize + 4;
+		static size_t const kNumLevels = 8;
+
+		WavetableMipmaps() : num_waves_(0) {
+		}
+		~WavetableMipmaps() {
+		}
+
+		// Builds the mip levels from num_waves integrated waves, laid out like
+		// wav_integrated_waves (kStride samples per wave, 512x scale).
+		void Init(int16_t const* integrated_waves, size_t num_waves);
+
+		// Shared cache of the 192 built-in waves, built on first use.
+		static WavetableMipmaps const& Default();
+
+		// Highest level that still has all the harmonics below Nyquist for a
+		// given frequency (in cycles per sample).
+		static inline size_t Level(float f0) {
+			size_t level = 0;
+			float f = f0 * float(kTableSize);
+			while (f > 1.0f && level < kNumLevels - 1) {
+				f *= 0.5f;
+				++level;
+			}
+			return level;
+		}
+
+		// The returned pointer can be passed directly to InterpolateWaveHermite.
+		inline float const* wave(size_t level, size_t index) const {
+			return &data_[(level * num_waves_ + index) * kStride];
+		}
+
+		inline size_t num_waves() const {
+			return num_waves_;
+		}
+
+	private:
+		size_t num_waves_;
+		std::vector<float> data_;
+
+		DISALLOW_COPY_AND_ASSIGN(WavetableMipmaps);
+	};
+
+	inline float InterpolateWaveHermite(
+	    float const* table,
+	    int32_t index_integral,
+	    float index_fractional
+	) {
+		float const xm1 = table[index_integral];
+		float const x0 = table[index_integral + 1];
+		float const x1 = table[index_integral + 2];
+		float const x2 = table[index_integral + 3];
+		float const c = (x1 - xm1) * 0.5f;
+		float const v = x0 - x1;
+		float const w = c + v;
+		float const a = w + v + (x2 - x0) * 0.5f;
+		float const b_neg = w + a;
+		float const f = index_fractional;
+		return (((a * f) - b_neg) * f + c) * f + x0;
+	}
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_OSCILLATOR_WAVETABLE_MIPMAPS_H_
@@ -31,12 +31,16 @@
 
 #include <algorithm>
 
+#include "stmlib/dsp/denormal.h"
 #include "stmlib/dsp/dsp.h"
+#include "stmlib/dsp/sample_storage.h"
+#include "stmlib/utils/snapshot.h"
 
 namespace plaits
 {
 
-	template<typename T, size_t max_delay>
+	// Samples are computed as T and stored as S, see stmlib/dsp/sample_storage.h.
+	template<typename T, size_t max_delay, typename S = T>
 	class DelayLine
 	{
 	public:
@@ -45,24 +49,32 @@ namespace plaits
 		~DelayLine() {
 		}
 
-		void Init(float* buffer) {
+		// buffer is NULL when the allocator ran out of RAM, in which case the
+		// delay line must not be used.
+		void Init(S* buffer) {
 			line_ = buffer;
 			Reset();
 		}
 
 		void Reset() {
-			std::fill(&line_[0], &line_[max_delay], T(0));
+			if (line_) {
+				std::fill(&line_[0], &line_[max_delay], Storage::Store(T(0)));
+			}
 			write_ptr_ = 0;
 		}
 
+		void ListPointers(stmlib::SnapshotPointers* pointers) const {
+			pointers->Add(&line_);
+		}
+
 		inline void Write(const T sample) {
-			line_[write_ptr_] = sample;
+			line_[write_ptr_] = Storage::Store(sample);
 			write_ptr_ = (write_ptr_ - 1 + max_delay) % max_delay;
 		}
 
 		inline const T Allpass(const T sample, size_t delay, const T coefficient) {
-			T read = line_[(write_ptr_ + delay) % max_delay];
-			T write = sample + coefficient * read;
+			T read = Load((write_ptr_ + delay) % max_delay);
+			T write = stmlib::FlushDenormal(sample + coefficient * read);
 			Write(write);
 			return -write * coefficient + read;
 		}
@@ -74,18 +86,18 @@ namespace plaits
 
 		inline const T Read(float delay) const {
 			MAKE_INTEGRAL_FRACTIONAL(delay)
-			const T a = line_[(write_ptr_ + delay_integral) % max_delay];
-			const T b = line_[(write_ptr_ + delay_integral + 1) % max_delay];
+			const T a = Load((write_ptr_ + delay_integral) % max_delay);
+			const T b = Load((write_ptr_ + delay_integral + 1) % max_delay);
 			return a + (b - a) * T(delay_fractional);
 		}
 
 		inline const T ReadHermite(float delay) const {
 			MAKE_INTEGRAL_FRACTIONAL(delay)
 			int32_t t = (write_ptr_ + delay_integral + max_delay);
-			const T xm1 = line_[(t - 1) % max_delay];
-			const T x0 = line_[(t) % max_delay];
-			const T x1 = line_[(t + 1) % max_delay];
-			const T x2 = line_[(t + 2) % max_delay];
+			const T xm1 = Load((t - 1) % max_delay);
+			const T x0 = Load((t) % max_delay);
+			const T x1 = Load((t + 1) % max_delay);
+			const T x2 = Load((t + 2) % max_delay);
 			const T c = (x1 - xm1) * 0.5f;
 			const T v = x0 - x1;
 			const T w = c + v;
@@ -96,8 +108,14 @@ namespace plaits
 		}
 
 	private:
+		typedef stmlib::SampleStorage<S> Storage;
+
+		inline const T Load(size_t index) const {
+			return Storage::Load(line_[index]);
+		}
+
 		size_t write_ptr_;
-		T* line_;
+		S* line_;
 
 		DISALLOW_COPY_AND_ASSIGN(DelayLine);
 	};
@@ -48,13 +48,14 @@ namespace plaits
 		CosineOscillator amplitudes;
 		amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(position);
 
-		for (int i = 0; i < resolution; ++i) {
-			mode_amplitude_[i] = amplitudes.Next() * 0.25f;
+		for (int i = 0; i < kMaxNumModes; ++i) {
+			// The modes above the resolution are muted.
+			mode_amplitude_[i] = i < resolution_ ? amplitudes.Next() * 0.25f : 0.0f;
 		}
 
-		for (int i = 0; i < kMaxNumModes / kModeBatchSize; ++i) {
-			mode_filters_[i].Init();
-		}
+		// The modes above the resolution are not rendered.
+		mode_filters_.Init(resolution_);
+		coefficients_.Init();
 	}
 
 	inline float NthHarmonicCompensation(int n, float stiffness) {
@@ -79,6 +80,19 @@ namespace plaits
 	    float const* in,
 	    float* out,
 	    size_t size
+	) {
+		float const parameters[] = { f0, structure, brightness, damping };
+		if (coefficients_.Update(parameters)) {
+			Configure(f0, structure, brightness, damping);
+		}
+		mode_filters_.Process<FILTER_MODE_BAND_PASS, true>(in, out, size);
+	}
+
+	void Resonator::Configure(
+	    float f0,
+	    float structure,
+	    float brightness,
+	    float damping
 	) {
 		float stiffness = Interpolate(lut_stiffness, structure, 64.0f);
 		f0 *= NthHarmonicCompensation(3, stiffness);
@@ -91,37 +105,20 @@ namespace plaits
 		brightness *= 1.0f - damping * 0.3f;
 		float q_loss = brightness * (2.0f - brightness) * 0.85f + 0.15f;
 
-		float mode_q[kModeBatchSize];
-		float mode_f[kModeBatchSize];
-		float mode_a[kModeBatchSize];
-		int batch_counter = 0;
+		float mode_q[kMaxNumModes];
+		float mode_f[kMaxNumModes];
+		float mode_a[kMaxNumModes];
 
-		ResonatorSvf<kModeBatchSize>* batch_processor = &mode_filters_[0];
-
-		for (int i = 0; i < resolution_; ++i) {
+		for (int i = 0; i < kMaxNumModes; ++i) {
 			float mode_frequency = harmonic * stretch_factor;
 			if (mode_frequency >= 0.499f) {
 				mode_frequency = 0.499f;
 			}
 			float const mode_attenuation = 1.0f - mode_frequency * 2.0f;
 
-			mode_f[batch_counter] = mode_frequency;
-			mode_q[batch_counter] = 1.0f + mode_frequency * q;
-			mode_a[batch_counter] = mode_amplitude_[i] * mode_attenuation;
-			++batch_counter;
-
-			if (batch_counter == kModeBatchSize) {
-				batch_counter = 0;
-				batch_processor->Process<FILTER_MODE_BAND_PASS, true>(
-				    mode_f,
-				    mode_q,
-				    mode_a,
-				    in,
-				    out,
-				    size
-				);
-				++batch_processor;
-			}
+			mode_f[i] = mode_frequency;
+			mode_q[i] = 1.0f + mode_frequency * q;
+			mode_a[i] = mode_amplitude_[i] * mode_attenuation;
 
 			stretch_factor += stiffness;
 			if (stiffness < 0.0f) {
@@ -135,6 +132,7 @@ namespace plaits
 			harmonic += f0;
 			q *= q_loss;
 		}
+		mode_filters_.Configure(mode_f, mode_q, mode_a);
 	}
 
 } // namespace plaits
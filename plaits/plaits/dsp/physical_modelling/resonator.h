@@ -29,16 +29,20 @@
 #ifndef PLAITS_DSP_PHYSICAL_MODELLING_RESONATOR_H_
 #define PLAITS_DSP_PHYSICAL_MODELLING_RESONATOR_H_
 
+#include <algorithm>
+
+#include "stmlib/dsp/coefficient_cache.h"
 #include "stmlib/dsp/filter.h"
+#include "stmlib/dsp/kernels.h"
 
 namespace plaits
 {
 
 	int const kMaxNumModes = 24;
-	int const kModeBatchSize = 4;
 
-	// We render 4 modes simultaneously since there are enough registers to hold
-	// all state variables.
+	// A bank of SVFs fed by the same input, rendered side by side by the
+	// svf_bank kernels of stmlib/dsp/kernels.h. A single filter is rendered
+	// inline.
 	template<int batch_size>
 	class ResonatorSvf
 	{
@@ -48,12 +52,35 @@ namespace plaits
 		~ResonatorSvf() {
 		}
 
-		void Init() {
-			for (int i = 0; i < batch_size; ++i) {
+		// Only the first num_filters filters are rendered, rounded up to the
+		// width of the kernels: the filters in the rounding must be muted by
+		// the caller with a zero gain.
+		void Init(int num_filters = batch_size) {
+			num_filters_ = std::min(num_filters, batch_size);
+			// The kernels render up to a whole number of lanes, and the padding
+			// is a whole number of lanes for all of them.
+			int const padding = stmlib::kSvfBankPadding;
+			num_rendered_filters_ = std::min(
+			    (num_filters_ + padding - 1) / padding * padding, kPaddedSize);
+			// The filters used as padding stay muted.
+			for (int i = 0; i < kPaddedSize; ++i) {
+				g_[i] = r_plus_g_[i] = h_[i] = gain_[i] = 0.0f;
 				state_1_[i] = state_2_[i] = 0.0f;
 			}
 		}
 
+		// Computes the coefficients used by Process(in, out, size).
+		void Configure(float const* f, float const* q, float const* gain) {
+			for (int i = 0; i < batch_size; ++i) {
+				float const g = stmlib::OnePole::tan<stmlib::FREQUENCY_FAST>(f[i]);
+				float const r = 1.0f / q[i];
+				g_[i] = g;
+				r_plus_g_[i] = r + g;
+				h_[i] = 1.0f / (1.0f + r * g + g * g);
+				gain_[i] = gain[i];
+			}
+		}
+
 		template<stmlib::FilterMode mode, bool add>
 		void Process(
 		    float const* f,
@@ -63,50 +90,88 @@ namespace plaits
 		    float* out,
 		    size_t size
 		) {
-			float g[batch_size];
-			float r[batch_size];
-			float r_plus_g[batch_size];
-			float h[batch_size];
-			float state_1[batch_size];
-			float state_2[batch_size];
-			float gains[batch_size];
-			for (int i = 0; i < batch_size; ++i) {
-				g[i] = stmlib::OnePole::tan<stmlib::FREQUENCY_FAST>(f[i]);
-				r[i] = 1.0f / q[i];
-				h[i] = 1.0f / (1.0f + r[i] * g[i] + g[i] * g[i]);
-				r_plus_g[i] = r[i] + g[i];
-				state_1[i] = state_1_[i];
-				state_2[i] = state_2_[i];
-				gains[i] = gain[i];
+			Configure(f, q, gain);
+			Process<mode, add>(in, out, size);
+		}
+
+		template<stmlib::FilterMode mode, bool add>
+		void Process(float const* in, float* out, size_t size) {
+			if constexpr (batch_size == 1) {
+				ProcessSingle<mode, add>(in, out, size);
+			}
+			else {
+				stmlib::SvfBank const bank = {
+					static_cast<size_t>(num_filters_),
+					g_, r_plus_g_, h_, gain_, state_1_, state_2_
+				};
+				stmlib::Kernels const& k = stmlib::kernels();
+				if (add) {
+					k.svf_bank_add[mode](bank, in, out, size);
+				}
+				else {
+					k.svf_bank[mode](bank, in, out, size);
+				}
 			}
+			for (int i = 0; i < num_rendered_filters_; ++i) {
+				state_1_[i] = stmlib::FlushDenormal(state_1_[i]);
+				state_2_[i] = stmlib::FlushDenormal(state_2_[i]);
+			}
+		}
 
+	private:
+		// Same arithmetic as the svf_bank kernels.
+		template<stmlib::FilterMode mode, bool add>
+		void ProcessSingle(float const* in, float* out, size_t size) {
+			float const g = g_[0];
+			float const r_plus_g = r_plus_g_[0];
+			float const h = h_[0];
+			float const gain = gain_[0];
+			float state_1 = state_1_[0];
+			float state_2 = state_2_[0];
 			while (size--) {
-				float s_in = *in++;
-				float s_out = 0.0f;
-				for (int i = 0; i < batch_size; ++i) {
-					float const hp = (s_in - r_plus_g[i] * state_1[i] - state_2[i]) * h[i];
-					float const bp = g[i] * hp + state_1[i];
-					state_1[i] = g[i] * hp + bp;
-					float const lp = g[i] * bp + state_2[i];
-					state_2[i] = g[i] * bp + lp;
-					s_out += gains[i] * ((mode == stmlib::FILTER_MODE_LOW_PASS) ? lp : bp);
+				float const hp = (*in++ - r_plus_g * state_1 - state_2) * h;
+				float const bp = g * hp + state_1;
+				state_1 = g * hp + bp;
+				float const lp = g * bp + state_2;
+				state_2 = g * bp + lp;
+				float value;
+				if constexpr (mode == stmlib::FILTER_MODE_LOW_PASS) {
+					value = gain * lp;
+				}
+				else if constexpr (mode == stmlib::FILTER_MODE_BAND_PASS) {
+					value = gain * bp;
+				}
+				else if constexpr (mode == stmlib::FILTER_MODE_BAND_PASS_NORMALIZED) {
+					value = gain * (bp * (r_plus_g - g));
+				}
+				else {
+					value = gain * hp;
 				}
 				if (add) {
-					*out++ += s_out;
+					*out++ += value;
 				}
 				else {
-					*out++ = s_out;
+					*out++ = value;
 				}
 			}
-			for (int i = 0; i < batch_size; ++i) {
-				state_1_[i] = state_1[i];
-				state_2_[i] = state_2[i];
-			}
+			state_1_[0] = state_1;
+			state_2_[0] = state_2;
 		}
 
-	private:
-		float state_1_[batch_size];
-		float state_2_[batch_size];
+		static constexpr int kPaddedSize = batch_size == 1
+		    ? 1
+		    : (batch_size + stmlib::kSvfBankPadding - 1) /
+		          stmlib::kSvfBankPadding * stmlib::kSvfBankPadding;
+
+		int num_filters_;
+		int num_rendered_filters_;
+
+		float g_[kPaddedSize];
+		float r_plus_g_[kPaddedSize];
+		float h_[kPaddedSize];
+		float gain_[kPaddedSize];
+		float state_1_[kPaddedSize];
+		float state_2_[kPaddedSize];
 
 		DISALLOW_COPY_AND_ASSIGN(ResonatorSvf);
 	};
@@ -131,10 +196,16 @@ namespace plaits
 		);
 
 	private:
+		void Configure(float f0, float structure, float brightness, float damping);
+
 		int resolution_;
 
+		// The mode filters are only reconfigured when f0, structure,
+		// brightness or damping change.
+		stmlib::CoefficientCache<4> coefficients_;
+
 		float mode_amplitude_[kMaxNumModes];
-		ResonatorSvf<kModeBatchSize> mode_filters_[kMaxNumModes / kModeBatchSize];
+		ResonatorSvf<kMaxNumModes> mode_filters_;
 
 		DISALLOW_COPY_AND_ASSIGN(Resonator);
 	};
@@ -30,6 +30,7 @@
 
 #include <cmath>
 
+#include "stmlib/dsp/denormal.h"
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/parameter_interpolator.h"
 #include "stmlib/dsp/units.h"
@@ -44,8 +45,8 @@ namespace plaits
 	using namespace stmlib;
 
 	void String::Init(BufferAllocator* allocator) {
-		string_.Init(allocator->Allocate<float>(kDelayLineSize));
-		stretch_.Init(allocator->Allocate<float>(kDelayLineSize / 4));
+		string_.Init(allocator->Allocate<StringSample>(kDelayLineSize));
+		stretch_.Init(allocator->Allocate<StringSample>(kDelayLineSize / 4));
 		delay_ = 100.0f;
 		Reset();
 	}
@@ -59,6 +60,7 @@ namespace plaits
 		curved_bridge_ = 0.0f;
 		out_sample_[0] = out_sample_[1] = 0.0f;
 		src_phase_ = 0.0f;
+		damping_coefficients_.Init();
 	}
 
 	void String::Process(
@@ -106,23 +108,29 @@ namespace plaits
 			src_ratio = 1.0f;
 		}
 
-		float damping_cutoff = min(
-		    12.0f + damping * damping * 60.0f + brightness * 24.0f,
-		    84.0f
-		);
-		float damping_f = min(f0 * SemitonesToRatio(damping_cutoff), 0.499f);
-
-		// Crossfade to infinite decay.
-		if (damping >= 0.95f) {
-			float to_infinite = 20.0f * (damping - 0.95f);
-			brightness += to_infinite * (1.0f - brightness);
-			damping_f += to_infinite * (0.4999f - damping_f);
-			damping_cutoff += to_infinite * (128.0f - damping_cutoff);
-		}
-
-		iir_damping_filter_.set_f_q<FREQUENCY_FAST>(damping_f, 0.5f);
+		// The damping filter only depends on f0, brightness and damping.
+		float const parameters[] = { f0, brightness, damping };
+		if (damping_coefficients_.Update(parameters)) {
+			float damping_cutoff = min(
+			    12.0f + damping * damping * 60.0f + brightness * 24.0f,
+			    84.0f
+			);
+			float damping_f = min(f0 * SemitonesToRatio(damping_cutoff), 0.499f);
+
+			// Crossfade to infinite decay.
+			if (damping >= 0.95f) {
+				float to_infinite = 20.0f * (damping - 0.95f);
+				brightness += to_infinite * (1.0f - brightness);
+				damping_f += to_infinite * (0.4999f - damping_f);
+				damping_cutoff += to_infinite * (128.0f - damping_cutoff);
+			}
 
-		float damping_compensation = Interpolate(lut_svf_shift, damping_cutoff, 1.0f);
+			iir_damping_filter_.set_f_q<FREQUENCY_FAST>(damping_f, 0.5f);
+			damping_compensation_ = Interpolate(lut_svf_shift, damping_cutoff, 1.0f);
+			damping_brightness_ = brightness;
+		}
+		brightness = damping_brightness_;
+		float const damping_compensation = damping_compensation_;
 
 		// Linearly interpolate delay time.
 		ParameterInterpolator delay_modulation(
@@ -187,6 +195,7 @@ namespace plaits
 
 				dc_blocker_.Process(&s, 1);
 				s = iir_damping_filter_.Process<FILTER_MODE_LOW_PASS>(s);
+				s = FlushDenormal(s);
 				string_.Write(s);
 
 				out_sample_[1] = out_sample_[0];
@@ -195,6 +204,8 @@ namespace plaits
 			*out++ += Crossfade(out_sample_[1], out_sample_[0], src_phase_);
 			in++;
 		}
+		iir_damping_filter_.FlushDenormals();
+		dc_blocker_.FlushDenormals();
 	}
 
 } // namespace plaits
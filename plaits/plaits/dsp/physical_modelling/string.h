@@ -33,6 +33,7 @@
 
 #include "stmlib/stmlib.h"
 
+#include "stmlib/dsp/coefficient_cache.h"
 #include "stmlib/dsp/filter.h"
 #include "stmlib/utils/buffer_allocator.h"
 
@@ -45,6 +46,14 @@ namespace plaits
 
 	const size_t kDelayLineSize = 1024;
 
+	// Building with PLAITS_HALF_PRECISION_STRINGS stores the string and
+	// stiffness delay lines as fp16 instead of float.
+#ifdef PLAITS_HALF_PRECISION_STRINGS
+	typedef stmlib::Half StringSample;
+#else
+	typedef float StringSample;
+#endif // PLAITS_HALF_PRECISION_STRINGS
+
 	enum StringNonLinearity
 	{
 		STRING_NON_LINEARITY_CURVED_BRIDGE,
@@ -61,6 +70,10 @@ namespace plaits
 
 		void Init(stmlib::BufferAllocator* allocator);
 		void Reset();
+		void ListPointers(stmlib::SnapshotPointers* pointers) const {
+			string_.ListPointers(pointers);
+			stretch_.ListPointers(pointers);
+		}
 		void Process(
 		    float f0,
 		    float non_linearity_amount,
@@ -83,12 +96,18 @@ namespace plaits
 		    size_t size
 		);
 
-		DelayLine<float, kDelayLineSize> string_;
-		DelayLine<float, kDelayLineSize / 4> stretch_;
+		DelayLine<float, kDelayLineSize, StringSample> string_;
+		DelayLine<float, kDelayLineSize / 4, StringSample> stretch_;
 
 		stmlib::Svf iir_damping_filter_;
 		stmlib::DCBlocker dc_blocker_;
 
+		// Damping filter settings, recomputed when f0, brightness or damping
+		// change.
+		stmlib::CoefficientCache<3> damping_coefficients_;
+		float damping_compensation_;
+		float damping_brightness_;
+
 		float delay_;
 		float dispersion_noise_;
 		float curved_bridge_;
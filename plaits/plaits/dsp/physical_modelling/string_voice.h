@@ -49,6 +49,9 @@ namespace plaits
 
 		void Init(stmlib::BufferAllocator* allocator);
 		void Reset();
+		void ListPointers(stmlib::SnapshotPointers* pointers) const {
+			string_.ListPointers(pointers);
+		}
 		void Render(
 		    bool sustain,
 		    bool trigger,
@@ -28,12 +28,40 @@
 
 #include "plaits/dsp/voice.h"
 
+#include "stmlib/dsp/denormal.h"
+#include "stmlib/dsp/units.h"
+#include "stmlib/utils/profiler.h"
+#include "stmlib/utils/snapshot.h"
+
 namespace plaits
 {
 
 	using namespace std;
 	using namespace stmlib;
 
+#ifdef STMLIB_PROFILE
+	// One profiling stage per engine, in the order of registration.
+	static ProfileStage EngineStage(int engine_index) {
+		static ProfileStage const stages[] = {
+			RegisterProfileStage("plaits/engine/virtual_analog"),
+			RegisterProfileStage("plaits/engine/waveshaping"),
+			RegisterProfileStage("plaits/engine/fm"),
+			RegisterProfileStage("plaits/engine/grain"),
+			RegisterProfileStage("plaits/engine/additive"),
+			RegisterProfileStage("plaits/engine/wavetable"),
+			RegisterProfileStage("plaits/engine/chord"),
+			RegisterProfileStage("plaits/engine/swarm"),
+			RegisterProfileStage("plaits/engine/noise"),
+			RegisterProfileStage("plaits/engine/particle"),
+			RegisterProfileStage("plaits/engine/string"),
+			RegisterProfileStage("plaits/engine/modal"),
+			RegisterProfileStage("plaits/engine/sine_bank"),
+			RegisterProfileStage("plaits/engine/dense_swarm"),
+		};
+		return stages[engine_index];
+	}
+#endif // STMLIB_PROFILE
+
 	void Voice::Init(BufferAllocator* allocator) {
 		engines_.Init();
 		engines_.RegisterInstance(&virtual_analog_engine_, false, 0.8f, 0.8f);
@@ -49,11 +77,23 @@ namespace plaits
 		engines_.RegisterInstance(&particle_engine_, false, -2.0f, 1.0f);
 		engines_.RegisterInstance(&string_engine_, true, -1.0f, 0.8f);
 		engines_.RegisterInstance(&modal_engine_, true, -1.0f, 0.8f);
+		engines_.RegisterInstance(&sine_bank_engine_, false, 0.8f, 0.8f);
+		engines_.RegisterInstance(&dense_swarm_engine_, false, -3.0f, 1.0f);
+		arena_ = allocator->buffer();
+		arena_size_ = allocator->size();
+		size_t const num_failures = allocator->num_failures();
+		size_t max_usage = 0;
+		fill(&arena_usage_[0], &arena_usage_[kMaxEngines], 0);
 		for (int i = 0; i < engines_.size(); ++i) {
 			// All engines will share the same RAM space.
-			allocator->Free();
+			BufferAllocator::Frame frame(allocator);
 			engines_.get(i)->Init(allocator);
+			arena_usage_[i] = frame.used();
+			max_usage = max(max_usage, arena_usage_[i]);
 		}
+		// Keeps the shared RAM allocated once the frames are closed.
+		allocator->Allocate<uint8_t>(max_usage);
+		arena_failures_ = allocator->num_failures() - num_failures;
 
 		engine_quantizer_.Init();
 		previous_engine_index_ = -1;
@@ -61,14 +101,56 @@ namespace plaits
 
 		out_post_processor_.Init();
 		aux_post_processor_.Init();
+
+		lpg_envelope_.Init();
+		decay_coefficients_.Init();
 	}
 
-	Voice::Frame Voice::Render(
+	// "PLVS"
+	uint32_t const kSnapshotMagic = 0x53564c50;
+	uint16_t const kSnapshotVersion = 4;
+
+	void Voice::ListPointers(stmlib::SnapshotPointers* pointers) const {
+		engines_.ListPointers(pointers);
+		pointers->Add(&arena_);
+	}
+
+	size_t Voice::snapshot_size() const {
+		stmlib::SnapshotPointers pointers;
+		ListPointers(&pointers);
+		return stmlib::Snapshot::size(sizeof(*this), arena_size_, pointers);
+	}
+
+	size_t Voice::Snapshot(void* buffer, size_t size) const {
+		stmlib::SnapshotPointers pointers;
+		ListPointers(&pointers);
+		return stmlib::Snapshot::Save(
+		    kSnapshotMagic, kSnapshotVersion,
+		    this, sizeof(*this),
+		    arena_, arena_size_,
+		    pointers,
+		    buffer, size
+		);
+	}
+
+	bool Voice::Restore(void const* buffer, size_t size) {
+		stmlib::SnapshotPointers pointers;
+		ListPointers(&pointers);
+		return stmlib::Snapshot::Restore(
+		    kSnapshotMagic, kSnapshotVersion,
+		    this, sizeof(*this),
+		    arena_, arena_size_,
+		    pointers,
+		    buffer, size
+		);
+	}
+
+	Engine* Voice::Prepare(
 	    Patch const& patch,
-	    Modulations const& modulations
+	    Modulations const& modulations,
+	    EngineParameters* p
 	) {
-		using math = crack::audio::StdContext;
-		Frame result{};
+		using math = stmlib::DefaultMath;
 		// Trigger, LPG, internal envelope.
 
 		// Engine selection.
@@ -86,37 +168,232 @@ namespace plaits
 			out_post_processor_.Reset();
 			previous_engine_index_ = engine_index;
 		}
-		EngineParameters p;
-		p.samplePeriod = patch.samplePeriod;
-		p.trigger2 = modulations.trigger2;
-		p.sustain = modulations.sustain;
-
-		PostProcessingSettings const& pp_s = e->post_processing_settings;
+		p->samplePeriod = patch.samplePeriod;
+		p->trigger = modulations.trigger_patched
+		    ? (modulations.trigger2 ? TRIGGER_RISING_EDGE : TRIGGER_LOW)
+		    : TRIGGER_UNPATCHED;
+		p->trigger2 = modulations.trigger2;
+		p->sustain = modulations.sustain;
 
 		float const compressed_level = max(
 		    1.3f * modulations.level / (0.3f + fabsf(modulations.level)),
 		    0.0f
 		);
-		p.accent = compressed_level;
-		p.harmonics = math::clamp(patch.harmonics + modulations.harmonics, 0.0f, 1.0f);
-		p.note = math::clamp(patch.note, -119.0f, 120.0f);
-		p.timbre = math::clamp(patch.timbre, 0.0f, 1.0f);
-		p.morph = math::clamp(patch.morph, 0.0f, 1.0f);
+		p->accent = compressed_level;
+		p->harmonics = math::clamp(patch.harmonics + modulations.harmonics, 0.0f, 1.0f);
+		p->note = math::clamp(patch.note, -119.0f, 120.0f);
+		p->timbre = math::clamp(patch.timbre, 0.0f, 1.0f);
+		p->morph = math::clamp(patch.morph, 0.0f, 1.0f);
+		return e;
+	}
+
+	void Voice::ComputeDecayParameters(Patch const& settings) {
+		short_decay_ = 200.0f / kSampleRate * SemitonesToRatio(-96.0f * settings.decay);
+		decay_tail_ = 20.0f / kSampleRate * SemitonesToRatio(
+		    -72.0f * settings.decay + 12.0f * settings.lpg_colour
+		) - short_decay_;
+	}
+
+	void Voice::PostProcess(
+	    Patch const& patch,
+	    Modulations const& modulations,
+	    EngineParameters const& p,
+	    bool trigger,
+	    bool already_enveloped,
+	    float* out,
+	    float* aux,
+	    size_t size
+	) {
+		PostProcessingSettings const& pp_s =
+		    engines_.get(previous_engine_index_)->post_processing_settings;
+
+		bool const lpg_bypass = already_enveloped ||
+		    (!modulations.level_patched && !modulations.trigger_patched);
 
-		bool already_enveloped = pp_s.already_enveloped;
-		e->Render(p, &result.out, &result.aux, 1, &already_enveloped);
+		// The envelope runs at the sample rate, as in the single-sample
+		// Render(), so that it rises and decays at the same speed whatever the
+		// block size. The LPG interpolates its gain over the block.
+		if (!lpg_bypass) {
+			float const parameters[] = { patch.decay, patch.lpg_colour };
+			if (decay_coefficients_.Update(parameters)) {
+				ComputeDecayParameters(patch);
+			}
+			float const hf = patch.lpg_colour;
 
-		result.out = out_post_processor_.Process(
+			if (trigger) {
+				lpg_envelope_.Trigger();
+			}
+			if (modulations.level_patched) {
+				for (size_t i = 0; i < size; ++i) {
+					lpg_envelope_.ProcessLP(p.accent, short_decay_, decay_tail_, hf);
+				}
+			}
+			else {
+				float const attack = NoteToFrequency(p.note) * 2.0f;
+				for (size_t i = 0; i < size; ++i) {
+					lpg_envelope_.ProcessPing(attack, short_decay_, decay_tail_, hf);
+				}
+			}
+		}
+
+		out_post_processor_.Process(
 		    pp_s.out_gain,
-		    result.out
+		    lpg_bypass,
+		    lpg_envelope_.gain(),
+		    lpg_envelope_.frequency(),
+		    lpg_envelope_.hf_bleed(),
+		    out,
+		    size
 		);
 
-		result.aux = aux_post_processor_.Process(
+		aux_post_processor_.Process(
 		    pp_s.aux_gain,
-		    result.aux
+		    lpg_bypass,
+		    lpg_envelope_.gain(),
+		    lpg_envelope_.frequency(),
+		    lpg_envelope_.hf_bleed(),
+		    aux,
+		    size
 		);
+	}
+
+	Voice::Frame Voice::Render(
+	    Patch const& patch,
+	    Modulations const& modulations
+	) {
+		STMLIB_PROFILE_SCOPE("plaits/voice");
+
+		Frame result{};
+		EngineParameters p;
+		Engine* e = Prepare(patch, modulations, &p);
 
+		bool already_enveloped = e->post_processing_settings.already_enveloped;
+		{
+			STMLIB_PROFILE_STAGE_SCOPE(EngineStage(previous_engine_index_));
+			e->Render(p, &result.out, &result.aux, 1, &already_enveloped);
+		}
+
+		PostProcess(
+		    patch,
+		    modulations,
+		    p,
+		    p.trigger == TRIGGER_RISING_EDGE,
+		    already_enveloped,
+		    &result.out,
+		    &result.aux,
+		    1
+		);
 		return result;
 	}
 
+	void Voice::Render(
+	    Patch const& patch,
+	    Modulations const& modulations,
+	    VoiceEvent const* events,
+	    size_t num_events,
+	    Frame* frames,
+	    size_t size
+	) {
+		STMLIB_PROFILE_SCOPE("plaits/voice");
+		stmlib::ScopedFlushDenormals flush_denormals;
+
+		Patch pa = patch;
+		Modulations m = modulations;
+
+		// The engines render one sample at a time, and the parameters only
+		// change at the events. The post-processing runs by blocks of
+		// kBlockSize samples, ended early at triggers and engine changes so
+		// that the LPG opens at the trigger and each block is post-processed
+		// with the settings of a single engine.
+		size_t block_end = 0;
+		for (size_t block_start = 0; block_start < size; block_start = block_end) {
+			block_end = min(block_start + kBlockSize, size);
+			for (size_t k = 0; k < num_events && events[k].time < block_end; ++k) {
+				if (events[k].time > block_start &&
+				    (events[k].type == VOICE_EVENT_TRIGGER ||
+				     events[k].type == VOICE_EVENT_ENGINE)) {
+					block_end = events[k].time;
+					break;
+				}
+			}
+			size_t const block_size = block_end - block_start;
+			EngineParameters p;
+			bool trigger = false;
+			bool already_enveloped = false;
+			fill(&out_buffer_[0], &out_buffer_[block_size], 0.0f);
+			fill(&aux_buffer_[0], &aux_buffer_[block_size], 0.0f);
+
+			size_t start = block_start;
+			while (start < block_end) {
+				for (; num_events && events->time <= start; ++events, --num_events) {
+					switch (events->type) {
+						case VOICE_EVENT_TRIGGER:
+							m.trigger2 = true;
+							break;
+						case VOICE_EVENT_SUSTAIN:
+							m.sustain = events->value > 0.5f;
+							break;
+						case VOICE_EVENT_ENGINE:
+							pa.engine = static_cast<int>(events->value);
+							break;
+						case VOICE_EVENT_NOTE:
+							pa.note = events->value;
+							break;
+						case VOICE_EVENT_HARMONICS:
+							pa.harmonics = events->value;
+							break;
+						case VOICE_EVENT_TIMBRE:
+							pa.timbre = events->value;
+							break;
+						case VOICE_EVENT_MORPH:
+							pa.morph = events->value;
+							break;
+						case VOICE_EVENT_LEVEL:
+							m.level = events->value;
+							break;
+					}
+				}
+
+				size_t end = num_events ? min(events->time, block_end) : block_end;
+
+				Engine* e = Prepare(pa, m, &p);
+				bool const enveloped = e->post_processing_settings.already_enveloped;
+				trigger = trigger || p.trigger == TRIGGER_RISING_EDGE;
+
+				// Timed per run of samples rather than per sample.
+				STMLIB_PROFILE_STAGE_SCOPE(EngineStage(previous_engine_index_));
+				for (size_t i = start; i < end; ++i) {
+					already_enveloped = enveloped;
+					e->Render(
+					    p,
+					    &out_buffer_[i - block_start],
+					    &aux_buffer_[i - block_start],
+					    1,
+					    &already_enveloped
+					);
+					p.trigger = p.trigger == TRIGGER_RISING_EDGE ? TRIGGER_LOW : p.trigger;
+					p.trigger2 = false;
+				}
+
+				m.trigger2 = false;
+				start = end;
+			}
+
+			PostProcess(
+			    pa,
+			    m,
+			    p,
+			    trigger,
+			    already_enveloped,
+			    out_buffer_,
+			    aux_buffer_,
+			    block_size
+			);
+			for (size_t i = 0; i < block_size; ++i) {
+				frames[block_start + i].out = out_buffer_[i];
+				frames[block_start + i].aux = aux_buffer_[i];
+			}
+		}
+	}
+
 } // namespace plaits
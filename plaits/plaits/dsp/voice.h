@@ -31,18 +31,22 @@
 
 #include "stmlib/stmlib.h"
 
+#include "stmlib/dsp/coefficient_cache.h"
 #include "stmlib/dsp/filter.h"
 #include "stmlib/dsp/limiter.h"
 #include "stmlib/utils/buffer_allocator.h"
+#include "stmlib/utils/snapshot.h"
 
 #include "plaits/dsp/engine/additive_engine.h"
 #include "plaits/dsp/engine/chord_engine.h"
+#include "plaits/dsp/engine/dense_swarm_engine.h"
 #include "plaits/dsp/engine/engine.h"
 #include "plaits/dsp/engine/fm_engine.h"
 #include "plaits/dsp/engine/grain_engine.h"
 #include "plaits/dsp/engine/modal_engine.h"
 #include "plaits/dsp/engine/noise_engine.h"
 #include "plaits/dsp/engine/particle_engine.h"
+#include "plaits/dsp/engine/sine_bank_engine.h"
 #include "plaits/dsp/engine/string_engine.h"
 #include "plaits/dsp/engine/swarm_engine.h"
 #include "plaits/dsp/engine/virtual_analog_engine.h"
@@ -74,21 +78,35 @@ namespace plaits
 
 		void Reset() {
 			limiter_.Init();
+			lpg_.Init();
 		}
 
-		float Process(
+		void Process(
 		    float gain,
-		    float in
+		    bool bypass_lpg,
+		    float low_pass_gate_gain,
+		    float low_pass_gate_frequency,
+		    float low_pass_gate_hf_bleed,
+		    float* in_out,
+		    size_t size
 		) {
 			if (gain < 0.0f) {
-				in = limiter_.Process(-gain, in);
+				limiter_.Process(-gain, in_out, size);
+			}
+			if (!bypass_lpg) {
+				lpg_.Process(
+				    low_pass_gate_gain,
+				    low_pass_gate_frequency,
+				    low_pass_gate_hf_bleed,
+				    in_out,
+				    size
+				);
 			}
-
-			return in;
 		}
 
 	private:
 		stmlib::Limiter limiter_;
+		LowPassGate lpg_;
 
 		DISALLOW_COPY_AND_ASSIGN(ChannelPostProcessor);
 	};
@@ -129,6 +147,27 @@ namespace plaits
 		bool trigger2;
 	};
 
+	enum VoiceEventType
+	{
+		VOICE_EVENT_TRIGGER, // Sets trigger2 at this sample, value is ignored.
+		VOICE_EVENT_SUSTAIN, // Sustain is on when value > 0.5.
+		VOICE_EVENT_ENGINE,
+		VOICE_EVENT_NOTE,
+		VOICE_EVENT_HARMONICS,
+		VOICE_EVENT_TIMBRE,
+		VOICE_EVENT_MORPH,
+		VOICE_EVENT_LEVEL,
+	};
+
+	// Event taking effect at a given sample of a block rendered by
+	// Voice::Render().
+	struct VoiceEvent
+	{
+		size_t time;
+		VoiceEventType type;
+		float value;
+	};
+
 	class Voice
 	{
 	public:
@@ -144,24 +183,119 @@ namespace plaits
 		};
 
 		void Init(stmlib::BufferAllocator* allocator);
+
+		// Renders a single sample. To avoid switching the floating point mode
+		// at every sample, this does not enable flush-to-zero: the caller holds
+		// a stmlib::ScopedFlushDenormals over its loop on the samples of a
+		// block.
 		Frame Render(
 		    Patch const& patch,
 		    Modulations const& modulations
 		);
+
+		// Renders a block of any size. The events, sorted by time, are applied
+		// to copies of the patch and modulations at the sample they are
+		// scheduled for. Engine selection and parameter computation only run
+		// at the events, so the timing is sample-accurate without the cost of
+		// a Render() call per sample. modulations.trigger2 triggers at the
+		// first sample.
+		//
+		// The LPG envelope runs at every sample. The LPG reads it once every
+		// kBlockSize samples, and at each trigger and engine change, and
+		// interpolates its gain in between. The single-sample Render() reads
+		// it at every sample.
+		void Render(
+		    Patch const& patch,
+		    Modulations const& modulations,
+		    VoiceEvent const* events,
+		    size_t num_events,
+		    Frame* frames,
+		    size_t size
+		);
 		inline int active_engine() const {
 			return previous_engine_index_;
 		}
 
+		// Bytes of the RAM shared by the engines used by an engine, alignment
+		// padding included. The sine bank and dense swarm engines take all the
+		// RAM they are given.
+		inline size_t arena_usage(int engine) const {
+			return arena_usage_[engine];
+		}
+
+		// Number of engine allocations which did not fit in the RAM given to
+		// Init(). Most engines do not check their allocations, so a voice with
+		// failed allocations must not be rendered.
+		inline size_t arena_failures() const {
+			return arena_failures_;
+		}
+
+		// Snapshot of the whole state of the voice (engines, post-processing, and
+		// the RAM shared by the engines), see stmlib/utils/snapshot.h.
+		// Restoring a snapshot then rendering gives the same output as the voice
+		// had when it was taken. The snapshot can be restored into another voice
+		// initialized with the same amount of RAM.
+		size_t snapshot_size() const;
+		size_t Snapshot(void* buffer, size_t size) const;
+		bool Restore(void const* buffer, size_t size);
+
+		// Shares a runtime-loaded bank with the wavetable and chord engines.
+		// NULL restores the built-in waves.
+		inline void set_wavetable_bank(WavetableBank const* bank) {
+			chord_engine_.set_bank(bank);
+			wavetable_engine_.set_bank(bank);
+		}
+
+		// Number of voices of the dense swarm engine (8 to 512, in steps of 8).
+		inline void set_num_swarm_voices(int num_voices) {
+			dense_swarm_engine_.set_num_voices(num_voices);
+		}
+
+		// Number of particles of the particle engine (1 to 64).
+		inline void set_num_particles(int num_particles) {
+			particle_engine_.set_num_particles(num_particles);
+		}
+
 	private:
+		template<int num_lanes>
+		friend class VoiceLanes;
+
+		void ListPointers(stmlib::SnapshotPointers* pointers) const;
+
+		// Render() is split in engine selection / parameter computation, engine
+		// rendering, and post-processing, so that VoiceLanes can render the
+		// engines of several voices in a single pass.
+		Engine* Prepare(
+		    Patch const& patch,
+		    Modulations const& modulations,
+		    EngineParameters* p
+		);
+
+		// Limiter and low pass gate. The LPG envelope advances by size
+		// samples; the LPG is bypassed when the engine is already enveloped or
+		// when neither the trigger nor the level input is patched.
+		void PostProcess(
+		    Patch const& patch,
+		    Modulations const& modulations,
+		    EngineParameters const& p,
+		    bool trigger,
+		    bool already_enveloped,
+		    float* out,
+		    float* aux,
+		    size_t size
+		);
+
 		void ComputeDecayParameters(Patch const& settings);
 
 		AdditiveEngine additive_engine_;
 		ChordEngine chord_engine_;
+		DenseSwarmEngine dense_swarm_engine_;
 		FMEngine fm_engine_;
 		GrainEngine grain_engine_;
 		ModalEngine modal_engine_;
 		NoiseEngine noise_engine_;
 		ParticleEngine particle_engine_;
+		SineBankEngine sine_bank_engine_;
 		StringEngine string_engine_;
 		SwarmEngine swarm_engine_;
 		VirtualAnalogEngine virtual_analog_engine_;
@@ -176,11 +310,24 @@ namespace plaits
 		ChannelPostProcessor out_post_processor_;
 		ChannelPostProcessor aux_post_processor_;
 
+		LPGEnvelope lpg_envelope_;
+
+		// Decay rates of the LPG envelope, per sample, recomputed when the
+		// decay or the LPG colour change.
+		stmlib::CoefficientCache<2> decay_coefficients_;
+		float short_decay_;
+		float decay_tail_;
+
 		EngineRegistry<kMaxEngines> engines_;
 
 		float out_buffer_[kMaxBlockSize];
 		float aux_buffer_[kMaxBlockSize];
 
+		void* arena_;
+		size_t arena_size_;
+		size_t arena_usage_[kMaxEngines];
+		size_t arena_failures_;
+
 		DISALLOW_COPY_AND_ASSIGN(Voice);
 	};
 
@@ -0,0 +1,140 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Group of num_lanes voices rendered together. When all voices play an engine
+// which has a lane-parallel renderer, the state of this engine is moved out of
+// the voices into structure-of-arrays lanes and the voices are rendered in a
+// single vectorizable pass. As soon as the voices diverge, the state is moved
+// back and each voice renders on its own.
+
+#ifndef PLAITS_DSP_VOICE_LANES_H_
+#define PLAITS_DSP_VOICE_LANES_H_
+
+#include "stmlib/stmlib.h"
+#include "stmlib/dsp/denormal.h"
+
+#include "plaits/dsp/engine/virtual_analog_engine_lanes.h"
+#include "plaits/dsp/voice.h"
+
+namespace plaits
+{
+
+	template<int num_lanes>
+	class VoiceLanes
+	{
+	public:
+		VoiceLanes() {
+		}
+		~VoiceLanes() {
+		}
+
+		void Init(Voice* const* voices) {
+			std::copy(&voices[0], &voices[num_lanes], &voice_[0]);
+			lanes_active_ = false;
+		}
+
+		void Render(
+		    Patch const* patch,
+		    Modulations const* modulations,
+		    Voice::Frame* frames
+		) {
+			stmlib::ScopedFlushDenormals flush_denormals;
+
+			EngineParameters p[num_lanes];
+			Engine* e[num_lanes];
+			bool coherent = true;
+			for (int i = 0; i < num_lanes; ++i) {
+				e[i] = voice_[i]->Prepare(patch[i], modulations[i], &p[i]);
+				coherent = coherent && e[i] == &voice_[i]->virtual_analog_engine_;
+			}
+
+			if (coherent) {
+				if (!lanes_active_) {
+					for (int i = 0; i < num_lanes; ++i) {
+						virtual_analog_engine_.Load(i, voice_[i]->virtual_analog_engine_);
+					}
+					lanes_active_ = true;
+				}
+				float out[num_lanes];
+				float aux[num_lanes];
+				virtual_analog_engine_.Render(p, out, aux);
+				for (int i = 0; i < num_lanes; ++i) {
+					Voice* v = voice_[i];
+					v->PostProcess(
+					    patch[i],
+					    modulations[i],
+					    p[i],
+					    p[i].trigger == TRIGGER_RISING_EDGE,
+					    v->virtual_analog_engine_.post_processing_settings.already_enveloped,
+					    &out[i],
+					    &aux[i],
+					    1
+					);
+					frames[i] = Voice::Frame { out[i], aux[i] };
+				}
+			}
+			else {
+				Flush();
+				for (int i = 0; i < num_lanes; ++i) {
+					Voice::Frame frame {};
+					bool already_enveloped = e[i]->post_processing_settings.already_enveloped;
+					e[i]->Render(p[i], &frame.out, &frame.aux, 1, &already_enveloped);
+					voice_[i]->PostProcess(
+					    patch[i],
+					    modulations[i],
+					    p[i],
+					    p[i].trigger == TRIGGER_RISING_EDGE,
+					    already_enveloped,
+					    &frame.out,
+					    &frame.aux,
+					    1
+					);
+					frames[i] = frame;
+				}
+			}
+		}
+
+		// Moves the lane state back into the voices. Must be called before one
+		// of the voices is used on its own (Voice::Render(), Voice::Snapshot()).
+		void Flush() {
+			if (lanes_active_) {
+				for (int i = 0; i < num_lanes; ++i) {
+					virtual_analog_engine_.Store(i, &voice_[i]->virtual_analog_engine_);
+				}
+				lanes_active_ = false;
+			}
+		}
+
+	private:
+		Voice* voice_[num_lanes];
+		bool lanes_active_;
+
+		VirtualAnalogEngineLanes<num_lanes> virtual_analog_engine_;
+
+		DISALLOW_COPY_AND_ASSIGN(VoiceLanes);
+	};
+
+} // namespace plaits
+
+#endif // PLAITS_DSP_VOICE_LANES_H_
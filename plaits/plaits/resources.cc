@@ -34,2792 +34,6 @@
 namespace plaits
 {
 
-	float const lut_sine[] = {
-		0.000000000e+00,
-		6.135884649e-03,
-		1.227153829e-02,
-		1.840672991e-02,
-		2.454122852e-02,
-		3.067480318e-02,
-		3.680722294e-02,
-		4.293825693e-02,
-		4.906767433e-02,
-		5.519524435e-02,
-		6.132073630e-02,
-		6.744391956e-02,
-		7.356456360e-02,
-		7.968243797e-02,
-		8.579731234e-02,
-		9.190895650e-02,
-		9.801714033e-02,
-		1.041216339e-01,
-		1.102222073e-01,
-		1.163186309e-01,
-		1.224106752e-01,
-		1.284981108e-01,
-		1.345807085e-01,
-		1.406582393e-01,
-		1.467304745e-01,
-		1.527971853e-01,
-		1.588581433e-01,
-		1.649131205e-01,
-		1.709618888e-01,
-		1.770042204e-01,
-		1.830398880e-01,
-		1.890686641e-01,
-		1.950903220e-01,
-		2.011046348e-01,
-		2.071113762e-01,
-		2.131103199e-01,
-		2.191012402e-01,
-		2.250839114e-01,
-		2.310581083e-01,
-		2.370236060e-01,
-		2.429801799e-01,
-		2.489276057e-01,
-		2.548656596e-01,
-		2.607941179e-01,
-		2.667127575e-01,
-		2.726213554e-01,
-		2.785196894e-01,
-		2.844075372e-01,
-		2.902846773e-01,
-		2.961508882e-01,
-		3.020059493e-01,
-		3.078496400e-01,
-		3.136817404e-01,
-		3.195020308e-01,
-		3.253102922e-01,
-		3.311063058e-01,
-		3.368898534e-01,
-		3.426607173e-01,
-		3.484186802e-01,
-		3.541635254e-01,
-		3.598950365e-01,
-		3.656129978e-01,
-		3.713171940e-01,
-		3.770074102e-01,
-		3.826834324e-01,
-		3.883450467e-01,
-		3.939920401e-01,
-		3.996241998e-01,
-		4.052413140e-01,
-		4.108431711e-01,
-		4.164295601e-01,
-		4.220002708e-01,
-		4.275550934e-01,
-		4.330938189e-01,
-		4.386162385e-01,
-		4.441221446e-01,
-		4.496113297e-01,
-		4.550835871e-01,
-		4.605387110e-01,
-		4.659764958e-01,
-		4.713967368e-01,
-		4.767992301e-01,
-		4.821837721e-01,
-		4.875501601e-01,
-		4.928981922e-01,
-		4.982276670e-01,
-		5.035383837e-01,
-		5.088301425e-01,
-		5.141027442e-01,
-		5.193559902e-01,
-		5.245896827e-01,
-		5.298036247e-01,
-		5.349976199e-01,
-		5.401714727e-01,
-		5.453249884e-01,
-		5.504579729e-01,
-		5.555702330e-01,
-		5.606615762e-01,
-		5.657318108e-01,
-		5.707807459e-01,
-		5.758081914e-01,
-		5.808139581e-01,
-		5.857978575e-01,
-		5.907597019e-01,
-		5.956993045e-01,
-		6.006164794e-01,
-		6.055110414e-01,
-		6.103828063e-01,
-		6.152315906e-01,
-		6.200572118e-01,
-		6.248594881e-01,
-		6.296382389e-01,
-		6.343932842e-01,
-		6.391244449e-01,
-		6.438315429e-01,
-		6.485144010e-01,
-		6.531728430e-01,
-		6.578066933e-01,
-		6.624157776e-01,
-		6.669999223e-01,
-		6.715589548e-01,
-		6.760927036e-01,
-		6.806009978e-01,
-		6.850836678e-01,
-		6.895405447e-01,
-		6.939714609e-01,
-		6.983762494e-01,
-		7.027547445e-01,
-		7.071067812e-01,
-		7.114321957e-01,
-		7.157308253e-01,
-		7.200025080e-01,
-		7.242470830e-01,
-		7.284643904e-01,
-		7.326542717e-01,
-		7.368165689e-01,
-		7.409511254e-01,
-		7.450577854e-01,
-		7.491363945e-01,
-		7.531867990e-01,
-		7.572088465e-01,
-		7.612023855e-01,
-		7.651672656e-01,
-		7.691033376e-01,
-		7.730104534e-01,
-		7.768884657e-01,
-		7.807372286e-01,
-		7.845565972e-01,
-		7.883464276e-01,
-		7.921065773e-01,
-		7.958369046e-01,
-		7.995372691e-01,
-		8.032075315e-01,
-		8.068475535e-01,
-		8.104571983e-01,
-		8.140363297e-01,
-		8.175848132e-01,
-		8.211025150e-01,
-		8.245893028e-01,
-		8.280450453e-01,
-		8.314696123e-01,
-		8.348628750e-01,
-		8.382247056e-01,
-		8.415549774e-01,
-		8.448535652e-01,
-		8.481203448e-01,
-		8.513551931e-01,
-		8.545579884e-01,
-		8.577286100e-01,
-		8.608669386e-01,
-		8.639728561e-01,
-		8.670462455e-01,
-		8.700869911e-01,
-		8.730949784e-01,
-		8.760700942e-01,
-		8.790122264e-01,
-		8.819212643e-01,
-		8.847970984e-01,
-		8.876396204e-01,
-		8.904487232e-01,
-		8.932243012e-01,
-		8.959662498e-01,
-		8.986744657e-01,
-		9.013488470e-01,
-		9.039892931e-01,
-		9.065957045e-01,
-		9.091679831e-01,
-		9.117060320e-01,
-		9.142097557e-01,
-		9.166790599e-01,
-		9.191138517e-01,
-		9.215140393e-01,
-		9.238795325e-01,
-		9.262102421e-01,
-		9.285060805e-01,
-		9.307669611e-01,
-		9.329927988e-01,
-		9.351835099e-01,
-		9.373390119e-01,
-		9.394592236e-01,
-		9.415440652e-01,
-		9.435934582e-01,
-		9.456073254e-01,
-		9.475855910e-01,
-		9.495281806e-01,
-		9.514350210e-01,
-		9.533060404e-01,
-		9.551411683e-01,
-		9.569403357e-01,
-		9.587034749e-01,
-		9.604305194e-01,
-		9.621214043e-01,
-		9.637760658e-01,
-		9.653944417e-01,
-		9.669764710e-01,
-		9.685220943e-01,
-		9.700312532e-01,
-		9.715038910e-01,
-		9.729399522e-01,
-		9.743393828e-01,
-		9.757021300e-01,
-		9.770281427e-01,
-		9.783173707e-01,
-		9.795697657e-01,
-		9.807852804e-01,
-		9.819638691e-01,
-		9.831054874e-01,
-		9.842100924e-01,
-		9.852776424e-01,
-		9.863080972e-01,
-		9.873014182e-01,
-		9.882575677e-01,
-		9.891765100e-01,
-		9.900582103e-01,
-		9.909026354e-01,
-		9.917097537e-01,
-		9.924795346e-01,
-		9.932119492e-01,
-		9.939069700e-01,
-		9.945645707e-01,
-		9.951847267e-01,
-		9.957674145e-01,
-		9.963126122e-01,
-		9.968202993e-01,
-		9.972904567e-01,
-		9.977230666e-01,
-		9.981181129e-01,
-		9.984755806e-01,
-		9.987954562e-01,
-		9.990777278e-01,
-		9.993223846e-01,
-		9.995294175e-01,
-		9.996988187e-01,
-		9.998305818e-01,
-		9.999247018e-01,
-		9.999811753e-01,
-		1.000000000e+00,
-		9.999811753e-01,
-		9.999247018e-01,
-		9.998305818e-01,
-		9.996988187e-01,
-		9.995294175e-01,
-		9.993223846e-01,
-		9.990777278e-01,
-		9.987954562e-01,
-		9.984755806e-01,
-		9.981181129e-01,
-		9.977230666e-01,
-		9.972904567e-01,
-		9.968202993e-01,
-		9.963126122e-01,
-		9.957674145e-01,
-		9.951847267e-01,
-		9.945645707e-01,
-		9.939069700e-01,
-		9.932119492e-01,
-		9.924795346e-01,
-		9.917097537e-01,
-		9.909026354e-01,
-		9.900582103e-01,
-		9.891765100e-01,
-		9.882575677e-01,
-		9.873014182e-01,
-		9.863080972e-01,
-		9.852776424e-01,
-		9.842100924e-01,
-		9.831054874e-01,
-		9.819638691e-01,
-		9.807852804e-01,
-		9.795697657e-01,
-		9.783173707e-01,
-		9.770281427e-01,
-		9.757021300e-01,
-		9.743393828e-01,
-		9.729399522e-01,
-		9.715038910e-01,
-		9.700312532e-01,
-		9.685220943e-01,
-		9.669764710e-01,
-		9.653944417e-01,
-		9.637760658e-01,
-		9.621214043e-01,
-		9.604305194e-01,
-		9.587034749e-01,
-		9.569403357e-01,
-		9.551411683e-01,
-		9.533060404e-01,
-		9.514350210e-01,
-		9.495281806e-01,
-		9.475855910e-01,
-		9.456073254e-01,
-		9.435934582e-01,
-		9.415440652e-01,
-		9.394592236e-01,
-		9.373390119e-01,
-		9.351835099e-01,
-		9.329927988e-01,
-		9.307669611e-01,
-		9.285060805e-01,
-		9.262102421e-01,
-		9.238795325e-01,
-		9.215140393e-01,
-		9.191138517e-01,
-		9.166790599e-01,
-		9.142097557e-01,
-		9.117060320e-01,
-		9.091679831e-01,
-		9.065957045e-01,
-		9.039892931e-01,
-		9.013488470e-01,
-		8.986744657e-01,
-		8.959662498e-01,
-		8.932243012e-01,
-		8.904487232e-01,
-		8.876396204e-01,
-		8.847970984e-01,
-		8.819212643e-01,
-		8.790122264e-01,
-		8.760700942e-01,
-		8.730949784e-01,
-		8.700869911e-01,
-		8.670462455e-01,
-		8.639728561e-01,
-		8.608669386e-01,
-		8.577286100e-01,
-		8.545579884e-01,
-		8.513551931e-01,
-		8.481203448e-01,
-		8.448535652e-01,
-		8.415549774e-01,
-		8.382247056e-01,
-		8.348628750e-01,
-		8.314696123e-01,
-		8.280450453e-01,
-		8.245893028e-01,
-		8.211025150e-01,
-		8.175848132e-01,
-		8.140363297e-01,
-		8.104571983e-01,
-		8.068475535e-01,
-		8.032075315e-01,
-		7.995372691e-01,
-		7.958369046e-01,
-		7.921065773e-01,
-		7.883464276e-01,
-		7.845565972e-01,
-		7.807372286e-01,
-		7.768884657e-01,
-		7.730104534e-01,
-		7.691033376e-01,
-		7.651672656e-01,
-		7.612023855e-01,
-		7.572088465e-01,
-		7.531867990e-01,
-		7.491363945e-01,
-		7.450577854e-01,
-		7.409511254e-01,
-		7.368165689e-01,
-		7.326542717e-01,
-		7.284643904e-01,
-		7.242470830e-01,
-		7.200025080e-01,
-		7.157308253e-01,
-		7.114321957e-01,
-		7.071067812e-01,
-		7.027547445e-01,
-		6.983762494e-01,
-		6.939714609e-01,
-		6.895405447e-01,
-		6.850836678e-01,
-		6.806009978e-01,
-		6.760927036e-01,
-		6.715589548e-01,
-		6.669999223e-01,
-		6.624157776e-01,
-		6.578066933e-01,
-		6.531728430e-01,
-		6.485144010e-01,
-		6.438315429e-01,
-		6.391244449e-01,
-		6.343932842e-01,
-		6.296382389e-01,
-		6.248594881e-01,
-		6.200572118e-01,
-		6.152315906e-01,
-		6.103828063e-01,
-		6.055110414e-01,
-		6.006164794e-01,
-		5.956993045e-01,
-		5.907597019e-01,
-		5.857978575e-01,
-		5.808139581e-01,
-		5.758081914e-01,
-		5.707807459e-01,
-		5.657318108e-01,
-		5.606615762e-01,
-		5.555702330e-01,
-		5.504579729e-01,
-		5.453249884e-01,
-		5.401714727e-01,
-		5.349976199e-01,
-		5.298036247e-01,
-		5.245896827e-01,
-		5.193559902e-01,
-		5.141027442e-01,
-		5.088301425e-01,
-		5.035383837e-01,
-		4.982276670e-01,
-		4.928981922e-01,
-		4.875501601e-01,
-		4.821837721e-01,
-		4.767992301e-01,
-		4.713967368e-01,
-		4.659764958e-01,
-		4.605387110e-01,
-		4.550835871e-01,
-		4.496113297e-01,
-		4.441221446e-01,
-		4.386162385e-01,
-		4.330938189e-01,
-		4.275550934e-01,
-		4.220002708e-01,
-		4.164295601e-01,
-		4.108431711e-01,
-		4.052413140e-01,
-		3.996241998e-01,
-		3.939920401e-01,
-		3.883450467e-01,
-		3.826834324e-01,
-		3.770074102e-01,
-		3.713171940e-01,
-		3.656129978e-01,
-		3.598950365e-01,
-		3.541635254e-01,
-		3.484186802e-01,
-		3.426607173e-01,
-		3.368898534e-01,
-		3.311063058e-01,
-		3.253102922e-01,
-		3.195020308e-01,
-		3.136817404e-01,
-		3.078496400e-01,
-		3.020059493e-01,
-		2.961508882e-01,
-		2.902846773e-01,
-		2.844075372e-01,
-		2.785196894e-01,
-		2.726213554e-01,
-		2.667127575e-01,
-		2.607941179e-01,
-		2.548656596e-01,
-		2.489276057e-01,
-		2.429801799e-01,
-		2.370236060e-01,
-		2.310581083e-01,
-		2.250839114e-01,
-		2.191012402e-01,
-		2.131103199e-01,
-		2.071113762e-01,
-		2.011046348e-01,
-		1.950903220e-01,
-		1.890686641e-01,
-		1.830398880e-01,
-		1.770042204e-01,
-		1.709618888e-01,
-		1.649131205e-01,
-		1.588581433e-01,
-		1.527971853e-01,
-		1.467304745e-01,
-		1.406582393e-01,
-		1.345807085e-01,
-		1.284981108e-01,
-		1.224106752e-01,
-		1.163186309e-01,
-		1.102222073e-01,
-		1.041216339e-01,
-		9.801714033e-02,
-		9.190895650e-02,
-		8.579731234e-02,
-		7.968243797e-02,
-		7.356456360e-02,
-		6.744391956e-02,
-		6.132073630e-02,
-		5.519524435e-02,
-		4.906767433e-02,
-		4.293825693e-02,
-		3.680722294e-02,
-		3.067480318e-02,
-		2.454122852e-02,
-		1.840672991e-02,
-		1.227153829e-02,
-		6.135884649e-03,
-		1.224646799e-16,
-		-6.135884649e-03,
-		-1.227153829e-02,
-		-1.840672991e-02,
-		-2.454122852e-02,
-		-3.067480318e-02,
-		-3.680722294e-02,
-		-4.293825693e-02,
-		-4.906767433e-02,
-		-5.519524435e-02,
-		-6.132073630e-02,
-		-6.744391956e-02,
-		-7.356456360e-02,
-		-7.968243797e-02,
-		-8.579731234e-02,
-		-9.190895650e-02,
-		-9.801714033e-02,
-		-1.041216339e-01,
-		-1.102222073e-01,
-		-1.163186309e-01,
-		-1.224106752e-01,
-		-1.284981108e-01,
-		-1.345807085e-01,
-		-1.406582393e-01,
-		-1.467304745e-01,
-		-1.527971853e-01,
-		-1.588581433e-01,
-		-1.649131205e-01,
-		-1.709618888e-01,
-		-1.770042204e-01,
-		-1.830398880e-01,
-		-1.890686641e-01,
-		-1.950903220e-01,
-		-2.011046348e-01,
-		-2.071113762e-01,
-		-2.131103199e-01,
-		-2.191012402e-01,
-		-2.250839114e-01,
-		-2.310581083e-01,
-		-2.370236060e-01,
-		-2.429801799e-01,
-		-2.489276057e-01,
-		-2.548656596e-01,
-		-2.607941179e-01,
-		-2.667127575e-01,
-		-2.726213554e-01,
-		-2.785196894e-01,
-		-2.844075372e-01,
-		-2.902846773e-01,
-		-2.961508882e-01,
-		-3.020059493e-01,
-		-3.078496400e-01,
-		-3.136817404e-01,
-		-3.195020308e-01,
-		-3.253102922e-01,
-		-3.311063058e-01,
-		-3.368898534e-01,
-		-3.426607173e-01,
-		-3.484186802e-01,
-		-3.541635254e-01,
-		-3.598950365e-01,
-		-3.656129978e-01,
-		-3.713171940e-01,
-		-3.770074102e-01,
-		-3.826834324e-01,
-		-3.883450467e-01,
-		-3.939920401e-01,
-		-3.996241998e-01,
-		-4.052413140e-01,
-		-4.108431711e-01,
-		-4.164295601e-01,
-		-4.220002708e-01,
-		-4.275550934e-01,
-		-4.330938189e-01,
-		-4.386162385e-01,
-		-4.441221446e-01,
-		-4.496113297e-01,
-		-4.550835871e-01,
-		-4.605387110e-01,
-		-4.659764958e-01,
-		-4.713967368e-01,
-		-4.767992301e-01,
-		-4.821837721e-01,
-		-4.875501601e-01,
-		-4.928981922e-01,
-		-4.982276670e-01,
-		-5.035383837e-01,
-		-5.088301425e-01,
-		-5.141027442e-01,
-		-5.193559902e-01,
-		-5.245896827e-01,
-		-5.298036247e-01,
-		-5.349976199e-01,
-		-5.401714727e-01,
-		-5.453249884e-01,
-		-5.504579729e-01,
-		-5.555702330e-01,
-		-5.606615762e-01,
-		-5.657318108e-01,
-		-5.707807459e-01,
-		-5.758081914e-01,
-		-5.808139581e-01,
-		-5.857978575e-01,
-		-5.907597019e-01,
-		-5.956993045e-01,
-		-6.006164794e-01,
-		-6.055110414e-01,
-		-6.103828063e-01,
-		-6.152315906e-01,
-		-6.200572118e-01,
-		-6.248594881e-01,
-		-6.296382389e-01,
-		-6.343932842e-01,
-		-6.391244449e-01,
-		-6.438315429e-01,
-		-6.485144010e-01,
-		-6.531728430e-01,
-		-6.578066933e-01,
-		-6.624157776e-01,
-		-6.669999223e-01,
-		-6.715589548e-01,
-		-6.760927036e-01,
-		-6.806009978e-01,
-		-6.850836678e-01,
-		-6.895405447e-01,
-		-6.939714609e-01,
-		-6.983762494e-01,
-		-7.027547445e-01,
-		-7.071067812e-01,
-		-7.114321957e-01,
-		-7.157308253e-01,
-		-7.200025080e-01,
-		-7.242470830e-01,
-		-7.284643904e-01,
-		-7.326542717e-01,
-		-7.368165689e-01,
-		-7.409511254e-01,
-		-7.450577854e-01,
-		-7.491363945e-01,
-		-7.531867990e-01,
-		-7.572088465e-01,
-		-7.612023855e-01,
-		-7.651672656e-01,
-		-7.691033376e-01,
-		-7.730104534e-01,
-		-7.768884657e-01,
-		-7.807372286e-01,
-		-7.845565972e-01,
-		-7.883464276e-01,
-		-7.921065773e-01,
-		-7.958369046e-01,
-		-7.995372691e-01,
-		-8.032075315e-01,
-		-8.068475535e-01,
-		-8.104571983e-01,
-		-8.140363297e-01,
-		-8.175848132e-01,
-		-8.211025150e-01,
-		-8.245893028e-01,
-		-8.280450453e-01,
-		-8.314696123e-01,
-		-8.348628750e-01,
-		-8.382247056e-01,
-		-8.415549774e-01,
-		-8.448535652e-01,
-		-8.481203448e-01,
-		-8.513551931e-01,
-		-8.545579884e-01,
-		-8.577286100e-01,
-		-8.608669386e-01,
-		-8.639728561e-01,
-		-8.670462455e-01,
-		-8.700869911e-01,
-		-8.730949784e-01,
-		-8.760700942e-01,
-		-8.790122264e-01,
-		-8.819212643e-01,
-		-8.847970984e-01,
-		-8.876396204e-01,
-		-8.904487232e-01,
-		-8.932243012e-01,
-		-8.959662498e-01,
-		-8.986744657e-01,
-		-9.013488470e-01,
-		-9.039892931e-01,
-		-9.065957045e-01,
-		-9.091679831e-01,
-		-9.117060320e-01,
-		-9.142097557e-01,
-		-9.166790599e-01,
-		-9.191138517e-01,
-		-9.215140393e-01,
-		-9.238795325e-01,
-		-9.262102421e-01,
-		-9.285060805e-01,
-		-9.307669611e-01,
-		-9.329927988e-01,
-		-9.351835099e-01,
-		-9.373390119e-01,
-		-9.394592236e-01,
-		-9.415440652e-01,
-		-9.435934582e-01,
-		-9.456073254e-01,
-		-9.475855910e-01,
-		-9.495281806e-01,
-		-9.514350210e-01,
-		-9.533060404e-01,
-		-9.551411683e-01,
-		-9.569403357e-01,
-		-9.587034749e-01,
-		-9.604305194e-01,
-		-9.621214043e-01,
-		-9.637760658e-01,
-		-9.653944417e-01,
-		-9.669764710e-01,
-		-9.685220943e-01,
-		-9.700312532e-01,
-		-9.715038910e-01,
-		-9.729399522e-01,
-		-9.743393828e-01,
-		-9.757021300e-01,
-		-9.770281427e-01,
-		-9.783173707e-01,
-		-9.795697657e-01,
-		-9.807852804e-01,
-		-9.819638691e-01,
-		-9.831054874e-01,
-		-9.842100924e-01,
-		-9.852776424e-01,
-		-9.863080972e-01,
-		-9.873014182e-01,
-		-9.882575677e-01,
-		-9.891765100e-01,
-		-9.900582103e-01,
-		-9.909026354e-01,
-		-9.917097537e-01,
-		-9.924795346e-01,
-		-9.932119492e-01,
-		-9.939069700e-01,
-		-9.945645707e-01,
-		-9.951847267e-01,
-		-9.957674145e-01,
-		-9.963126122e-01,
-		-9.968202993e-01,
-		-9.972904567e-01,
-		-9.977230666e-01,
-		-9.981181129e-01,
-		-9.984755806e-01,
-		-9.987954562e-01,
-		-9.990777278e-01,
-		-9.993223846e-01,
-		-9.995294175e-01,
-		-9.996988187e-01,
-		-9.998305818e-01,
-		-9.999247018e-01,
-		-9.999811753e-01,
-		-1.000000000e+00,
-		-9.999811753e-01,
-		-9.999247018e-01,
-		-9.998305818e-01,
-		-9.996988187e-01,
-		-9.995294175e-01,
-		-9.993223846e-01,
-		-9.990777278e-01,
-		-9.987954562e-01,
-		-9.984755806e-01,
-		-9.981181129e-01,
-		-9.977230666e-01,
-		-9.972904567e-01,
-		-9.968202993e-01,
-		-9.963126122e-01,
-		-9.957674145e-01,
-		-9.951847267e-01,
-		-9.945645707e-01,
-		-9.939069700e-01,
-		-9.932119492e-01,
-		-9.924795346e-01,
-		-9.917097537e-01,
-		-9.909026354e-01,
-		-9.900582103e-01,
-		-9.891765100e-01,
-		-9.882575677e-01,
-		-9.873014182e-01,
-		-9.863080972e-01,
-		-9.852776424e-01,
-		-9.842100924e-01,
-		-9.831054874e-01,
-		-9.819638691e-01,
-		-9.807852804e-01,
-		-9.795697657e-01,
-		-9.783173707e-01,
-		-9.770281427e-01,
-		-9.757021300e-01,
-		-9.743393828e-01,
-		-9.729399522e-01,
-		-9.715038910e-01,
-		-9.700312532e-01,
-		-9.685220943e-01,
-		-9.669764710e-01,
-		-9.653944417e-01,
-		-9.637760658e-01,
-		-9.621214043e-01,
-		-9.604305194e-01,
-		-9.587034749e-01,
-		-9.569403357e-01,
-		-9.551411683e-01,
-		-9.533060404e-01,
-		-9.514350210e-01,
-		-9.495281806e-01,
-		-9.475855910e-01,
-		-9.456073254e-01,
-		-9.435934582e-01,
-		-9.415440652e-01,
-		-9.394592236e-01,
-		-9.373390119e-01,
-		-9.351835099e-01,
-		-9.329927988e-01,
-		-9.307669611e-01,
-		-9.285060805e-01,
-		-9.262102421e-01,
-		-9.238795325e-01,
-		-9.215140393e-01,
-		-9.191138517e-01,
-		-9.166790599e-01,
-		-9.142097557e-01,
-		-9.117060320e-01,
-		-9.091679831e-01,
-		-9.065957045e-01,
-		-9.039892931e-01,
-		-9.013488470e-01,
-		-8.986744657e-01,
-		-8.959662498e-01,
-		-8.932243012e-01,
-		-8.904487232e-01,
-		-8.876396204e-01,
-		-8.847970984e-01,
-		-8.819212643e-01,
-		-8.790122264e-01,
-		-8.760700942e-01,
-		-8.730949784e-01,
-		-8.700869911e-01,
-		-8.670462455e-01,
-		-8.639728561e-01,
-		-8.608669386e-01,
-		-8.577286100e-01,
-		-8.545579884e-01,
-		-8.513551931e-01,
-		-8.481203448e-01,
-		-8.448535652e-01,
-		-8.415549774e-01,
-		-8.382247056e-01,
-		-8.348628750e-01,
-		-8.314696123e-01,
-		-8.280450453e-01,
-		-8.245893028e-01,
-		-8.211025150e-01,
-		-8.175848132e-01,
-		-8.140363297e-01,
-		-8.104571983e-01,
-		-8.068475535e-01,
-		-8.032075315e-01,
-		-7.995372691e-01,
-		-7.958369046e-01,
-		-7.921065773e-01,
-		-7.883464276e-01,
-		-7.845565972e-01,
-		-7.807372286e-01,
-		-7.768884657e-01,
-		-7.730104534e-01,
-		-7.691033376e-01,
-		-7.651672656e-01,
-		-7.612023855e-01,
-		-7.572088465e-01,
-		-7.531867990e-01,
-		-7.491363945e-01,
-		-7.450577854e-01,
-		-7.409511254e-01,
-		-7.368165689e-01,
-		-7.326542717e-01,
-		-7.284643904e-01,
-		-7.242470830e-01,
-		-7.200025080e-01,
-		-7.157308253e-01,
-		-7.114321957e-01,
-		-7.071067812e-01,
-		-7.027547445e-01,
-		-6.983762494e-01,
-		-6.939714609e-01,
-		-6.895405447e-01,
-		-6.850836678e-01,
-		-6.806009978e-01,
-		-6.760927036e-01,
-		-6.715589548e-01,
-		-6.669999223e-01,
-		-6.624157776e-01,
-		-6.578066933e-01,
-		-6.531728430e-01,
-		-6.485144010e-01,
-		-6.438315429e-01,
-		-6.391244449e-01,
-		-6.343932842e-01,
-		-6.296382389e-01,
-		-6.248594881e-01,
-		-6.200572118e-01,
-		-6.152315906e-01,
-		-6.103828063e-01,
-		-6.055110414e-01,
-		-6.006164794e-01,
-		-5.956993045e-01,
-		-5.907597019e-01,
-		-5.857978575e-01,
-		-5.808139581e-01,
-		-5.758081914e-01,
-		-5.707807459e-01,
-		-5.657318108e-01,
-		-5.606615762e-01,
-		-5.555702330e-01,
-		-5.504579729e-01,
-		-5.453249884e-01,
-		-5.401714727e-01,
-		-5.349976199e-01,
-		-5.298036247e-01,
-		-5.245896827e-01,
-		-5.193559902e-01,
-		-5.141027442e-01,
-		-5.088301425e-01,
-		-5.035383837e-01,
-		-4.982276670e-01,
-		-4.928981922e-01,
-		-4.875501601e-01,
-		-4.821837721e-01,
-		-4.767992301e-01,
-		-4.713967368e-01,
-		-4.659764958e-01,
-		-4.605387110e-01,
-		-4.550835871e-01,
-		-4.496113297e-01,
-		-4.441221446e-01,
-		-4.386162385e-01,
-		-4.330938189e-01,
-		-4.275550934e-01,
-		-4.220002708e-01,
-		-4.164295601e-01,
-		-4.108431711e-01,
-		-4.052413140e-01,
-		-3.996241998e-01,
-		-3.939920401e-01,
-		-3.883450467e-01,
-		-3.826834324e-01,
-		-3.770074102e-01,
-		-3.713171940e-01,
-		-3.656129978e-01,
-		-3.598950365e-01,
-		-3.541635254e-01,
-		-3.484186802e-01,
-		-3.426607173e-01,
-		-3.368898534e-01,
-		-3.311063058e-01,
-		-3.253102922e-01,
-		-3.195020308e-01,
-		-3.136817404e-01,
-		-3.078496400e-01,
-		-3.020059493e-01,
-		-2.961508882e-01,
-		-2.902846773e-01,
-		-2.844075372e-01,
-		-2.785196894e-01,
-		-2.726213554e-01,
-		-2.667127575e-01,
-		-2.607941179e-01,
-		-2.548656596e-01,
-		-2.489276057e-01,
-		-2.429801799e-01,
-		-2.370236060e-01,
-		-2.310581083e-01,
-		-2.250839114e-01,
-		-2.191012402e-01,
-		-2.131103199e-01,
-		-2.071113762e-01,
-		-2.011046348e-01,
-		-1.950903220e-01,
-		-1.890686641e-01,
-		-1.830398880e-01,
-		-1.770042204e-01,
-		-1.709618888e-01,
-		-1.649131205e-01,
-		-1.588581433e-01,
-		-1.527971853e-01,
-		-1.467304745e-01,
-		-1.406582393e-01,
-		-1.345807085e-01,
-		-1.284981108e-01,
-		-1.224106752e-01,
-		-1.163186309e-01,
-		-1.102222073e-01,
-		-1.041216339e-01,
-		-9.801714033e-02,
-		-9.190895650e-02,
-		-8.579731234e-02,
-		-7.968243797e-02,
-		-7.356456360e-02,
-		-6.744391956e-02,
-		-6.132073630e-02,
-		-5.519524435e-02,
-		-4.906767433e-02,
-		-4.293825693e-02,
-		-3.680722294e-02,
-		-3.067480318e-02,
-		-2.454122852e-02,
-		-1.840672991e-02,
-		-1.227153829e-02,
-		-6.135884649e-03,
-		-2.449293598e-16,
-		6.135884649e-03,
-		1.227153829e-02,
-		1.840672991e-02,
-		2.454122852e-02,
-		3.067480318e-02,
-		3.680722294e-02,
-		4.293825693e-02,
-		4.906767433e-02,
-		5.519524435e-02,
-		6.132073630e-02,
-		6.744391956e-02,
-		7.356456360e-02,
-		7.968243797e-02,
-		8.579731234e-02,
-		9.190895650e-02,
-		9.801714033e-02,
-		1.041216339e-01,
-		1.102222073e-01,
-		1.163186309e-01,
-		1.224106752e-01,
-		1.284981108e-01,
-		1.345807085e-01,
-		1.406582393e-01,
-		1.467304745e-01,
-		1.527971853e-01,
-		1.588581433e-01,
-		1.649131205e-01,
-		1.709618888e-01,
-		1.770042204e-01,
-		1.830398880e-01,
-		1.890686641e-01,
-		1.950903220e-01,
-		2.011046348e-01,
-		2.071113762e-01,
-		2.131103199e-01,
-		2.191012402e-01,
-		2.250839114e-01,
-		2.310581083e-01,
-		2.370236060e-01,
-		2.429801799e-01,
-		2.489276057e-01,
-		2.548656596e-01,
-		2.607941179e-01,
-		2.667127575e-01,
-		2.726213554e-01,
-		2.785196894e-01,
-		2.844075372e-01,
-		2.902846773e-01,
-		2.961508882e-01,
-		3.020059493e-01,
-		3.078496400e-01,
-		3.136817404e-01,
-		3.195020308e-01,
-		3.253102922e-01,
-		3.311063058e-01,
-		3.368898534e-01,
-		3.426607173e-01,
-		3.484186802e-01,
-		3.541635254e-01,
-		3.598950365e-01,
-		3.656129978e-01,
-		3.713171940e-01,
-		3.770074102e-01,
-		3.826834324e-01,
-		3.883450467e-01,
-		3.939920401e-01,
-		3.996241998e-01,
-		4.052413140e-01,
-		4.108431711e-01,
-		4.164295601e-01,
-		4.220002708e-01,
-		4.275550934e-01,
-		4.330938189e-01,
-		4.386162385e-01,
-		4.441221446e-01,
-		4.496113297e-01,
-		4.550835871e-01,
-		4.605387110e-01,
-		4.659764958e-01,
-		4.713967368e-01,
-		4.767992301e-01,
-		4.821837721e-01,
-		4.875501601e-01,
-		4.928981922e-01,
-		4.982276670e-01,
-		5.035383837e-01,
-		5.088301425e-01,
-		5.141027442e-01,
-		5.193559902e-01,
-		5.245896827e-01,
-		5.298036247e-01,
-		5.349976199e-01,
-		5.401714727e-01,
-		5.453249884e-01,
-		5.504579729e-01,
-		5.555702330e-01,
-		5.606615762e-01,
-		5.657318108e-01,
-		5.707807459e-01,
-		5.758081914e-01,
-		5.808139581e-01,
-		5.857978575e-01,
-		5.907597019e-01,
-		5.956993045e-01,
-		6.006164794e-01,
-		6.055110414e-01,
-		6.103828063e-01,
-		6.152315906e-01,
-		6.200572118e-01,
-		6.248594881e-01,
-		6.296382389e-01,
-		6.343932842e-01,
-		6.391244449e-01,
-		6.438315429e-01,
-		6.485144010e-01,
-		6.531728430e-01,
-		6.578066933e-01,
-		6.624157776e-01,
-		6.669999223e-01,
-		6.715589548e-01,
-		6.760927036e-01,
-		6.806009978e-01,
-		6.850836678e-01,
-		6.895405447e-01,
-		6.939714609e-01,
-		6.983762494e-01,
-		7.027547445e-01,
-		7.071067812e-01,
-		7.114321957e-01,
-		7.157308253e-01,
-		7.200025080e-01,
-		7.242470830e-01,
-		7.284643904e-01,
-		7.326542717e-01,
-		7.368165689e-01,
-		7.409511254e-01,
-		7.450577854e-01,
-		7.491363945e-01,
-		7.531867990e-01,
-		7.572088465e-01,
-		7.612023855e-01,
-		7.651672656e-01,
-		7.691033376e-01,
-		7.730104534e-01,
-		7.768884657e-01,
-		7.807372286e-01,
-		7.845565972e-01,
-		7.883464276e-01,
-		7.921065773e-01,
-		7.958369046e-01,
-		7.995372691e-01,
-		8.032075315e-01,
-		8.068475535e-01,
-		8.104571983e-01,
-		8.140363297e-01,
-		8.175848132e-01,
-		8.211025150e-01,
-		8.245893028e-01,
-		8.280450453e-01,
-		8.314696123e-01,
-		8.348628750e-01,
-		8.382247056e-01,
-		8.415549774e-01,
-		8.448535652e-01,
-		8.481203448e-01,
-		8.513551931e-01,
-		8.545579884e-01,
-		8.577286100e-01,
-		8.608669386e-01,
-		8.639728561e-01,
-		8.670462455e-01,
-		8.700869911e-01,
-		8.730949784e-01,
-		8.760700942e-01,
-		8.790122264e-01,
-		8.819212643e-01,
-		8.847970984e-01,
-		8.876396204e-01,
-		8.904487232e-01,
-		8.932243012e-01,
-		8.959662498e-01,
-		8.986744657e-01,
-		9.013488470e-01,
-		9.039892931e-01,
-		9.065957045e-01,
-		9.091679831e-01,
-		9.117060320e-01,
-		9.142097557e-01,
-		9.166790599e-01,
-		9.191138517e-01,
-		9.215140393e-01,
-		9.238795325e-01,
-		9.262102421e-01,
-		9.285060805e-01,
-		9.307669611e-01,
-		9.329927988e-01,
-		9.351835099e-01,
-		9.373390119e-01,
-		9.394592236e-01,
-		9.415440652e-01,
-		9.435934582e-01,
-		9.456073254e-01,
-		9.475855910e-01,
-		9.495281806e-01,
-		9.514350210e-01,
-		9.533060404e-01,
-		9.551411683e-01,
-		9.569403357e-01,
-		9.587034749e-01,
-		9.604305194e-01,
-		9.621214043e-01,
-		9.637760658e-01,
-		9.653944417e-01,
-		9.669764710e-01,
-		9.685220943e-01,
-		9.700312532e-01,
-		9.715038910e-01,
-		9.729399522e-01,
-		9.743393828e-01,
-		9.757021300e-01,
-		9.770281427e-01,
-		9.783173707e-01,
-		9.795697657e-01,
-		9.807852804e-01,
-		9.819638691e-01,
-		9.831054874e-01,
-		9.842100924e-01,
-		9.852776424e-01,
-		9.863080972e-01,
-		9.873014182e-01,
-		9.882575677e-01,
-		9.891765100e-01,
-		9.900582103e-01,
-		9.909026354e-01,
-		9.917097537e-01,
-		9.924795346e-01,
-		9.932119492e-01,
-		9.939069700e-01,
-		9.945645707e-01,
-		9.951847267e-01,
-		9.957674145e-01,
-		9.963126122e-01,
-		9.968202993e-01,
-		9.972904567e-01,
-		9.977230666e-01,
-		9.981181129e-01,
-		9.984755806e-01,
-		9.987954562e-01,
-		9.990777278e-01,
-		9.993223846e-01,
-		9.995294175e-01,
-		9.996988187e-01,
-		9.998305818e-01,
-		9.999247018e-01,
-		9.999811753e-01,
-		1.000000000e+00,
-	};
-	float const lut_fm_frequency_quantizer[] = {
-		-1.200000000e+01,
-		-1.200000000e+01,
-		-1.200000000e+01,
-		-1.184000000e+01,
-		-1.184000000e+01,
-		-1.184000000e+01,
-		-1.111000000e+01,
-		-1.038000000e+01,
-		-9.650000000e+00,
-		-8.920000000e+00,
-		-8.190000000e+00,
-		-7.460000000e+00,
-		-6.730000000e+00,
-		-6.000000000e+00,
-		-6.000000000e+00,
-		-6.000000000e+00,
-		-5.545511612e+00,
-		-5.091023223e+00,
-		-4.636534835e+00,
-		-4.182046446e+00,
-		-4.182046446e+00,
-		-4.182046446e+00,
-		-3.659290641e+00,
-		-3.136534835e+00,
-		-2.613779029e+00,
-		-2.091023223e+00,
-		-1.568267417e+00,
-		-1.045511612e+00,
-		-5.227558058e-01,
-		0.000000000e+00,
-		0.000000000e+00,
-		0.000000000e+00,
-		1.600000000e-01,
-		1.600000000e-01,
-		1.600000000e-01,
-		8.900000000e-01,
-		1.620000000e+00,
-		2.350000000e+00,
-		3.080000000e+00,
-		3.810000000e+00,
-		4.540000000e+00,
-		5.270000000e+00,
-		6.000000000e+00,
-		6.000000000e+00,
-		6.000000000e+00,
-		6.454488388e+00,
-		6.908976777e+00,
-		7.363465165e+00,
-		7.817953554e+00,
-		7.817953554e+00,
-		7.817953554e+00,
-		8.285529931e+00,
-		8.753106309e+00,
-		9.220682687e+00,
-		9.688259065e+00,
-		9.688259065e+00,
-		9.688259065e+00,
-		1.026619430e+01,
-		1.084412953e+01,
-		1.142206477e+01,
-		1.200000000e+01,
-		1.200000000e+01,
-		1.200000000e+01,
-		1.216000000e+01,
-		1.216000000e+01,
-		1.216000000e+01,
-		1.262977500e+01,
-		1.309955001e+01,
-		1.356932501e+01,
-		1.403910002e+01,
-		1.403910002e+01,
-		1.403910002e+01,
-		1.490761987e+01,
-		1.577613972e+01,
-		1.664465957e+01,
-		1.751317942e+01,
-		1.751317942e+01,
-		1.751317942e+01,
-		1.800000000e+01,
-		1.800000000e+01,
-		1.800000000e+01,
-		1.850977500e+01,
-		1.901955001e+01,
-		1.901955001e+01,
-		1.901955001e+01,
-		1.981795355e+01,
-		1.981795355e+01,
-		1.981795355e+01,
-		2.066386428e+01,
-		2.150977500e+01,
-		2.150977500e+01,
-		2.150977500e+01,
-		2.213233125e+01,
-		2.275488750e+01,
-		2.337744375e+01,
-		2.400000000e+01,
-		2.400000000e+01,
-		2.400000000e+01,
-		2.450977500e+01,
-		2.501955001e+01,
-		2.501955001e+01,
-		2.501955001e+01,
-		2.547403840e+01,
-		2.592852679e+01,
-		2.638301517e+01,
-		2.683750356e+01,
-		2.683750356e+01,
-		2.683750356e+01,
-		2.735032035e+01,
-		2.786313714e+01,
-		2.786313714e+01,
-		2.786313714e+01,
-		2.839735285e+01,
-		2.893156857e+01,
-		2.946578428e+01,
-		3.000000000e+01,
-		3.000000000e+01,
-		3.000000000e+01,
-		3.075000000e+01,
-		3.150000000e+01,
-		3.225000000e+01,
-		3.300000000e+01,
-		3.375000000e+01,
-		3.450000000e+01,
-		3.525000000e+01,
-		3.600000000e+01,
-		3.600000000e+01,
-		3.600000000e+01,
-		3.600000000e+01,
-	};
-	float const lut_fold[] = {
-		-9.980545825e-01,
-		-9.970653772e-01,
-		-9.960649692e-01,
-		-9.950532582e-01,
-		-9.940301939e-01,
-		-9.929957802e-01,
-		-9.919500809e-01,
-		-9.908932239e-01,
-		-9.898254054e-01,
-		-9.887468930e-01,
-		-9.876580288e-01,
-		-9.865592310e-01,
-		-9.854509946e-01,
-		-9.843338912e-01,
-		-9.832085672e-01,
-		-9.820757409e-01,
-		-9.809361977e-01,
-		-9.797907840e-01,
-		-9.786403995e-01,
-		-9.774859869e-01,
-		-9.763285207e-01,
-		-9.751689938e-01,
-		-9.740084017e-01,
-		-9.728477255e-01,
-		-9.716879129e-01,
-		-9.705298570e-01,
-		-9.693743743e-01,
-		-9.682221804e-01,
-		-9.670738649e-01,
-		-9.659298654e-01,
-		-9.647904408e-01,
-		-9.636556431e-01,
-		-9.625252914e-01,
-		-9.613989436e-01,
-		-9.602758714e-01,
-		-9.591550347e-01,
-		-9.580350590e-01,
-		-9.569142144e-01,
-		-9.557903981e-01,
-		-9.546611197e-01,
-		-9.535234911e-01,
-		-9.523742208e-01,
-		-9.512096130e-01,
-		-9.500255727e-01,
-		-9.488176173e-01,
-		-9.475808937e-01,
-		-9.463102039e-01,
-		-9.450000364e-01,
-		-9.436446065e-01,
-		-9.422379038e-01,
-		-9.407737471e-01,
-		-9.392458479e-01,
-		-9.376478811e-01,
-		-9.359735625e-01,
-		-9.342167345e-01,
-		-9.323714562e-01,
-		-9.304321011e-01,
-		-9.283934575e-01,
-		-9.262508342e-01,
-		-9.240001674e-01,
-		-9.216381294e-01,
-		-9.191622368e-01,
-		-9.165709565e-01,
-		-9.138638086e-01,
-		-9.110414630e-01,
-		-9.081058297e-01,
-		-9.050601387e-01,
-		-9.019090092e-01,
-		-8.986585056e-01,
-		-8.953161780e-01,
-		-8.918910851e-01,
-		-8.883937990e-01,
-		-8.848363883e-01,
-		-8.812323792e-01,
-		-8.775966932e-01,
-		-8.739455595e-01,
-		-8.702964016e-01,
-		-8.666676980e-01,
-		-8.630788161e-01,
-		-8.595498195e-01,
-		-8.561012493e-01,
-		-8.527538811e-01,
-		-8.495284571e-01,
-		-8.464453973e-01,
-		-8.435244910e-01,
-		-8.407845708e-01,
-		-8.382431741e-01,
-		-8.359161932e-01,
-		-8.338175206e-01,
-		-8.319586927e-01,
-		-8.303485360e-01,
-		-8.289928229e-01,
-		-8.278939413e-01,
-		-8.270505833e-01,
-		-8.264574602e-01,
-		-8.261050485e-01,
-		-8.259793727e-01,
-		-8.260618323e-01,
-		-8.263290765e-01,
-		-8.267529332e-01,
-		-8.273003972e-01,
-		-8.279336816e-01,
-		-8.286103366e-01,
-		-8.292834393e-01,
-		-8.299018559e-01,
-		-8.304105799e-01,
-		-8.307511441e-01,
-		-8.308621097e-01,
-		-8.306796276e-01,
-		-8.301380721e-01,
-		-8.291707415e-01,
-		-8.277106225e-01,
-		-8.256912103e-01,
-		-8.230473793e-01,
-		-8.197162939e-01,
-		-8.156383519e-01,
-		-8.107581485e-01,
-		-8.050254496e-01,
-		-7.983961624e-01,
-		-7.908332902e-01,
-		-7.823078566e-01,
-		-7.727997861e-01,
-		-7.622987256e-01,
-		-7.508047928e-01,
-		-7.383292372e-01,
-		-7.248949979e-01,
-		-7.105371474e-01,
-		-6.953032052e-01,
-		-6.792533125e-01,
-		-6.624602549e-01,
-		-6.450093250e-01,
-		-6.269980173e-01,
-		-6.085355495e-01,
-		-5.897422068e-01,
-		-5.707485064e-01,
-		-5.516941858e-01,
-		-5.327270153e-01,
-		-5.140014423e-01,
-		-4.956770752e-01,
-		-4.779170191e-01,
-		-4.608860753e-01,
-		-4.447488219e-01,
-		-4.296675951e-01,
-		-4.158003906e-01,
-		-4.032987090e-01,
-		-3.923053718e-01,
-		-3.829523325e-01,
-		-3.753585132e-01,
-		-3.696276948e-01,
-		-3.658464920e-01,
-		-3.640824427e-01,
-		-3.643822430e-01,
-		-3.667701571e-01,
-		-3.712466318e-01,
-		-3.777871433e-01,
-		-3.863413015e-01,
-		-3.968322361e-01,
-		-4.091562858e-01,
-		-4.231830080e-01,
-		-4.387555229e-01,
-		-4.556912047e-01,
-		-4.737827239e-01,
-		-4.927994449e-01,
-		-5.124891750e-01,
-		-5.325802587e-01,
-		-5.527840042e-01,
-		-5.727974254e-01,
-		-5.923062779e-01,
-		-6.109883621e-01,
-		-6.285170609e-01,
-		-6.445650789e-01,
-		-6.588083399e-01,
-		-6.709300033e-01,
-		-6.806245487e-01,
-		-6.876018827e-01,
-		-6.915914142e-01,
-		-6.923460464e-01,
-		-6.896460314e-01,
-		-6.833026329e-01,
-		-6.731615438e-01,
-		-6.591060076e-01,
-		-6.410595911e-01,
-		-6.189885640e-01,
-		-5.929038395e-01,
-		-5.628624373e-01,
-		-5.289684349e-01,
-		-4.913733765e-01,
-		-4.502761195e-01,
-		-4.059220990e-01,
-		-3.586020036e-01,
-		-3.086498600e-01,
-		-2.564405314e-01,
-		-2.023866445e-01,
-		-1.469349657e-01,
-		-9.056225673e-02,
-		-3.377064458e-02,
-		2.291744737e-02,
-		7.896475831e-02,
-		1.338249802e-01,
-		1.869488164e-01,
-		2.377902398e-01,
-		2.858128778e-01,
-		3.304964479e-01,
-		3.713431643e-01,
-		4.078840357e-01,
-		4.396849726e-01,
-		4.663526243e-01,
-		4.875398649e-01,
-		5.029508548e-01,
-		5.123456023e-01,
-		5.155439593e-01,
-		5.124289894e-01,
-		5.029496521e-01,
-		4.871227568e-01,
-		4.650341465e-01,
-		4.368390827e-01,
-		4.027618100e-01,
-		3.630942908e-01,
-		3.181941105e-01,
-		2.684815644e-01,
-		2.144359470e-01,
-		1.565910778e-01,
-		9.553010345e-02,
-		3.187963220e-02,
-		-3.369674102e-02,
-		-1.005054456e-01,
-		-1.678304053e-01,
-		-2.349408810e-01,
-		-3.010995956e-01,
-		-3.655710438e-01,
-		-4.276298873e-01,
-		-4.865693337e-01,
-		-5.417093944e-01,
-		-5.924049204e-01,
-		-6.380533123e-01,
-		-6.781018093e-01,
-		-7.120542597e-01,
-		-7.394772881e-01,
-		-7.600057749e-01,
-		-7.733475770e-01,
-		-7.792874237e-01,
-		-7.776899338e-01,
-		-7.685017108e-01,
-		-7.517524823e-01,
-		-7.275552655e-01,
-		-6.961055475e-01,
-		-6.576794884e-01,
-		-6.126311602e-01,
-		-5.613888527e-01,
-		-5.044504876e-01,
-		-4.423781911e-01,
-		-3.757920909e-01,
-		-3.053634092e-01,
-		-2.318069348e-01,
-		-1.558729654e-01,
-		-7.833881626e-02,
-		0.000000000e+00,
-		7.833881626e-02,
-		1.558729654e-01,
-		2.318069348e-01,
-		3.053634092e-01,
-		3.757920909e-01,
-		4.423781911e-01,
-		5.044504876e-01,
-		5.613888527e-01,
-		6.126311602e-01,
-		6.576794884e-01,
-		6.961055475e-01,
-		7.275552655e-01,
-		7.517524823e-01,
-		7.685017108e-01,
-		7.776899338e-01,
-		7.792874237e-01,
-		7.733475770e-01,
-		7.600057749e-01,
-		7.394772881e-01,
-		7.120542597e-01,
-		6.781018093e-01,
-		6.380533123e-01,
-		5.924049204e-01,
-		5.417093944e-01,
-		4.865693337e-01,
-		4.276298873e-01,
-		3.655710438e-01,
-		3.010995956e-01,
-		2.349408810e-01,
-		1.678304053e-01,
-		1.005054456e-01,
-		3.369674102e-02,
-		-3.187963220e-02,
-		-9.553010345e-02,
-		-1.565910778e-01,
-		-2.144359470e-01,
-		-2.684815644e-01,
-		-3.181941105e-01,
-		-3.630942908e-01,
-		-4.027618100e-01,
-		-4.368390827e-01,
-		-4.650341465e-01,
-		-4.871227568e-01,
-		-5.029496521e-01,
-		-5.124289894e-01,
-		-5.155439593e-01,
-		-5.123456023e-01,
-		-5.029508548e-01,
-		-4.875398649e-01,
-		-4.663526243e-01,
-		-4.396849726e-01,
-		-4.078840357e-01,
-		-3.713431643e-01,
-		-3.304964479e-01,
-		-2.858128778e-01,
-		-2.377902398e-01,
-		-1.869488164e-01,
-		-1.338249802e-01,
-		-7.896475831e-02,
-		-2.291744737e-02,
-		3.377064458e-02,
-		9.056225673e-02,
-		1.469349657e-01,
-		2.023866445e-01,
-		2.564405314e-01,
-		3.086498600e-01,
-		3.586020036e-01,
-		4.059220990e-01,
-		4.502761195e-01,
-		4.913733765e-01,
-		5.289684349e-01,
-		5.628624373e-01,
-		5.929038395e-01,
-		6.189885640e-01,
-		6.410595911e-01,
-		6.591060076e-01,
-		6.731615438e-01,
-		6.833026329e-01,
-		6.896460314e-01,
-		6.923460464e-01,
-		6.915914142e-01,
-		6.876018827e-01,
-		6.806245487e-01,
-		6.709300033e-01,
-		6.588083399e-01,
-		6.445650789e-01,
-		6.285170609e-01,
-		6.109883621e-01,
-		5.923062779e-01,
-		5.727974254e-01,
-		5.527840042e-01,
-		5.325802587e-01,
-		5.124891750e-01,
-		4.927994449e-01,
-		4.737827239e-01,
-		4.556912047e-01,
-		4.387555229e-01,
-		4.231830080e-01,
-		4.091562858e-01,
-		3.968322361e-01,
-		3.863413015e-01,
-		3.777871433e-01,
-		3.712466318e-01,
-		3.667701571e-01,
-		3.643822430e-01,
-		3.640824427e-01,
-		3.658464920e-01,
-		3.696276948e-01,
-		3.753585132e-01,
-		3.829523325e-01,
-		3.923053718e-01,
-		4.032987090e-01,
-		4.158003906e-01,
-		4.296675951e-01,
-		4.447488219e-01,
-		4.608860753e-01,
-		4.779170191e-01,
-		4.956770752e-01,
-		5.140014423e-01,
-		5.327270153e-01,
-		5.516941858e-01,
-		5.707485064e-01,
-		5.897422068e-01,
-		6.085355495e-01,
-		6.269980173e-01,
-		6.450093250e-01,
-		6.624602549e-01,
-		6.792533125e-01,
-		6.953032052e-01,
-		7.105371474e-01,
-		7.248949979e-01,
-		7.383292372e-01,
-		7.508047928e-01,
-		7.622987256e-01,
-		7.727997861e-01,
-		7.823078566e-01,
-		7.908332902e-01,
-		7.983961624e-01,
-		8.050254496e-01,
-		8.107581485e-01,
-		8.156383519e-01,
-		8.197162939e-01,
-		8.230473793e-01,
-		8.256912103e-01,
-		8.277106225e-01,
-		8.291707415e-01,
-		8.301380721e-01,
-		8.306796276e-01,
-		8.308621097e-01,
-		8.307511441e-01,
-		8.304105799e-01,
-		8.299018559e-01,
-		8.292834393e-01,
-		8.286103366e-01,
-		8.279336816e-01,
-		8.273003972e-01,
-		8.267529332e-01,
-		8.263290765e-01,
-		8.260618323e-01,
-		8.259793727e-01,
-		8.261050485e-01,
-		8.264574602e-01,
-		8.270505833e-01,
-		8.278939413e-01,
-		8.289928229e-01,
-		8.303485360e-01,
-		8.319586927e-01,
-		8.338175206e-01,
-		8.359161932e-01,
-		8.382431741e-01,
-		8.407845708e-01,
-		8.435244910e-01,
-		8.464453973e-01,
-		8.495284571e-01,
-		8.527538811e-01,
-		8.561012493e-01,
-		8.595498195e-01,
-		8.630788161e-01,
-		8.666676980e-01,
-		8.702964016e-01,
-		8.739455595e-01,
-		8.775966932e-01,
-		8.812323792e-01,
-		8.848363883e-01,
-		8.883937990e-01,
-		8.918910851e-01,
-		8.953161780e-01,
-		8.986585056e-01,
-		9.019090092e-01,
-		9.050601387e-01,
-		9.081058297e-01,
-		9.110414630e-01,
-		9.138638086e-01,
-		9.165709565e-01,
-		9.191622368e-01,
-		9.216381294e-01,
-		9.240001674e-01,
-		9.262508342e-01,
-		9.283934575e-01,
-		9.304321011e-01,
-		9.323714562e-01,
-		9.342167345e-01,
-		9.359735625e-01,
-		9.376478811e-01,
-		9.392458479e-01,
-		9.407737471e-01,
-		9.422379038e-01,
-		9.436446065e-01,
-		9.450000364e-01,
-		9.463102039e-01,
-		9.475808937e-01,
-		9.488176173e-01,
-		9.500255727e-01,
-		9.512096130e-01,
-		9.523742208e-01,
-		9.535234911e-01,
-		9.546611197e-01,
-		9.557903981e-01,
-		9.569142144e-01,
-		9.580350590e-01,
-		9.591550347e-01,
-		9.602758714e-01,
-		9.613989436e-01,
-		9.625252914e-01,
-		9.636556431e-01,
-		9.647904408e-01,
-		9.659298654e-01,
-		9.670738649e-01,
-		9.682221804e-01,
-		9.693743743e-01,
-		9.705298570e-01,
-		9.716879129e-01,
-		9.728477255e-01,
-		9.740084017e-01,
-		9.751689938e-01,
-		9.763285207e-01,
-		9.774859869e-01,
-		9.786403995e-01,
-		9.797907840e-01,
-		9.809361977e-01,
-		9.820757409e-01,
-		9.832085672e-01,
-		9.843338912e-01,
-		9.854509946e-01,
-		9.865592310e-01,
-		9.876580288e-01,
-		9.887468930e-01,
-		9.898254054e-01,
-		9.908932239e-01,
-		9.919500809e-01,
-		9.929957802e-01,
-		9.940301939e-01,
-		9.950532582e-01,
-		9.960649692e-01,
-		9.970653772e-01,
-		9.980545825e-01,
-		9.990327291e-01,
-		1.000000000e+00,
-		1.000000000e+00,
-	};
-	float const lut_fold_2[] = {
-		1.000000000e+00,
-		9.992967758e-01,
-		9.985815484e-01,
-		9.978540078e-01,
-		9.971138332e-01,
-		9.963606927e-01,
-		9.955942426e-01,
-		9.948141269e-01,
-		9.940199768e-01,
-		9.932114103e-01,
-		9.923880310e-01,
-		9.915494283e-01,
-		9.906951760e-01,
-		9.898248319e-01,
-		9.889379369e-01,
-		9.880340145e-01,
-		9.871125695e-01,
-		9.861730874e-01,
-		9.852150334e-01,
-		9.842378513e-01,
-		9.832409624e-01,
-		9.822237646e-01,
-		9.811856308e-01,
-		9.801259079e-01,
-		9.790439155e-01,
-		9.779389442e-01,
-		9.768102539e-01,
-		9.756570727e-01,
-		9.744785949e-01,
-		9.732739786e-01,
-		9.720423447e-01,
-		9.707827737e-01,
-		9.694943044e-01,
-		9.681759305e-01,
-		9.668265989e-01,
-		9.654452060e-01,
-		9.640305956e-01,
-		9.625815548e-01,
-		9.610968112e-01,
-		9.595750288e-01,
-		9.580148040e-01,
-		9.564146617e-01,
-		9.547730501e-01,
-		9.530883359e-01,
-		9.513587989e-01,
-		9.495826263e-01,
-		9.477579060e-01,
-		9.458826201e-01,
-		9.439546371e-01,
-		9.419717041e-01,
-		9.399314380e-01,
-		9.378313157e-01,
-		9.356686640e-01,
-		9.334406481e-01,
-		9.311442591e-01,
-		9.287763006e-01,
-		9.263333739e-01,
-		9.238118615e-01,
-		9.212079094e-01,
-		9.185174075e-01,
-		9.157359677e-01,
-		9.128589003e-01,
-		9.098811874e-01,
-		9.067974538e-01,
-		9.036019347e-01,
-		9.002884395e-01,
-		8.968503119e-01,
-		8.932803854e-01,
-		8.895709331e-01,
-		8.857136124e-01,
-		8.816994016e-01,
-		8.775185304e-01,
-		8.731603996e-01,
-		8.686134921e-01,
-		8.638652705e-01,
-		8.589020627e-01,
-		8.537089293e-01,
-		8.482695142e-01,
-		8.425658723e-01,
-		8.365782715e-01,
-		8.302849649e-01,
-		8.236619269e-01,
-		8.166825462e-01,
-		8.093172692e-01,
-		8.015331811e-01,
-		7.932935143e-01,
-		7.845570677e-01,
-		7.752775176e-01,
-		7.654025961e-01,
-		7.548731062e-01,
-		7.436217337e-01,
-		7.315716072e-01,
-		7.186345391e-01,
-		7.047088637e-01,
-		6.896767601e-01,
-		6.734009108e-01,
-		6.557202943e-01,
-		6.364448402e-01,
-		6.153485688e-01,
-		5.921606903e-01,
-		5.665539193e-01,
-		5.381289295e-01,
-		5.063933787e-01,
-		4.707331500e-01,
-		4.303722225e-01,
-		3.843155503e-01,
-		3.312659247e-01,
-		2.694998552e-01,
-		1.966767932e-01,
-		1.095358294e-01,
-		3.393987745e-03,
-		-1.040028802e-01,
-		-1.920923242e-01,
-		-2.656393469e-01,
-		-3.279705091e-01,
-		-3.814696578e-01,
-		-4.278897766e-01,
-		-4.685487258e-01,
-		-5.044563616e-01,
-		-5.363995499e-01,
-		-5.650004958e-01,
-		-5.676277376e-01,
-		-5.456089430e-01,
-		-5.216251172e-01,
-		-4.954009254e-01,
-		-4.666070735e-01,
-		-4.348464092e-01,
-		-3.996354923e-01,
-		-3.603798149e-01,
-		-3.163399611e-01,
-		-2.665845916e-01,
-		-2.099238522e-01,
-		-1.448129904e-01,
-		-6.920937281e-02,
-		1.895794740e-02,
-		1.019348852e-01,
-		1.729075540e-01,
-		2.343052184e-01,
-		2.879430943e-01,
-		3.352048344e-01,
-		3.771635871e-01,
-		4.146644691e-01,
-		4.483820782e-01,
-		4.788614349e-01,
-		5.065476686e-01,
-		5.318078998e-01,
-		5.549476117e-01,
-		5.762230650e-01,
-		5.958508275e-01,
-		6.140151734e-01,
-		6.308738858e-01,
-		6.465628523e-01,
-		6.611997355e-01,
-		6.748869294e-01,
-		6.877139581e-01,
-		6.925931401e-01,
-		6.755415987e-01,
-		6.569329565e-01,
-		6.365437238e-01,
-		6.141054921e-01,
-		5.892930521e-01,
-		5.617085284e-01,
-		5.308598832e-01,
-		4.961313087e-01,
-		4.567416977e-01,
-		4.116851906e-01,
-		3.596440735e-01,
-		2.988577649e-01,
-		2.269196964e-01,
-		1.404511108e-01,
-		3.455499060e-02,
-		-8.308691439e-02,
-		-1.798594632e-01,
-		-2.595549970e-01,
-		-3.263272740e-01,
-		-3.830839556e-01,
-		-4.319212812e-01,
-		-4.743886570e-01,
-		-5.116560503e-01,
-		-5.446234410e-01,
-		-5.739944533e-01,
-		-6.003271365e-01,
-		-6.109475507e-01,
-		-5.895686806e-01,
-		-5.661619434e-01,
-		-5.404244477e-01,
-		-5.119898195e-01,
-		-4.804106515e-01,
-		-4.451347882e-01,
-		-4.054727657e-01,
-		-3.605522997e-01,
-		-3.092533873e-01,
-		-2.501136501e-01,
-		-1.811866822e-01,
-		-9.982372580e-02,
-		-2.325458569e-03,
-		9.596728942e-02,
-		1.779431078e-01,
-		2.473476588e-01,
-		3.068667711e-01,
-		3.584720417e-01,
-		4.036434517e-01,
-		4.435136052e-01,
-		4.789639990e-01,
-		5.106909591e-01,
-		5.392518362e-01,
-		5.650980300e-01,
-		5.885990231e-01,
-		6.100601564e-01,
-		6.297359696e-01,
-		6.478403436e-01,
-		6.645543074e-01,
-		6.585194180e-01,
-		6.406121537e-01,
-		6.211278553e-01,
-		5.998486007e-01,
-		5.765143776e-01,
-		5.508124062e-01,
-		5.223630380e-01,
-		4.907008769e-01,
-		4.552491217e-01,
-		4.152841095e-01,
-		3.698853971e-01,
-		3.178639957e-01,
-		2.576567279e-01,
-		1.871664560e-01,
-		1.035128010e-01,
-		2.628828896e-03,
-		-9.918255595e-02,
-		-1.835455764e-01,
-		-2.545841775e-01,
-		-3.152240342e-01,
-		-3.675927060e-01,
-		-4.132744159e-01,
-		-4.534730876e-01,
-		-4.891200006e-01,
-		-5.209468346e-01,
-		-5.495364245e-01,
-		-5.753587781e-01,
-		-5.987971175e-01,
-		-6.201670260e-01,
-		-6.397307408e-01,
-		-6.255537426e-01,
-		-6.058657960e-01,
-		-5.844073505e-01,
-		-5.609283358e-01,
-		-5.351292603e-01,
-		-5.066483683e-01,
-		-4.750445715e-01,
-		-4.397744409e-01,
-		-4.001606981e-01,
-		-3.553483015e-01,
-		-3.042420289e-01,
-		-2.454157756e-01,
-		-1.769773894e-01,
-		-9.636135435e-02,
-		0.000000000e+00,
-		9.636135435e-02,
-		1.769773894e-01,
-		2.454157756e-01,
-		3.042420289e-01,
-		3.553483015e-01,
-		4.001606981e-01,
-		4.397744409e-01,
-		4.750445715e-01,
-		5.066483683e-01,
-		5.351292603e-01,
-		5.609283358e-01,
-		5.844073505e-01,
-		6.058657960e-01,
-		6.255537426e-01,
-		6.397307408e-01,
-		6.201670260e-01,
-		5.987971175e-01,
-		5.753587781e-01,
-		5.495364245e-01,
-		5.209468346e-01,
-		4.891200006e-01,
-		4.534730876e-01,
-		4.132744159e-01,
-		3.675927060e-01,
-		3.152240342e-01,
-		2.545841775e-01,
-		1.835455764e-01,
-		9.918255595e-02,
-		-2.628828896e-03,
-		-1.035128010e-01,
-		-1.871664560e-01,
-		-2.576567279e-01,
-		-3.178639957e-01,
-		-3.698853971e-01,
-		-4.152841095e-01,
-		-4.552491217e-01,
-		-4.907008769e-01,
-		-5.223630380e-01,
-		-5.508124062e-01,
-		-5.765143776e-01,
-		-5.998486007e-01,
-		-6.211278553e-01,
-		-6.406121537e-01,
-		-6.585194180e-01,
-		-6.645543074e-01,
-		-6.478403436e-01,
-		-6.297359696e-01,
-		-6.100601564e-01,
-		-5.885990231e-01,
-		-5.650980300e-01,
-		-5.392518362e-01,
-		-5.106909591e-01,
-		-4.789639990e-01,
-		-4.435136052e-01,
-		-4.036434517e-01,
-		-3.584720417e-01,
-		-3.068667711e-01,
-		-2.473476588e-01,
-		-1.779431078e-01,
-		-9.596728942e-02,
-		2.325458569e-03,
-		9.982372580e-02,
-		1.811866822e-01,
-		2.501136501e-01,
-		3.092533873e-01,
-		3.605522997e-01,
-		4.054727657e-01,
-		4.451347882e-01,
-		4.804106515e-01,
-		5.119898195e-01,
-		5.404244477e-01,
-		5.661619434e-01,
-		5.895686806e-01,
-		6.109475507e-01,
-		6.003271365e-01,
-		5.739944533e-01,
-		5.446234410e-01,
-		5.116560503e-01,
-		4.743886570e-01,
-		4.319212812e-01,
-		3.830839556e-01,
-		3.263272740e-01,
-		2.595549970e-01,
-		1.798594632e-01,
-		8.308691439e-02,
-		-3.455499060e-02,
-		-1.404511108e-01,
-		-2.269196964e-01,
-		-2.988577649e-01,
-		-3.596440735e-01,
-		-4.116851906e-01,
-		-4.567416977e-01,
-		-4.961313087e-01,
-		-5.308598832e-01,
-		-5.617085284e-01,
-		-5.892930521e-01,
-		-6.141054921e-01,
-		-6.365437238e-01,
-		-6.569329565e-01,
-		-6.755415987e-01,
-		-6.925931401e-01,
-		-6.877139581e-01,
-		-6.748869294e-01,
-		-6.611997355e-01,
-		-6.465628523e-01,
-		-6.308738858e-01,
-		-6.140151734e-01,
-		-5.958508275e-01,
-		-5.762230650e-01,
-		-5.549476117e-01,
-		-5.318078998e-01,
-		-5.065476686e-01,
-		-4.788614349e-01,
-		-4.483820782e-01,
-		-4.146644691e-01,
-		-3.771635871e-01,
-		-3.352048344e-01,
-		-2.879430943e-01,
-		-2.343052184e-01,
-		-1.729075540e-01,
-		-1.019348852e-01,
-		-1.895794740e-02,
-		6.920937281e-02,
-		1.448129904e-01,
-		2.099238522e-01,
-		2.665845916e-01,
-		3.163399611e-01,
-		3.603798149e-01,
-		3.996354923e-01,
-		4.348464092e-01,
-		4.666070735e-01,
-		4.954009254e-01,
-		5.216251172e-01,
-		5.456089430e-01,
-		5.676277376e-01,
-		5.650004958e-01,
-		5.363995499e-01,
-		5.044563616e-01,
-		4.685487258e-01,
-		4.278897766e-01,
-		3.814696578e-01,
-		3.279705091e-01,
-		2.656393469e-01,
-		1.920923242e-01,
-		1.040028802e-01,
-		-3.393987745e-03,
-		-1.095358294e-01,
-		-1.966767932e-01,
-		-2.694998552e-01,
-		-3.312659247e-01,
-		-3.843155503e-01,
-		-4.303722225e-01,
-		-4.707331500e-01,
-		-5.063933787e-01,
-		-5.381289295e-01,
-		-5.665539193e-01,
-		-5.921606903e-01,
-		-6.153485688e-01,
-		-6.364448402e-01,
-		-6.557202943e-01,
-		-6.734009108e-01,
-		-6.896767601e-01,
-		-7.047088637e-01,
-		-7.186345391e-01,
-		-7.315716072e-01,
-		-7.436217337e-01,
-		-7.548731062e-01,
-		-7.654025961e-01,
-		-7.752775176e-01,
-		-7.845570677e-01,
-		-7.932935143e-01,
-		-8.015331811e-01,
-		-8.093172692e-01,
-		-8.166825462e-01,
-		-8.236619269e-01,
-		-8.302849649e-01,
-		-8.365782715e-01,
-		-8.425658723e-01,
-		-8.482695142e-01,
-		-8.537089293e-01,
-		-8.589020627e-01,
-		-8.638652705e-01,
-		-8.686134921e-01,
-		-8.731603996e-01,
-		-8.775185304e-01,
-		-8.816994016e-01,
-		-8.857136124e-01,
-		-8.895709331e-01,
-		-8.932803854e-01,
-		-8.968503119e-01,
-		-9.002884395e-01,
-		-9.036019347e-01,
-		-9.067974538e-01,
-		-9.098811874e-01,
-		-9.128589003e-01,
-		-9.157359677e-01,
-		-9.185174075e-01,
-		-9.212079094e-01,
-		-9.238118615e-01,
-		-9.263333739e-01,
-		-9.287763006e-01,
-		-9.311442591e-01,
-		-9.334406481e-01,
-		-9.356686640e-01,
-		-9.378313157e-01,
-		-9.399314380e-01,
-		-9.419717041e-01,
-		-9.439546371e-01,
-		-9.458826201e-01,
-		-9.477579060e-01,
-		-9.495826263e-01,
-		-9.513587989e-01,
-		-9.530883359e-01,
-		-9.547730501e-01,
-		-9.564146617e-01,
-		-9.580148040e-01,
-		-9.595750288e-01,
-		-9.610968112e-01,
-		-9.625815548e-01,
-		-9.640305956e-01,
-		-9.654452060e-01,
-		-9.668265989e-01,
-		-9.681759305e-01,
-		-9.694943044e-01,
-		-9.707827737e-01,
-		-9.720423447e-01,
-		-9.732739786e-01,
-		-9.744785949e-01,
-		-9.756570727e-01,
-		-9.768102539e-01,
-		-9.779389442e-01,
-		-9.790439155e-01,
-		-9.801259079e-01,
-		-9.811856308e-01,
-		-9.822237646e-01,
-		-9.832409624e-01,
-		-9.842378513e-01,
-		-9.852150334e-01,
-		-9.861730874e-01,
-		-9.871125695e-01,
-		-9.880340145e-01,
-		-9.889379369e-01,
-		-9.898248319e-01,
-		-9.906951760e-01,
-		-9.915494283e-01,
-		-9.923880310e-01,
-		-9.932114103e-01,
-		-9.940199768e-01,
-		-9.948141269e-01,
-		-9.955942426e-01,
-		-9.963606927e-01,
-		-9.971138332e-01,
-		-9.978540078e-01,
-		-9.985815484e-01,
-		-9.992967758e-01,
-		-1.000000000e+00,
-		-1.000691521e+00,
-		-1.001371627e+00,
-		-1.001371627e+00,
-	};
-	float const lut_stiffness[] = {
-		-6.250000000e-02,
-		-5.859375000e-02,
-		-5.468750000e-02,
-		-5.078125000e-02,
-		-4.687500000e-02,
-		-4.296875000e-02,
-		-3.906250000e-02,
-		-3.515625000e-02,
-		-3.125000000e-02,
-		-2.734375000e-02,
-		-2.343750000e-02,
-		-1.953125000e-02,
-		-1.562500000e-02,
-		-1.171875000e-02,
-		-7.812500000e-03,
-		-3.906250000e-03,
-		0.000000000e+00,
-		0.000000000e+00,
-		0.000000000e+00,
-		0.000000000e+00,
-		1.009582073e-03,
-		2.416076364e-03,
-		4.002252878e-03,
-		5.791066350e-03,
-		7.808404022e-03,
-		1.008346028e-02,
-		1.264915914e-02,
-		1.554263074e-02,
-		1.880574864e-02,
-		2.248573583e-02,
-		2.663584813e-02,
-		3.131614488e-02,
-		3.659435812e-02,
-		4.254687278e-02,
-		4.925983210e-02,
-		5.683038428e-02,
-		6.536808837e-02,
-		7.499649981e-02,
-		8.585495846e-02,
-		9.810060511e-02,
-		1.119106556e-01,
-		1.274849653e-01,
-		1.450489216e-01,
-		1.648567056e-01,
-		1.871949702e-01,
-		2.123869891e-01,
-		2.407973346e-01,
-		2.728371538e-01,
-		3.089701187e-01,
-		3.497191360e-01,
-		3.956739150e-01,
-		4.474995013e-01,
-		5.059459012e-01,
-		5.718589358e-01,
-		6.461924814e-01,
-		7.300222738e-01,
-		8.245614757e-01,
-		9.311782340e-01,
-		1.000037649e+00,
-		1.005639154e+00,
-		1.048005353e+00,
-		1.183990632e+00,
-		1.457101344e+00,
-		2.000000000e+00,
-		2.000000000e+00,
-	};
-	float const lut_svf_shift[] = {
-		7.500000000e-01,
-		7.591880421e-01,
-		7.683455389e-01,
-		7.774424499e-01,
-		7.864497239e-01,
-		7.953397451e-01,
-		8.040867240e-01,
-		8.126670211e-01,
-		8.210593968e-01,
-		8.292451828e-01,
-		8.372083767e-01,
-		8.449356653e-01,
-		8.524163823e-01,
-		8.596424124e-01,
-		8.666080494e-01,
-		8.733098228e-01,
-		8.797462999e-01,
-		8.859178746e-01,
-		8.918265520e-01,
-		8.974757332e-01,
-		9.028700082e-01,
-		9.080149595e-01,
-		9.129169800e-01,
-		9.175831064e-01,
-		9.220208696e-01,
-		9.262381615e-01,
-		9.302431183e-01,
-		9.340440198e-01,
-		9.376492031e-01,
-		9.410669892e-01,
-		9.443056230e-01,
-		9.473732226e-01,
-		9.502777394e-01,
-		9.530269262e-01,
-		9.556283121e-01,
-		9.580891845e-01,
-		9.604165758e-01,
-		9.626172547e-01,
-		9.646977214e-01,
-		9.666642057e-01,
-		9.685226683e-01,
-		9.702788030e-01,
-		9.719380415e-01,
-		9.735055596e-01,
-		9.749862835e-01,
-		9.763848977e-01,
-		9.777058532e-01,
-		9.789533760e-01,
-		9.801314757e-01,
-		9.812439545e-01,
-		9.822944161e-01,
-		9.832862746e-01,
-		9.842227627e-01,
-		9.851069409e-01,
-		9.859417053e-01,
-		9.867297957e-01,
-		9.874738036e-01,
-		9.881761792e-01,
-		9.888392394e-01,
-		9.894651739e-01,
-		9.900560522e-01,
-		9.906138300e-01,
-		9.911403551e-01,
-		9.916373732e-01,
-		9.921065333e-01,
-		9.925493929e-01,
-		9.929674233e-01,
-		9.933620136e-01,
-		9.937344761e-01,
-		9.940860496e-01,
-		9.944179041e-01,
-		9.947311441e-01,
-		9.950268127e-01,
-		9.953058946e-01,
-		9.955693195e-01,
-		9.958179650e-01,
-		9.960526598e-01,
-		9.962741861e-01,
-		9.964832825e-01,
-		9.966806459e-01,
-		9.968669346e-01,
-		9.970427696e-01,
-		9.972087374e-01,
-		9.973653916e-01,
-		9.975132546e-01,
-		9.976528197e-01,
-		9.977845524e-01,
-		9.979088923e-01,
-		9.980262540e-01,
-		9.981370293e-01,
-		9.982415876e-01,
-		9.983402778e-01,
-		9.984334293e-01,
-		9.985213529e-01,
-		9.986043419e-01,
-		9.986826732e-01,
-		9.987566083e-01,
-		9.988263939e-01,
-		9.988922628e-01,
-		9.989544348e-01,
-		9.990131175e-01,
-		9.990685067e-01,
-		9.991207871e-01,
-		9.991701333e-01,
-		9.992167099e-01,
-		9.992606725e-01,
-		9.993021676e-01,
-		9.993413338e-01,
-		9.993783018e-01,
-		9.994131950e-01,
-		9.994461297e-01,
-		9.994772160e-01,
-		9.995065576e-01,
-		9.995342523e-01,
-		9.995603927e-01,
-		9.995850659e-01,
-		9.996083544e-01,
-		9.996303357e-01,
-		9.996510834e-01,
-		9.996706665e-01,
-		9.996891506e-01,
-		9.997065972e-01,
-		9.997230647e-01,
-		9.997386078e-01,
-		9.997532786e-01,
-		9.997671260e-01,
-		9.997801962e-01,
-		9.997925329e-01,
-		9.998041771e-01,
-		9.998151678e-01,
-		9.998255416e-01,
-		9.998353332e-01,
-		9.998445753e-01,
-		9.998532986e-01,
-		9.998615323e-01,
-		9.998693039e-01,
-		9.998766393e-01,
-		9.998835630e-01,
-		9.998900981e-01,
-		9.998962664e-01,
-		9.999020885e-01,
-		9.999075839e-01,
-		9.999127708e-01,
-		9.999176666e-01,
-		9.999222876e-01,
-		9.999266493e-01,
-		9.999307661e-01,
-		9.999346519e-01,
-		9.999383196e-01,
-		9.999417815e-01,
-		9.999450491e-01,
-		9.999481332e-01,
-		9.999510443e-01,
-		9.999537919e-01,
-		9.999563854e-01,
-		9.999588333e-01,
-		9.999611438e-01,
-		9.999633246e-01,
-		9.999653831e-01,
-		9.999673260e-01,
-		9.999691598e-01,
-		9.999708907e-01,
-		9.999725245e-01,
-		9.999740666e-01,
-		9.999755221e-01,
-		9.999768960e-01,
-		9.999781927e-01,
-		9.999794167e-01,
-		9.999805719e-01,
-		9.999816623e-01,
-		9.999826915e-01,
-		9.999836630e-01,
-		9.999845799e-01,
-		9.999854454e-01,
-		9.999862623e-01,
-		9.999870333e-01,
-		9.999877611e-01,
-		9.999884480e-01,
-		9.999890964e-01,
-		9.999897083e-01,
-		9.999902860e-01,
-		9.999908312e-01,
-		9.999913458e-01,
-		9.999918315e-01,
-		9.999922900e-01,
-		9.999927227e-01,
-		9.999931311e-01,
-		9.999935167e-01,
-		9.999938805e-01,
-		9.999942240e-01,
-		9.999945482e-01,
-		9.999948542e-01,
-		9.999951430e-01,
-		9.999954156e-01,
-		9.999956729e-01,
-		9.999959157e-01,
-		9.999961450e-01,
-		9.999963613e-01,
-		9.999965656e-01,
-		9.999967583e-01,
-		9.999969403e-01,
-		9.999971120e-01,
-		9.999972741e-01,
-		9.999974271e-01,
-		9.999975715e-01,
-		9.999977078e-01,
-		9.999978364e-01,
-		9.999979579e-01,
-		9.999980725e-01,
-		9.999981807e-01,
-		9.999982828e-01,
-		9.999983792e-01,
-		9.999984701e-01,
-		9.999985560e-01,
-		9.999986370e-01,
-		9.999987135e-01,
-		9.999987857e-01,
-		9.999988539e-01,
-		9.999989182e-01,
-		9.999989789e-01,
-		9.999990362e-01,
-		9.999990903e-01,
-		9.999991414e-01,
-		9.999991896e-01,
-		9.999992351e-01,
-		9.999992780e-01,
-		9.999993185e-01,
-		9.999993568e-01,
-		9.999993929e-01,
-		9.999994269e-01,
-		9.999994591e-01,
-		9.999994895e-01,
-		9.999995181e-01,
-		9.999995452e-01,
-		9.999995707e-01,
-		9.999995948e-01,
-		9.999996175e-01,
-		9.999996390e-01,
-		9.999996593e-01,
-		9.999996784e-01,
-		9.999996964e-01,
-		9.999997135e-01,
-		9.999997296e-01,
-		9.999997447e-01,
-		9.999997591e-01,
-		9.999997726e-01,
-		9.999997853e-01,
-		9.999997974e-01,
-		9.999998088e-01,
-		9.999998195e-01,
-		9.999998296e-01,
-		9.999998392e-01,
-		9.999998482e-01,
-		9.999998567e-01,
-		9.999998648e-01,
-		9.999998724e-01,
-		9.999998795e-01,
-	};
-
-	float const* lookup_table_table[] = {
-		lut_sine,
-		lut_fm_frequency_quantizer,
-		lut_fold,
-		lut_fold_2,
-		lut_stiffness,
-		lut_svf_shift,
-	};
-
 	const int16_t lut_ws_inverse_tan[] = {
 		-32767,
 		-26872,
@@ -34,25 +34,19 @@
 
 #include "stmlib/stmlib.h"
 
+#include "plaits/dsp/lookup_tables.h"
+
 namespace plaits
 {
 
 	typedef uint8_t ResourceId;
 
-	extern float const* lookup_table_table[];
-
 	extern int16_t const* lookup_table_i16_table[];
 
 	extern int8_t const* lookup_table_i8_table[];
 
 	extern int16_t const* wavetables_table[];
 
-	extern float const lut_sine[];
-	extern float const lut_fm_frequency_quantizer[];
-	extern float const lut_fold[];
-	extern float const lut_fold_2[];
-	extern float const lut_stiffness[];
-	extern float const lut_svf_shift[];
 	extern const int16_t lut_ws_inverse_tan[];
 	extern const int16_t lut_ws_inverse_sin[];
 	extern const int16_t lut_ws_linear[];
@@ -60,18 +54,6 @@ namespace plaits
 	extern const int16_t lut_ws_double_bump[];
 	extern const int8_t lut_lpc_excitation_pulse[];
 	extern const int16_t wav_integrated_waves[];
-	constexpr auto LUT_SINE = 0;
-	constexpr auto LUT_SINE_SIZE = 1281;
-	constexpr auto LUT_FM_FREQUENCY_QUANTIZER = 1;
-	constexpr auto LUT_FM_FREQUENCY_QUANTIZER_SIZE = 129;
-	constexpr auto LUT_FOLD = 2;
-	constexpr auto LUT_FOLD_SIZE = 516;
-	constexpr auto LUT_FOLD_2 = 3;
-	constexpr auto LUT_FOLD_2_SIZE = 516;
-	constexpr auto LUT_STIFFNESS = 4;
-	constexpr auto LUT_STIFFNESS_SIZE = 65;
-	constexpr auto LUT_SVF_SHIFT = 5;
-	constexpr auto LUT_SVF_SHIFT_SIZE = 257;
 	constexpr auto LUT_WS_INVERSE_TAN = 0;
 	constexpr auto LUT_WS_INVERSE_TAN_SIZE = 257;
 	constexpr auto LUT_WS_INVERSE_SIN = 1;
@@ -32,48 +32,13 @@ import scipy.signal
 import numpy
 import pylab
 
-lookup_tables = []
 lookup_tables_i16 = []
 lookup_tables_i8 = []
 
 
-"""----------------------------------------------------------------------------
-Sine table
-----------------------------------------------------------------------------"""
-
-WAVETABLE_SIZE = 1024
-t = numpy.arange(0.0, WAVETABLE_SIZE + WAVETABLE_SIZE / 4 + 1) / WAVETABLE_SIZE
-x = numpy.sin(2 * numpy.pi * t)
-lookup_tables += [('sine', x)]
-
-
-
-"""----------------------------------------------------------------------------
-Quantizer for FM frequencies.
-----------------------------------------------------------------------------"""
-
-fm_frequency_ratios = [ 0.5, 0.5 * 2 ** (16 / 1200.0),
-  numpy.sqrt(2) / 2, numpy.pi / 4, 1.0, 1.0 * 2 ** (16 / 1200.0), numpy.sqrt(2),
-  numpy.pi / 2, 7.0 / 4, 2, 2 * 2 ** (16 / 1200.0), 9.0 / 4, 11.0 / 4,
-  2 * numpy.sqrt(2), 3, numpy.pi, numpy.sqrt(3) * 2, 4, numpy.sqrt(2) * 3,
-  numpy.pi * 3 / 2, 5, numpy.sqrt(2) * 4, 8]
-
-scale = []
-for ratio in fm_frequency_ratios:
-  ratio = 12 * numpy.log2(ratio)
-  scale.extend([ratio, ratio, ratio])
-
-target_size = int(2 ** numpy.ceil(numpy.log2(len(scale))))
-while len(scale) < target_size:
-  gap = numpy.argmax(numpy.diff(scale))
-  scale = scale[:gap + 1] + [(scale[gap] + scale[gap + 1]) / 2] + \
-      scale[gap + 1:]
-
-scale.append(scale[-1])
-
-lookup_tables.append(
-    ('fm_frequency_quantizer', scale)
-)
+# The float tables (sine, FM frequency quantizer, wavefolders, stiffness and
+# SVF delay compensation) are computed at compile time, see
+# plaits/dsp/lookup_tables.h.
 
 
 
@@ -105,76 +70,6 @@ lookup_tables_i16.append(('ws_bump', flip(bump)))
 lookup_tables_i16.append(('ws_double_bump', flip(double_bump)))
 lookup_tables_i16.append(('ws_double_bump_sentinel', flip(double_bump)))
 
-WAVESHAPER_SIZE = 512
-
-x = numpy.arange(0, WAVESHAPER_SIZE + 4) / (WAVESHAPER_SIZE / 2.0) - 1.0
-x[-1] = x[-2]
-sine = numpy.sin(8 * numpy.pi * x)
-window = numpy.exp(-x * x * 4) ** 2
-bipolar_fold = sine * window + numpy.arctan(3 * x) * (1 - window)
-bipolar_fold /= numpy.abs(bipolar_fold).max()
-lookup_tables.append(('fold', bipolar_fold))
-
-
-def deadband(v_in, r_in, r_load, r_fb=150.0e3, v_sat=10.47):
-  v_out = -r_fb / r_in * v_in
-  v_out[v_out >= v_sat] = v_sat
-  v_out[v_out < -v_sat] = -v_sat
-  return (v_in * r_fb * r_load + v_out * r_in * r_load) / (r_fb * r_load + r_in * r_load + r_in * r_fb)
-
-
-def diode(x):
-  return 0.7 * x / (0.3 + numpy.abs(x))
-
-v_in = x * 12.0
-stage_1 = deadband(v_in, 10e3, 100e3)
-stage_2 = deadband(v_in, 49.9e3, 44.2e3)
-stage_3 = deadband(v_in, 91e3, 18e3)
-stage_4 = deadband(v_in, 30e3, 71.4e3)
-stage_5 = deadband(v_in, 68e3, 33.0e3)
-
-stage_45 = -33.0 / 71.4 * stage_4 -33.0 / 33.0 * stage_5 - 33.0 / 240.0 * v_in
-v_out = diode(-150.0 / 100.0 * stage_1 -150.0 / 44.2 * stage_2 - 150.0 / 18.0 * stage_3 - 150.0 / 33.0 * stage_45)
-
-lookup_tables.append(('fold_2', v_out / v_out.max()))
-
-
-"""----------------------------------------------------------------------------
-Stiffness table (partial detuning) for modal synthesis and additive synthesis.
-----------------------------------------------------------------------------"""
-
-structure = numpy.arange(0, 65) / 64.0
-stiffness = structure + 0
-for i, g in enumerate(structure):
-  if g < 0.25:
-    g = 0.25 - g
-    stiffness[i] = -g * 0.25
-  elif g < 0.3:
-    stiffness[i] = 0.0
-  elif g < 0.9:
-    g -= 0.3
-    g /= 0.6
-    stiffness[i] = 0.01 * 10 ** (g * 2.005) - 0.01
-  else:
-    g -= 0.9
-    g /= 0.1
-    g *= g
-    stiffness[i] = 1.5 - numpy.cos(g * numpy.pi) / 2.0
-
-stiffness[-1] = 2.0
-stiffness[-2] = 2.0
-lookup_tables += [('stiffness', stiffness)]
-
-
-
-"""----------------------------------------------------------------------------
-Delay compensation factor for SVF
-----------------------------------------------------------------------------"""
-
-ratio = 2.0 ** (numpy.arange(0, 257) / 12.0)
-svf_shift = 1.0 - 2.0 * numpy.arctan(1.0 / ratio) / (2.0 * numpy.pi)
-lookup_tables += [('svf_shift', svf_shift)]
-
 
 
 """----------------------------------------------------------------------------
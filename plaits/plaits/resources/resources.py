@@ -65,6 +65,8 @@ target = 'plaits'
 types = ['uint8_t', 'uint16_t']
 includes = """
 #include "stmlib/stmlib.h"
+
+#include "plaits/dsp/lookup_tables.h"
 """
 
 import lookup_tables
@@ -73,8 +75,6 @@ import wavetables
 create_specialized_manager = True
 
 resources = [
-  (lookup_tables.lookup_tables,
-   'lookup_table', 'LUT', 'float', float, False),
   (lookup_tables.lookup_tables_i16,
    'lookup_table_i16', 'LUT', 'int16_t', int, False),
   (lookup_tables.lookup_tables_i8,
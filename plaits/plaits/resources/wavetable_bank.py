@@ -0,0 +1,98 @@
+#!/usr/bin/python
+#
+# Copyright 2026 Intrets.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+# See http://creativecommons.org/licenses/MIT/ for more information.
+#
+# -----------------------------------------------------------------------------
+#
+# Writes wavetable bank files, to be loaded at runtime by WavetableBank.
+#
+# Usage: wavetable_bank.py [--raw] output.bin input_1.wav [input_2.wav ...]
+#
+# Each input is a mono 16-bit WAV file holding a multiple of 256 samples, one
+# wave per 256 samples. The waves are integrated here, so that the loader can
+# use the bank in place from a mapping of the file. With --raw, they are stored
+# as is and integrated by the loader into memory of its own.
+
+import struct
+import sys
+import wave
+import zlib
+
+import numpy
+
+
+WAVETABLE_SIZE = 256
+INTEGRATED_WAVETABLE_SIZE = WAVETABLE_SIZE + 4
+MAGIC = 'PWTB'
+VERSION = 1
+FORMAT_INTEGRATED = 0
+FORMAT_RAW = 1
+
+
+def read_waves(path):
+  f = wave.open(path, 'rb')
+  assert f.getnchannels() == 1 and f.getsampwidth() == 2
+  data = numpy.frombuffer(f.readframes(f.getnframes()), dtype='<i2')
+  assert len(data) % WAVETABLE_SIZE == 0
+  return list(data.reshape((-1, WAVETABLE_SIZE)))
+
+
+def integrate(wave):
+  # Same processing as WavetableBank::Load() for raw banks, down to the order
+  # of the sums, so that both formats give the same samples.
+  n = WAVETABLE_SIZE
+  wave = numpy.array(wave, dtype=numpy.float64)
+  x = numpy.tile(wave, 2) - numpy.cumsum(wave)[-1] / n
+  peak = numpy.abs(x).max()
+  x = numpy.cumsum(x / peak if peak > 0 else numpy.zeros(2 * n))
+  x -= numpy.cumsum(x)[-1] / (2 * n)
+  x = x[n - 4:n - 4 + INTEGRATED_WAVETABLE_SIZE] * (4 * 32768.0 / n)
+  return numpy.clip(numpy.floor(x + 0.5), -32768, 32767)
+
+
+def write_bank(path, waves, format=FORMAT_INTEGRATED):
+  if format == FORMAT_INTEGRATED:
+    waves = [integrate(wave) for wave in waves]
+  payload = numpy.array(waves, dtype='<i2').tobytes()
+  header = struct.pack(
+      '<4sHHIIII',
+      MAGIC.encode('ascii'),
+      VERSION,
+      format,
+      len(waves),
+      WAVETABLE_SIZE,
+      zlib.crc32(payload) & 0xffffffff,
+      0)
+  open(path, 'wb').write(header + payload)
+
+
+if __name__ == '__main__':
+  args = sys.argv[1:]
+  format = FORMAT_INTEGRATED
+  if args and args[0] == '--raw':
+    format = FORMAT_RAW
+    args = args[1:]
+  waves = []
+  for path in args[1:]:
+    waves += read_waves(path)
+  write_bank(args[0], waves, format)
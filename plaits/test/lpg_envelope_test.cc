@@ -0,0 +1,127 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Renders a voice with a patched level, one sample per call, and by blocks
+// with the level changes given as events: the LPG envelope must follow the
+// level at the same speed, so that both outputs only differ by the
+// interpolation of the LPG gain over the blocks.
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "stmlib/dsp/denormal.h"
+
+#include "plaits/dsp/voice.h"
+
+using namespace plaits;
+using namespace std;
+
+size_t const kArenaSize = 16384;
+size_t const kNumSamples = 48000;
+size_t const kStepDuration = 4800;
+
+// Largest difference between the levels of the outputs, relative to the peak
+// level.
+float const kTolerance = 0.01f;
+
+char arena[2][kArenaSize];
+Voice voice[2];
+
+static float Level(size_t step) {
+	float const levels[] = { 0.0f, 1.0f, 0.3f, 0.0f, 0.8f };
+	return levels[step % (sizeof(levels) / sizeof(levels[0]))];
+}
+
+int main() {
+	for (int i = 0; i < 2; ++i) {
+		stmlib::BufferAllocator allocator(arena[i], kArenaSize);
+		voice[i].Init(&allocator);
+	}
+
+	Patch patch = {};
+	patch.note = 48.0f;
+	patch.harmonics = 0.5f;
+	patch.timbre = 0.5f;
+	patch.morph = 0.5f;
+	patch.samplePeriod = 1.0f / 48000.0f;
+	patch.engine = 0;
+	patch.decay = 0.5f;
+	patch.lpg_colour = 0.5f;
+
+	Modulations modulations = {};
+	modulations.level_patched = true;
+
+	vector<Voice::Frame> reference(kNumSamples);
+	{
+		stmlib::ScopedFlushDenormals flush_denormals;
+		for (size_t i = 0; i < kNumSamples; ++i) {
+			modulations.level = Level(i / kStepDuration);
+			reference[i] = voice[0].Render(patch, modulations);
+		}
+	}
+
+	vector<VoiceEvent> events;
+	for (size_t i = 0; i < kNumSamples; i += kStepDuration) {
+		VoiceEvent e = { i, VOICE_EVENT_LEVEL, Level(i / kStepDuration) };
+		events.push_back(e);
+	}
+	vector<Voice::Frame> blocks(kNumSamples);
+	modulations.level = 0.0f;
+	voice[1].Render(
+	    patch,
+	    modulations,
+	    &events[0],
+	    events.size(),
+	    &blocks[0],
+	    kNumSamples
+	);
+
+	// The level of each block, but for the blocks in which the level steps,
+	// over which the LPG interpolates its gain.
+	float peak = 0.0f;
+	float error = 0.0f;
+	size_t error_position = 0;
+	for (size_t i = 0; i < kNumSamples; i += kBlockSize) {
+		float reference_level = 0.0f;
+		float blocks_level = 0.0f;
+		for (size_t j = i; j < i + kBlockSize; ++j) {
+			reference_level += reference[j].out * reference[j].out;
+			blocks_level += blocks[j].out * blocks[j].out;
+		}
+		reference_level = sqrtf(reference_level / kBlockSize);
+		blocks_level = sqrtf(blocks_level / kBlockSize);
+		peak = max(peak, reference_level);
+		if (i % kStepDuration != 0 && fabsf(blocks_level - reference_level) > error) {
+			error = fabsf(blocks_level - reference_level);
+			error_position = i;
+		}
+	}
+	if (peak == 0.0f || error > kTolerance * peak) {
+		fprintf(stderr, "the levels differ by %f at sample %zu, peak %f\n",
+		    error, error_position, peak);
+		return 1;
+	}
+	return 0;
+}
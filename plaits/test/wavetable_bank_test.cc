@@ -0,0 +1,139 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Opens a raw bank, then an integrated bank holding the waves integrated by
+// the loader: the integrated bank gives the same waves, read straight from the
+// mapping of the file.
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "stmlib/utils/crc32.h"
+
+#include "plaits/dsp/oscillator/wavetable_bank.h"
+
+using namespace plaits;
+using namespace std;
+
+size_t const kNumWaves = 4;
+
+static bool WriteBank(
+    char const* path,
+    WavetableBankFormat format,
+    vector<int16_t> const& samples
+) {
+	size_t const payload_size = samples.size() * sizeof(int16_t);
+	WavetableBankHeader header;
+	header.magic = WavetableBank::kMagic;
+	header.version = WavetableBank::kVersion;
+	header.format = format;
+	header.num_waves = kNumWaves;
+	header.wave_size = WavetableBank::kWaveSize;
+	header.crc = crc32(0, &samples[0], payload_size);
+	header.reserved = 0;
+
+	FILE* fp = fopen(path, "wb");
+	if (!fp) {
+		return false;
+	}
+	bool success = fwrite(&header, sizeof(header), 1, fp) == 1;
+	success = fwrite(&samples[0], payload_size, 1, fp) == 1 && success;
+	return fclose(fp) == 0 && success;
+}
+
+int main() {
+	char path[] = "/tmp/wavetable_bank_test_XXXXXX";
+	int fd = mkstemp(path);
+	if (fd < 0) {
+		return 1;
+	}
+	close(fd);
+
+	// Pulse waves with a growing duty cycle.
+	size_t const n = WavetableBank::kWaveSize;
+	vector<int16_t> raw(kNumWaves * n);
+	for (size_t i = 0; i < raw.size(); ++i) {
+		size_t const wave = i / n;
+		raw[i] = i % n < (wave + 1) * n / (kNumWaves + 2) ? 16000 : -16000;
+	}
+
+	WavetableBank bank;
+	if (!WriteBank(path, WAVETABLE_BANK_FORMAT_RAW, raw) || !bank.Open(path)) {
+		fprintf(stderr, "cannot open the raw bank\n");
+		unlink(path);
+		return 1;
+	}
+	if (bank.mapped()) {
+		fprintf(stderr, "the raw bank is not integrated into memory\n");
+		unlink(path);
+		return 1;
+	}
+	vector<int16_t> integrated;
+	for (size_t i = 0; i < kNumWaves; ++i) {
+		int16_t const* wave = bank.wave(i);
+		integrated.insert(integrated.end(), wave, wave + WavetableBank::kStride);
+	}
+	bank.Close();
+
+	bool success = WriteBank(path, WAVETABLE_BANK_FORMAT_INTEGRATED, integrated) &&
+	    bank.Open(path);
+	if (!success || !bank.mapped() || bank.num_waves() != kNumWaves) {
+		fprintf(stderr, "the integrated bank is not used from the mapping\n");
+		unlink(path);
+		return 1;
+	}
+	for (size_t i = 0; i < integrated.size(); ++i) {
+		size_t const index = i / WavetableBank::kStride;
+		size_t const sample = i % WavetableBank::kStride;
+		if (bank.wave(index)[sample] != integrated[i]) {
+			fprintf(stderr, "wave %zu, sample %zu is %d, expected %d\n",
+			    index, sample, bank.wave(index)[sample], integrated[i]);
+			unlink(path);
+			return 1;
+		}
+	}
+
+	// The mapping is shared with the page cache: a change made to the file
+	// after it has been opened shows through the bank.
+	int16_t const changed = integrated[0] + 1;
+	fd = open(path, O_WRONLY);
+	success = fd >= 0 &&
+	    pwrite(fd, &changed, sizeof(changed), sizeof(WavetableBankHeader)) ==
+	        ssize_t(sizeof(changed));
+	if (fd >= 0) {
+		close(fd);
+	}
+	success = success && bank.wave(0)[0] == changed;
+	bank.Close();
+	unlink(path);
+	if (!success) {
+		fprintf(stderr, "the waves are a copy of the file\n");
+		return 1;
+	}
+	return 0;
+}
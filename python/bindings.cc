@@ -0,0 +1,301 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Helpers shared by the Python bindings of plaits and rings.
+
+#include "bindings.h"
+
+#include <cstring>
+
+namespace bindings {
+
+using namespace std;
+
+/* BufferView */
+
+bool BufferView::Acquire(PyObject* object, bool writable, const char* name) {
+  int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+  if (writable) {
+    flags |= PyBUF_WRITABLE;
+  }
+  if (PyObject_GetBuffer(object, &view_, flags) != 0) {
+    PyErr_Format(
+        PyExc_TypeError,
+        "%s must be a%s C-contiguous float32 buffer",
+        name,
+        writable ? " writable" : "");
+    return false;
+  }
+  acquired_ = true;
+  
+  // Native or little-endian float32 only: the hosts are little-endian.
+  static const char* const kFloatFormats[] = { "f", "<f", "=f", "@f" };
+  const char* format = view_.format ? view_.format : "B";
+  if (view_.itemsize == sizeof(float)) {
+    for (size_t i = 0; i < sizeof(kFloatFormats) / sizeof(kFloatFormats[0]);
+         ++i) {
+      if (!strcmp(format, kFloatFormats[i])) {
+        return true;
+      }
+    }
+  }
+  PyErr_Format(PyExc_TypeError, "%s must hold float32 values", name);
+  return false;
+}
+
+/* Fields */
+
+bool ParseFields(
+    PyObject* dict,
+    const Field* fields,
+    size_t num_fields,
+    void* target) {
+  if (!dict || dict == Py_None) {
+    return true;
+  }
+  if (!PyDict_Check(dict)) {
+    PyErr_SetString(PyExc_TypeError, "parameters must be given as a dict");
+    return false;
+  }
+  
+  PyObject* key;
+  PyObject* value;
+  Py_ssize_t position = 0;
+  while (PyDict_Next(dict, &position, &key, &value)) {
+    const char* name = PyUnicode_Check(key) ? PyUnicode_AsUTF8(key) : NULL;
+    const Field* field = NULL;
+    for (size_t i = 0; name && i < num_fields; ++i) {
+      if (!strcmp(fields[i].name, name)) {
+        field = &fields[i];
+      }
+    }
+    if (!field) {
+      PyErr_Format(PyExc_KeyError, "unknown parameter %R", key);
+      return false;
+    }
+    
+    uint8_t* destination = static_cast<uint8_t*>(target) + field->offset;
+    switch (field->type) {
+      case FIELD_FLOAT:
+        {
+          double v = PyFloat_AsDouble(value);
+          if (v == -1.0 && PyErr_Occurred()) {
+            return false;
+          }
+          *reinterpret_cast<float*>(destination) = static_cast<float>(v);
+        }
+        break;
+        
+      case FIELD_INT:
+        {
+          long v = PyLong_AsLong(value);
+          if (v == -1 && PyErr_Occurred()) {
+            return false;
+          }
+          *reinterpret_cast<int32_t*>(destination) = static_cast<int32_t>(v);
+        }
+        break;
+        
+      case FIELD_BOOL:
+        {
+          int v = PyObject_IsTrue(value);
+          if (v < 0) {
+            return false;
+          }
+          *reinterpret_cast<bool*>(destination) = v != 0;
+        }
+        break;
+    }
+  }
+  return true;
+}
+
+/* Trajectories */
+
+bool Trajectories::Parse(
+    PyObject* dict,
+    const TrajectoryField* fields,
+    size_t num_fields,
+    size_t num_items) {
+  if (!dict || dict == Py_None) {
+    return true;
+  }
+  if (!PyDict_Check(dict)) {
+    PyErr_SetString(PyExc_TypeError, "trajectories must be given as a dict");
+    return false;
+  }
+  
+  PyObject* key;
+  PyObject* value;
+  Py_ssize_t position = 0;
+  while (PyDict_Next(dict, &position, &key, &value)) {
+    const char* name = PyUnicode_Check(key) ? PyUnicode_AsUTF8(key) : NULL;
+    const TrajectoryField* field = NULL;
+    for (size_t i = 0; name && i < num_fields; ++i) {
+      if (!strcmp(fields[i].name, name)) {
+        field = &fields[i];
+      }
+    }
+    if (!field) {
+      PyErr_Format(PyExc_KeyError, "unknown trajectory %R", key);
+      return false;
+    }
+    
+    views_.push_back(unique_ptr<BufferView>(new BufferView()));
+    BufferView* view = views_.back().get();
+    if (!view->Acquire(value, false, name)) {
+      return false;
+    }
+    if (view->size() % num_items) {
+      PyErr_Format(
+          PyExc_ValueError,
+          "trajectory %s does not hold the same number of points per item",
+          name);
+      return false;
+    }
+    Trajectory t;
+    t.type = field->type;
+    t.trigger = field->trigger;
+    t.data = view->data();
+    t.num_points = view->size() / num_items;
+    trajectories_.push_back(t);
+  }
+  return true;
+}
+
+/* ThreadPool */
+
+void ThreadPool::Start(size_t num_threads) {
+  lock_guard<mutex> run_lock(run_mutex_);
+  StopThreads();
+  if (!num_threads) {
+    num_threads = max(thread::hardware_concurrency(), 1u);
+  }
+  stop_ = false;
+  for (size_t i = 1; i < num_threads; ++i) {
+    threads_.push_back(thread(&ThreadPool::Worker, this, i, generation_));
+  }
+}
+
+void ThreadPool::Stop() {
+  lock_guard<mutex> run_lock(run_mutex_);
+  StopThreads();
+}
+
+void ThreadPool::StopThreads() {
+  {
+    lock_guard<mutex> lock(mutex_);
+    stop_ = true;
+    start_.notify_all();
+  }
+  for (thread& t : threads_) {
+    t.join();
+  }
+  threads_.clear();
+}
+
+void ThreadPool::Drain(size_t worker) {
+  while (true) {
+    size_t index = next_task_.fetch_add(1);
+    if (index >= num_tasks_) {
+      break;
+    }
+    (*task_)(index, worker);
+  }
+}
+
+void ThreadPool::Worker(size_t worker, uint64_t generation) {
+  unique_lock<mutex> lock(mutex_);
+  while (true) {
+    start_.wait(lock, [&] { return stop_ || generation_ != generation; });
+    if (stop_) {
+      break;
+    }
+    generation = generation_;
+    if (worker >= num_workers_) {
+      continue;
+    }
+    
+    lock.unlock();
+    Drain(worker);
+    lock.lock();
+    if (--busy_ == 0) {
+      done_.notify_all();
+    }
+  }
+}
+
+void ThreadPool::Run(
+    size_t num_tasks,
+    const function<void(size_t, size_t)>& task) {
+  lock_guard<mutex> run_lock(run_mutex_);
+  {
+    lock_guard<mutex> lock(mutex_);
+    task_ = &task;
+    num_tasks_ = num_tasks;
+    num_workers_ = min(num_threads(), max(num_tasks, size_t(1)));
+    busy_ = num_workers_ - 1;
+    next_task_ = 0;
+    ++generation_;
+    start_.notify_all();
+  }
+  Drain(0);
+  unique_lock<mutex> lock(mutex_);
+  done_.wait(lock, [this] { return busy_ == 0; });
+}
+
+/* Module functions */
+
+static ThreadPool pool;
+static bool pool_started = false;
+
+ThreadPool* thread_pool() {
+  if (!pool_started) {
+    pool.Start(0);
+    pool_started = true;
+  }
+  return &pool;
+}
+
+PyObject* SetNumThreads(PyObject* /* module */, PyObject* args) {
+  Py_ssize_t num_threads;
+  if (!PyArg_ParseTuple(args, "n:set_num_threads", &num_threads)) {
+    return NULL;
+  }
+  if (num_threads < 0) {
+    PyErr_SetString(PyExc_ValueError, "num_threads must be positive");
+    return NULL;
+  }
+  Py_BEGIN_ALLOW_THREADS
+  pool.Start(num_threads);
+  Py_END_ALLOW_THREADS
+  pool_started = true;
+  Py_RETURN_NONE;
+}
+
+PyObject* NumThreads(PyObject* /* module */, PyObject* /* args */) {
+  return PyLong_FromSize_t(thread_pool()->num_threads());
+}
+
+}  // namespace bindings
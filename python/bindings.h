@@ -0,0 +1,233 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Helpers shared by the Python bindings of plaits and rings.
+//
+// Audio is rendered straight into the memory of the objects given by the
+// caller (NumPy arrays, array.array...), through the buffer protocol. The
+// buffers must be C-contiguous and hold float32 values.
+//
+// Parameter trajectories are dicts mapping a parameter name to a buffer of
+// values, one every stride samples. They are turned into the timestamped
+// events of Voice::Render() and Part::Process(). For batches, the buffer
+// holds the values of all the items one after the other.
+
+#ifndef PYTHON_BINDINGS_H_
+#define PYTHON_BINDINGS_H_
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "stmlib/stmlib.h"
+
+namespace bindings {
+
+template<typename T, size_t size>
+inline size_t arraysize(const T (&)[size]) {
+  return size;
+}
+
+class BufferView {
+ public:
+  BufferView() : acquired_(false) { }
+  ~BufferView() {
+    if (acquired_) {
+      PyBuffer_Release(&view_);
+    }
+  }
+  
+  // Sets a Python exception and returns false if the object is not a
+  // C-contiguous buffer of float32.
+  bool Acquire(PyObject* object, bool writable, const char* name);
+  
+  // NULL and 0 when no buffer was acquired.
+  inline float* data() const {
+    return acquired_ ? static_cast<float*>(view_.buf) : NULL;
+  }
+  inline size_t size() const {
+    return acquired_ ? view_.len / sizeof(float) : 0;
+  }
+
+ private:
+  Py_buffer view_;
+  bool acquired_;
+  
+  DISALLOW_COPY_AND_ASSIGN(BufferView);
+};
+
+enum FieldType {
+  FIELD_FLOAT,
+  FIELD_INT,
+  FIELD_BOOL
+};
+
+// Member of a C++ struct set from a dict.
+struct Field {
+  const char* name;
+  FieldType type;
+  size_t offset;
+};
+
+// Sets the members of target from the entries of a dict (or None). Sets a
+// Python exception and returns false on unknown keys or invalid values.
+bool ParseFields(
+    PyObject* dict,
+    const Field* fields,
+    size_t num_fields,
+    void* target);
+
+// Parameter which can be given as a trajectory, and the type of the event
+// it generates. Triggers only generate an event when their value is above
+// 0.5.
+struct TrajectoryField {
+  const char* name;
+  int type;
+  bool trigger;
+};
+
+struct Trajectory {
+  int type;
+  bool trigger;
+  const float* data;
+  size_t num_points;
+};
+
+class Trajectories {
+ public:
+  Trajectories() { }
+  ~Trajectories() { }
+  
+  // Acquires the buffers of a dict (or None) of trajectories for num_items
+  // items. Sets a Python exception and returns false on errors.
+  bool Parse(
+      PyObject* dict,
+      const TrajectoryField* fields,
+      size_t num_fields,
+      size_t num_items);
+  
+  // Converts the trajectories of an item to events, sorted by time, for a
+  // block of size samples.
+  template<typename Event>
+  void BuildEvents(
+      size_t item,
+      size_t stride,
+      size_t size,
+      std::vector<Event>* events) const {
+    events->clear();
+    size_t num_points = 0;
+    for (const Trajectory& t : trajectories_) {
+      num_points = std::max(num_points, t.num_points);
+    }
+    for (size_t point = 0; point < num_points; ++point) {
+      size_t time = point * stride;
+      if (time >= size) {
+        break;
+      }
+      for (const Trajectory& t : trajectories_) {
+        if (point >= t.num_points) {
+          continue;
+        }
+        float value = t.data[item * t.num_points + point];
+        if (t.trigger && value <= 0.5f) {
+          continue;
+        }
+        Event e;
+        e.time = time;
+        e.type = static_cast<decltype(e.type)>(t.type);
+        e.value = value;
+        events->push_back(e);
+      }
+    }
+  }
+
+ private:
+  std::vector<std::unique_ptr<BufferView> > views_;
+  std::vector<Trajectory> trajectories_;
+  
+  DISALLOW_COPY_AND_ASSIGN(Trajectories);
+};
+
+// Pool of native threads rendering the items of a batch. The thread calling
+// Run() takes part in the work as worker 0.
+class ThreadPool {
+ public:
+  ThreadPool() : stop_(false), generation_(0) { }
+  ~ThreadPool() { Stop(); }
+  
+  // Starts num_threads - 1 threads, stopping the previous ones. 0 uses one
+  // thread per core.
+  void Start(size_t num_threads);
+  void Stop();
+  
+  inline size_t num_threads() const { return threads_.size() + 1; }
+  
+  // Runs task(index, worker) for each index in [0, num_tasks), with
+  // worker in [0, num_threads()). Returns when all the tasks are done. Must
+  // be called without the GIL.
+  void Run(
+      size_t num_tasks,
+      const std::function<void(size_t, size_t)>& task);
+
+ private:
+  void StopThreads();
+  void Worker(size_t worker, uint64_t generation);
+  void Drain(size_t worker);
+  
+  std::vector<std::thread> threads_;
+  
+  std::mutex run_mutex_;
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable done_;
+  bool stop_;
+  uint64_t generation_;
+  
+  const std::function<void(size_t, size_t)>* task_;
+  size_t num_tasks_;
+  size_t num_workers_;
+  size_t busy_;
+  std::atomic<size_t> next_task_;
+  
+  DISALLOW_COPY_AND_ASSIGN(ThreadPool);
+};
+
+// Pool of the module, started on first use.
+ThreadPool* thread_pool();
+
+// set_num_threads() and num_threads() module functions.
+PyObject* SetNumThreads(PyObject* module, PyObject* args);
+PyObject* NumThreads(PyObject* module, PyObject* args);
+
+}  // namespace bindings
+
+#endif  // PYTHON_BINDINGS_H_
@@ -0,0 +1,484 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Python bindings for plaits::Voice.
+//
+// import plaits
+// voice = plaits.Voice()
+// out = numpy.zeros((48000, 2), numpy.float32)  # out and aux channels.
+// voice.render(out, patch={"engine": 8, "note": 60.0},
+//              trajectories={"trigger": numpy.array([1.0], numpy.float32)})
+//
+// plaits.render_batch(out, patches, modulations=None, trajectories=None,
+//                     stride=12) renders one item per patch, each from the
+// state of a freshly initialized voice, into out (num_items * size * 2
+// floats), on the native threads of the module (see set_num_threads()). The GIL is released
+// while rendering.
+
+#include "bindings.h"
+
+#include <cstddef>
+
+#include "stmlib/utils/buffer_allocator.h"
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/dsp/voice.h"
+
+using namespace bindings;
+using namespace plaits;
+using namespace std;
+
+// Size of the RAM shared by the engines, as on the module.
+const size_t kArenaSize = 16384;
+const char* const kArenaOverflow = "the engines do not fit in the arena";
+
+const Field kPatchFields[] = {
+  { "note", FIELD_FLOAT, offsetof(Patch, note) },
+  { "harmonics", FIELD_FLOAT, offsetof(Patch, harmonics) },
+  { "timbre", FIELD_FLOAT, offsetof(Patch, timbre) },
+  { "morph", FIELD_FLOAT, offsetof(Patch, morph) },
+  { "frequency_modulation_amount", FIELD_FLOAT,
+    offsetof(Patch, frequency_modulation_amount) },
+  { "timbre_modulation_amount", FIELD_FLOAT,
+    offsetof(Patch, timbre_modulation_amount) },
+  { "morph_modulation_amount", FIELD_FLOAT,
+    offsetof(Patch, morph_modulation_amount) },
+  { "engine", FIELD_INT, offsetof(Patch, engine) },
+  { "decay", FIELD_FLOAT, offsetof(Patch, decay) },
+  { "lpg_colour", FIELD_FLOAT, offsetof(Patch, lpg_colour) },
+};
+
+const Field kModulationsFields[] = {
+  { "engine", FIELD_FLOAT, offsetof(Modulations, engine) },
+  { "note", FIELD_FLOAT, offsetof(Modulations, note) },
+  { "frequency", FIELD_FLOAT, offsetof(Modulations, frequency) },
+  { "harmonics", FIELD_FLOAT, offsetof(Modulations, harmonics) },
+  { "timbre", FIELD_FLOAT, offsetof(Modulations, timbre) },
+  { "morph", FIELD_FLOAT, offsetof(Modulations, morph) },
+  { "trigger", FIELD_FLOAT, offsetof(Modulations, trigger) },
+  { "level", FIELD_FLOAT, offsetof(Modulations, level) },
+  { "frequency_patched", FIELD_BOOL,
+    offsetof(Modulations, frequency_patched) },
+  { "timbre_patched", FIELD_BOOL, offsetof(Modulations, timbre_patched) },
+  { "morph_patched", FIELD_BOOL, offsetof(Modulations, morph_patched) },
+  { "trigger_patched", FIELD_BOOL, offsetof(Modulations, trigger_patched) },
+  { "level_patched", FIELD_BOOL, offsetof(Modulations, level_patched) },
+  { "sustain", FIELD_BOOL, offsetof(Modulations, sustain) },
+};
+
+const TrajectoryField kTrajectoryFields[] = {
+  { "trigger", VOICE_EVENT_TRIGGER, true },
+  { "sustain", VOICE_EVENT_SUSTAIN, false },
+  { "engine", VOICE_EVENT_ENGINE, false },
+  { "note", VOICE_EVENT_NOTE, false },
+  { "harmonics", VOICE_EVENT_HARMONICS, false },
+  { "timbre", VOICE_EVENT_TIMBRE, false },
+  { "morph", VOICE_EVENT_MORPH, false },
+  { "level", VOICE_EVENT_LEVEL, false },
+};
+
+static void DefaultPatch(Patch* patch) {
+  patch->note = 48.0f;
+  patch->harmonics = 0.5f;
+  patch->timbre = 0.5f;
+  patch->morph = 0.5f;
+  patch->frequency_modulation_amount = 0.0f;
+  patch->timbre_modulation_amount = 0.0f;
+  patch->morph_modulation_amount = 0.0f;
+  patch->samplePeriod = 1.0f / kSampleRate;
+  patch->engine = 0;
+  patch->decay = 0.5f;
+  patch->lpg_colour = 0.5f;
+}
+
+static void DefaultModulations(Modulations* modulations) {
+  modulations->engine = 0.0f;
+  modulations->note = 0.0f;
+  modulations->frequency = 0.0f;
+  modulations->harmonics = 0.0f;
+  modulations->timbre = 0.0f;
+  modulations->morph = 0.0f;
+  modulations->trigger = 0.0f;
+  modulations->level = 0.0f;
+  modulations->frequency_patched = false;
+  modulations->timbre_patched = false;
+  modulations->morph_patched = false;
+  modulations->trigger_patched = false;
+  modulations->level_patched = false;
+  modulations->sustain = false;
+  modulations->trigger2 = false;
+}
+
+// A voice with its own engine RAM.
+struct Instance {
+  Voice voice;
+  alignas(stmlib::kCacheLineSize) char arena[kArenaSize];
+  
+  // Returns false when the engines do not fit in the arena.
+  bool Init() {
+    stmlib::BufferAllocator allocator(arena, kArenaSize);
+    voice.Init(&allocator);
+    return voice.arena_failures() == 0;
+  }
+};
+
+// Creates a voice for a worker of render_batch, and saves its state after
+// Init(). Returns false when the engines do not fit in the arena.
+static bool NewBatchInstance(
+    unique_ptr<Instance>* instance,
+    vector<uint8_t>* snapshot) {
+  instance->reset(new Instance());
+  bool fits = (*instance)->Init();
+  snapshot->resize((*instance)->voice.snapshot_size());
+  (*instance)->voice.Snapshot(&(*snapshot)[0], snapshot->size());
+  return fits;
+}
+
+// Checks the size of the output buffer and returns the number of samples
+// per item, or 0 after setting a Python exception.
+static size_t FramesPerItem(const BufferView& out, size_t num_items) {
+  size_t size = out.size() / 2;
+  if (out.size() % 2 || !num_items || size % num_items) {
+    PyErr_SetString(
+        PyExc_ValueError,
+        "out must hold num_items * size frames of 2 floats");
+    return 0;
+  }
+  return size / num_items;
+}
+
+/* Voice */
+
+struct VoiceObject {
+  PyObject_HEAD
+  Instance* instance;
+  Patch patch;
+  Modulations modulations;
+  bool busy;
+};
+
+static int VoiceInit(PyObject* self, PyObject* args, PyObject* kwargs) {
+  VoiceObject* v = reinterpret_cast<VoiceObject*>(self);
+  static const char* kwlist[] = { NULL };
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kwargs, ":Voice", const_cast<char**>(kwlist))) {
+    return -1;
+  }
+  if (!v->instance) {
+    v->instance = new Instance();
+  }
+  if (!v->instance->Init()) {
+    PyErr_SetString(PyExc_MemoryError, kArenaOverflow);
+    return -1;
+  }
+  DefaultPatch(&v->patch);
+  DefaultModulations(&v->modulations);
+  v->busy = false;
+  return 0;
+}
+
+static void VoiceDealloc(PyObject* self) {
+  VoiceObject* v = reinterpret_cast<VoiceObject*>(self);
+  PyTypeObject* type = Py_TYPE(self);
+  delete v->instance;
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+static PyObject* VoiceRender(PyObject* self, PyObject* args, PyObject* kwargs) {
+  VoiceObject* v = reinterpret_cast<VoiceObject*>(self);
+  static const char* kwlist[] = {
+    "out", "patch", "modulations", "trajectories", "stride", NULL
+  };
+  PyObject* out_object;
+  PyObject* patch_object = NULL;
+  PyObject* modulations_object = NULL;
+  PyObject* trajectories_object = NULL;
+  Py_ssize_t stride = kBlockSize;
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kwargs, "O|OOOn:render", const_cast<char**>(kwlist),
+          &out_object, &patch_object, &modulations_object,
+          &trajectories_object, &stride)) {
+    return NULL;
+  }
+  if (!v->instance || v->busy) {
+    PyErr_SetString(PyExc_RuntimeError, "the voice is not available");
+    return NULL;
+  }
+  if (stride <= 0) {
+    PyErr_SetString(PyExc_ValueError, "stride must be positive");
+    return NULL;
+  }
+  
+  BufferView out;
+  Trajectories trajectories;
+  Patch patch = v->patch;
+  Modulations modulations = v->modulations;
+  if (!out.Acquire(out_object, true, "out") ||
+      !ParseFields(
+          patch_object, kPatchFields, arraysize(kPatchFields), &patch) ||
+      !ParseFields(
+          modulations_object, kModulationsFields,
+          arraysize(kModulationsFields), &modulations) ||
+      !trajectories.Parse(
+          trajectories_object, kTrajectoryFields,
+          arraysize(kTrajectoryFields), 1)) {
+    return NULL;
+  }
+  size_t size = FramesPerItem(out, 1);
+  if (!size) {
+    return NULL;
+  }
+  v->patch = patch;
+  v->modulations = modulations;
+  
+  vector<VoiceEvent> events;
+  trajectories.BuildEvents(0, stride, size, &events);
+  
+  v->busy = true;
+  Py_BEGIN_ALLOW_THREADS
+  v->instance->voice.Render(
+      patch,
+      modulations,
+      events.empty() ? NULL : &events[0],
+      events.size(),
+      reinterpret_cast<Voice::Frame*>(out.data()),
+      size);
+  Py_END_ALLOW_THREADS
+  v->busy = false;
+  Py_RETURN_NONE;
+}
+
+static PyObject* VoiceReset(PyObject* self, PyObject* args) {
+  VoiceObject* v = reinterpret_cast<VoiceObject*>(self);
+  if (!v->instance || v->busy) {
+    PyErr_SetString(PyExc_RuntimeError, "the voice is not available");
+    return NULL;
+  }
+  if (!v->instance->Init()) {
+    PyErr_SetString(PyExc_MemoryError, kArenaOverflow);
+    return NULL;
+  }
+  DefaultPatch(&v->patch);
+  DefaultModulations(&v->modulations);
+  Py_RETURN_NONE;
+}
+
+static PyObject* VoiceActiveEngine(PyObject* self, PyObject* args) {
+  VoiceObject* v = reinterpret_cast<VoiceObject*>(self);
+  return PyLong_FromLong(v->instance ? v->instance->voice.active_engine() : -1);
+}
+
+static PyMethodDef voice_methods[] = {
+  { "render", reinterpret_cast<PyCFunction>(VoiceRender),
+    METH_VARARGS | METH_KEYWORDS,
+    "render(out, patch=None, modulations=None, trajectories=None, stride=12)"
+    "\n\nRenders len(out) / 2 frames of out and aux into out. The patch and "
+    "modulations dicts update the settings kept by the voice." },
+  { "reset", VoiceReset, METH_NOARGS,
+    "Reinitializes the voice and its settings." },
+  { "active_engine", VoiceActiveEngine, METH_NOARGS,
+    "Index of the engine used by the last render." },
+  { NULL, NULL, 0, NULL }
+};
+
+static PyType_Slot voice_slots[] = {
+  { Py_tp_doc, const_cast<char*>("Plaits voice.") },
+  { Py_tp_new, reinterpret_cast<void*>(PyType_GenericNew) },
+  { Py_tp_init, reinterpret_cast<void*>(VoiceInit) },
+  { Py_tp_dealloc, reinterpret_cast<void*>(VoiceDealloc) },
+  { Py_tp_methods, voice_methods },
+  { 0, NULL }
+};
+
+static PyType_Spec voice_spec = {
+  "plaits.Voice",
+  sizeof(VoiceObject),
+  0,
+  Py_TPFLAGS_DEFAULT,
+  voice_slots
+};
+
+/* Batch rendering */
+
+static PyObject* RenderBatch(PyObject* module, PyObject* args, PyObject* kwargs) {
+  static const char* kwlist[] = {
+    "out", "patches", "modulations", "trajectories", "stride", NULL
+  };
+  PyObject* out_object;
+  PyObject* patches_object;
+  PyObject* modulations_object = NULL;
+  PyObject* trajectories_object = NULL;
+  Py_ssize_t stride = kBlockSize;
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kwargs, "OO|OOn:render_batch", const_cast<char**>(kwlist),
+          &out_object, &patches_object, &modulations_object,
+          &trajectories_object, &stride)) {
+    return NULL;
+  }
+  if (stride <= 0) {
+    PyErr_SetString(PyExc_ValueError, "stride must be positive");
+    return NULL;
+  }
+  
+  // Everything touching Python objects is done before releasing the GIL.
+  PyObject* patches = PySequence_Fast(patches_object, "patches must be a sequence");
+  if (!patches) {
+    return NULL;
+  }
+  size_t num_items = PySequence_Fast_GET_SIZE(patches);
+  vector<Patch> item_patches(num_items);
+  vector<Modulations> item_modulations(num_items);
+  bool success = true;
+  for (size_t i = 0; success && i < num_items; ++i) {
+    DefaultPatch(&item_patches[i]);
+    DefaultModulations(&item_modulations[i]);
+    success = ParseFields(
+        PySequence_Fast_GET_ITEM(patches, i),
+        kPatchFields, arraysize(kPatchFields), &item_patches[i]);
+  }
+  Py_DECREF(patches);
+  if (!success) {
+    return NULL;
+  }
+  
+  if (modulations_object && modulations_object != Py_None) {
+    PyObject* modulations = PySequence_Fast(
+        modulations_object, "modulations must be a sequence");
+    if (!modulations) {
+      return NULL;
+    }
+    if (size_t(PySequence_Fast_GET_SIZE(modulations)) != num_items) {
+      PyErr_SetString(
+          PyExc_ValueError, "modulations and patches differ in length");
+      success = false;
+    }
+    for (size_t i = 0; success && i < num_items; ++i) {
+      success = ParseFields(
+          PySequence_Fast_GET_ITEM(modulations, i),
+          kModulationsFields, arraysize(kModulationsFields),
+          &item_modulations[i]);
+    }
+    Py_DECREF(modulations);
+    if (!success) {
+      return NULL;
+    }
+  }
+  
+  BufferView out;
+  Trajectories trajectories;
+  if (!out.Acquire(out_object, true, "out") ||
+      !trajectories.Parse(
+          trajectories_object, kTrajectoryFields,
+          arraysize(kTrajectoryFields), max(num_items, size_t(1)))) {
+    return NULL;
+  }
+  if (!num_items) {
+    Py_RETURN_NONE;
+  }
+  size_t size = FramesPerItem(out, num_items);
+  if (!size) {
+    return NULL;
+  }
+  
+  ThreadPool* pool = thread_pool();
+  vector<unique_ptr<Instance> > instances(pool->num_threads());
+  Voice::Frame* frames = reinterpret_cast<Voice::Frame*>(out.data());
+  vector<vector<uint8_t> > snapshots(pool->num_threads());
+  bool fits;
+  
+  Py_BEGIN_ALLOW_THREADS
+  // Voice::Init() does not reset every member of the engines, so each worker
+  // builds its own voice, zero-initialized then initialized, and restores it
+  // to that state before each item: the output does not depend on which
+  // worker renders which item.
+  fits = NewBatchInstance(&instances[0], &snapshots[0]);
+  
+  pool->Run(fits ? num_items : 0, [&](size_t item, size_t worker) {
+    vector<VoiceEvent> events;
+    trajectories.BuildEvents(item, stride, size, &events);
+    if (!instances[worker]) {
+      NewBatchInstance(&instances[worker], &snapshots[worker]);
+    }
+    Instance* instance = instances[worker].get();
+    vector<uint8_t>& snapshot = snapshots[worker];
+    instance->voice.Restore(&snapshot[0], snapshot.size());
+    instance->voice.Render(
+        item_patches[item],
+        item_modulations[item],
+        events.empty() ? NULL : &events[0],
+        events.size(),
+        frames + item * size,
+        size);
+  });
+  Py_END_ALLOW_THREADS
+  if (!fits) {
+    PyErr_SetString(PyExc_MemoryError, kArenaOverflow);
+    return NULL;
+  }
+  Py_RETURN_NONE;
+}
+
+/* Module */
+
+static PyMethodDef plaits_methods[] = {
+  { "render_batch", reinterpret_cast<PyCFunction>(RenderBatch),
+    METH_VARARGS | METH_KEYWORDS,
+    "render_batch(out, patches, modulations=None, trajectories=None, "
+    "stride=12)\n\nRenders one item per patch, each with a new voice, on the "
+    "native threads of the module." },
+  { "set_num_threads", SetNumThreads, METH_VARARGS,
+    "Sets the number of threads used by render_batch (0: one per core)." },
+  { "num_threads", NumThreads, METH_NOARGS,
+    "Number of threads used by render_batch." },
+  { NULL, NULL, 0, NULL }
+};
+
+static PyModuleDef plaits_module = {
+  PyModuleDef_HEAD_INIT,
+  "plaits",
+  "Bindings for the Plaits voice.",
+  -1,
+  plaits_methods,
+  NULL,
+  NULL,
+  NULL,
+  NULL
+};
+
+PyMODINIT_FUNC PyInit_plaits() {
+  PyObject* module = PyModule_Create(&plaits_module);
+  if (!module) {
+    return NULL;
+  }
+  PyObject* voice_type = PyType_FromSpec(&voice_spec);
+  if (!voice_type || PyModule_AddObject(module, "Voice", voice_type) < 0) {
+    Py_XDECREF(voice_type);
+    Py_DECREF(module);
+    return NULL;
+  }
+  PyModule_AddIntConstant(module, "SAMPLE_RATE", kSampleRate);
+  PyModule_AddIntConstant(module, "NUM_ENGINES", kMaxEngines);
+  return module;
+}
@@ -0,0 +1,615 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Python bindings for rings::Part and rings::StringSynthPart.
+//
+// import rings
+// part = rings.Part(model=rings.MODEL_STRING, polyphony=2)
+// out = numpy.zeros(48000, numpy.float32)
+// aux = numpy.zeros(48000, numpy.float32)
+// part.render(out, aux, patch={"brightness": 0.7}, state={"tonic": 36.0},
+//             trajectories={"strum": numpy.array([1.0], numpy.float32)})
+//
+// rings.render_batch(out, aux, patches, states=None, inputs=None,
+//                    trajectories=None, stride=24, model=0, fx=-1,
+//                    polyphony=1) renders one item per patch, each with a
+// freshly initialized part (a StringSynthPart when fx is set), into out and
+// aux (num_items * size floats each), on the native threads of the module
+// (see set_num_threads()). The GIL is released while rendering.
+
+#include "bindings.h"
+
+#include <cstddef>
+
+
+#include "rings/dsp/dsp.h"
+#include "rings/dsp/fx/reverb.h"
+#include "rings/dsp/part.h"
+#include "rings/dsp/part_event.h"
+#include "rings/dsp/string_synth_part.h"
+
+using namespace bindings;
+using namespace rings;
+using namespace std;
+
+const Field kPatchFields[] = {
+  { "structure", FIELD_FLOAT, offsetof(Patch, structure) },
+  { "brightness", FIELD_FLOAT, offsetof(Patch, brightness) },
+  { "damping", FIELD_FLOAT, offsetof(Patch, damping) },
+  { "position", FIELD_FLOAT, offsetof(Patch, position) },
+};
+
+const Field kStateFields[] = {
+  { "strum", FIELD_BOOL, offsetof(PerformanceState, strum) },
+  { "internal_exciter", FIELD_BOOL,
+    offsetof(PerformanceState, internal_exciter) },
+  { "internal_strum", FIELD_BOOL, offsetof(PerformanceState, internal_strum) },
+  { "internal_note", FIELD_BOOL, offsetof(PerformanceState, internal_note) },
+  { "tonic", FIELD_FLOAT, offsetof(PerformanceState, tonic) },
+  { "note", FIELD_FLOAT, offsetof(PerformanceState, note) },
+  { "fm", FIELD_FLOAT, offsetof(PerformanceState, fm) },
+  { "chord", FIELD_INT, offsetof(PerformanceState, chord) },
+};
+
+const TrajectoryField kTrajectoryFields[] = {
+  { "strum", PART_EVENT_STRUM, true },
+  { "note", PART_EVENT_NOTE, false },
+  { "tonic", PART_EVENT_TONIC, false },
+  { "fm", PART_EVENT_FM, false },
+  { "chord", PART_EVENT_CHORD, false },
+  { "structure", PART_EVENT_STRUCTURE, false },
+  { "brightness", PART_EVENT_BRIGHTNESS, false },
+  { "damping", PART_EVENT_DAMPING, false },
+  { "position", PART_EVENT_POSITION, false },
+};
+
+static void DefaultPatch(Patch* patch) {
+  patch->structure = 0.5f;
+  patch->brightness = 0.5f;
+  patch->damping = 0.5f;
+  patch->position = 0.5f;
+}
+
+static void DefaultState(PerformanceState* state) {
+  state->strum = false;
+  state->internal_exciter = true;
+  state->internal_strum = false;
+  state->internal_note = false;
+  state->tonic = 36.0f;
+  state->note = 0.0f;
+  state->fm = 0.0f;
+  state->chord = 0;
+}
+
+// Parts with their own reverb (and chorus, ensemble) buffer. program is the
+// resonator model, or the fx of the string synth.
+//
+// The items of a batch start from the state saved by Save() after Init(),
+// so that their output does not depend on the items previously rendered by
+// the same worker.
+struct PartInstance {
+  static const int32_t kNumPrograms = RESONATOR_MODEL_LAST;
+  static constexpr const char* kProgramName = "model";
+  
+  Part part;
+  uint16_t reverb_buffer[Reverb::kBufferSize];
+  
+  void Init(int32_t program, int32_t polyphony) {
+    fill(&reverb_buffer[0], &reverb_buffer[Reverb::kBufferSize], 0);
+    part.Init(reverb_buffer);
+    part.set_polyphony(polyphony);
+    part.set_model(static_cast<ResonatorModel>(program));
+  }
+  
+  // Part::Init() does not reset all the resonators, so the whole state is
+  // saved.
+  void Save(vector<uint8_t>* state) const {
+    state->resize(part.snapshot_size());
+    part.Snapshot(&(*state)[0], state->size());
+  }
+  
+  void Load(const vector<uint8_t>& state) {
+    part.Restore(&state[0], state.size());
+  }
+};
+
+struct StringSynthInstance {
+  static const int32_t kNumPrograms = FX_LAST;
+  static constexpr const char* kProgramName = "fx";
+  
+  StringSynthPart part;
+  uint16_t reverb_buffer[Reverb::kBufferSize];
+  
+  void Init(int32_t program, int32_t polyphony) {
+    fill(&reverb_buffer[0], &reverb_buffer[Reverb::kBufferSize], 0);
+    part.Init(reverb_buffer);
+    part.set_polyphony(polyphony);
+    part.set_fx(static_cast<FxType>(program));
+    program_ = program;
+    polyphony_ = polyphony;
+  }
+  
+  // StringSynthPart::Init() resets all the state.
+  void Save(vector<uint8_t>* state) const {
+    state->clear();
+  }
+  
+  void Load(const vector<uint8_t>& /* state */) {
+    Init(program_, polyphony_);
+  }
+  
+  int32_t program_;
+  int32_t polyphony_;
+};
+
+// Checks the program and polyphony, and sets a Python exception if they are
+// out of range.
+template<typename Instance>
+static bool CheckSettings(int32_t program, int32_t polyphony) {
+  if (program < 0 || program >= Instance::kNumPrograms) {
+    PyErr_SetString(PyExc_ValueError, "invalid model or fx");
+    return false;
+  }
+  if (polyphony < 1 || polyphony > kMaxPolyphony) {
+    PyErr_SetString(PyExc_ValueError, "polyphony must be between 1 and 4");
+    return false;
+  }
+  return true;
+}
+
+// Acquires the output (and optional input) buffers, and returns the number
+// of samples per item, or 0 after setting a Python exception.
+static size_t AcquireBuffers(
+    PyObject* out_object,
+    PyObject* aux_object,
+    PyObject* input_object,
+    size_t num_items,
+    BufferView* out,
+    BufferView* aux,
+    BufferView* input) {
+  if (!out->Acquire(out_object, true, "out") ||
+      !aux->Acquire(aux_object, true, "aux")) {
+    return 0;
+  }
+  size_t size = out->size();
+  if (aux->size() != size || !num_items || !size || size % num_items) {
+    PyErr_SetString(
+        PyExc_ValueError,
+        "out and aux must both hold num_items * size floats");
+    return 0;
+  }
+  if (input_object && input_object != Py_None) {
+    if (!input->Acquire(input_object, false, "input")) {
+      return 0;
+    }
+    if (input->size() != size) {
+      PyErr_SetString(PyExc_ValueError, "input and out differ in size");
+      return 0;
+    }
+  }
+  return size / num_items;
+}
+
+/* Part and StringSynthPart */
+
+template<typename Instance>
+struct PartObject {
+  PyObject_HEAD
+  Instance* instance;
+  int32_t program;
+  int32_t polyphony;
+  PerformanceState state;
+  Patch patch;
+  bool busy;
+};
+
+template<typename Instance>
+static int PartInit(PyObject* self, PyObject* args, PyObject* kwargs) {
+  PartObject<Instance>* p = reinterpret_cast<PartObject<Instance>*>(self);
+  static const char* kwlist[] = {
+    Instance::kProgramName, "polyphony", NULL
+  };
+  int program = 0;
+  int polyphony = 1;
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kwargs, "|ii", const_cast<char**>(kwlist),
+          &program, &polyphony) ||
+      !CheckSettings<Instance>(program, polyphony)) {
+    return -1;
+  }
+  if (p->busy) {
+    PyErr_SetString(PyExc_RuntimeError, "the part is not available");
+    return -1;
+  }
+  if (!p->instance) {
+    p->instance = new Instance();
+  }
+  p->program = program;
+  p->polyphony = polyphony;
+  p->instance->Init(program, polyphony);
+  DefaultState(&p->state);
+  DefaultPatch(&p->patch);
+  return 0;
+}
+
+template<typename Instance>
+static void PartDealloc(PyObject* self) {
+  PartObject<Instance>* p = reinterpret_cast<PartObject<Instance>*>(self);
+  PyTypeObject* type = Py_TYPE(self);
+  delete p->instance;
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+template<typename Instance>
+static PyObject* PartRender(PyObject* self, PyObject* args, PyObject* kwargs) {
+  PartObject<Instance>* p = reinterpret_cast<PartObject<Instance>*>(self);
+  static const char* kwlist[] = {
+    "out", "aux", "input", "patch", "state", "trajectories", "stride", NULL
+  };
+  PyObject* out_object;
+  PyObject* aux_object;
+  PyObject* input_object = NULL;
+  PyObject* patch_object = NULL;
+  PyObject* state_object = NULL;
+  PyObject* trajectories_object = NULL;
+  Py_ssize_t stride = kDefaultControlBlockSize;
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kwargs, "OO|OOOOn:render", const_cast<char**>(kwlist),
+          &out_object, &aux_object, &input_object, &patch_object,
+          &state_object, &trajectories_object, &stride)) {
+    return NULL;
+  }
+  if (!p->instance || p->busy) {
+    PyErr_SetString(PyExc_RuntimeError, "the part is not available");
+    return NULL;
+  }
+  if (stride <= 0) {
+    PyErr_SetString(PyExc_ValueError, "stride must be positive");
+    return NULL;
+  }
+  
+  BufferView out, aux, input;
+  Trajectories trajectories;
+  Patch patch = p->patch;
+  PerformanceState state = p->state;
+  size_t size = AcquireBuffers(
+      out_object, aux_object, input_object, 1, &out, &aux, &input);
+  if (!size ||
+      !ParseFields(
+          patch_object, kPatchFields, arraysize(kPatchFields), &patch) ||
+      !ParseFields(
+          state_object, kStateFields, arraysize(kStateFields), &state) ||
+      !trajectories.Parse(
+          trajectories_object, kTrajectoryFields,
+          arraysize(kTrajectoryFields), 1)) {
+    return NULL;
+  }
+  
+  // The strum is only passed to this call, the part applies it at its next
+  // control update.
+  p->patch = patch;
+  p->state = state;
+  p->state.strum = false;
+  
+  vector<PartEvent> events;
+  trajectories.BuildEvents(0, stride, size, &events);
+  vector<float> silence;
+  const float* in = input.data();
+  if (!in) {
+    silence.resize(size);
+    in = &silence[0];
+  }
+  
+  p->busy = true;
+  Py_BEGIN_ALLOW_THREADS
+  p->instance->part.Process(
+      state,
+      patch,
+      events.empty() ? NULL : &events[0],
+      events.size(),
+      in,
+      out.data(),
+      aux.data(),
+      size);
+  Py_END_ALLOW_THREADS
+  p->busy = false;
+  Py_RETURN_NONE;
+}
+
+template<typename Instance>
+static PyObject* PartReset(PyObject* self, PyObject* args) {
+  PartObject<Instance>* p = reinterpret_cast<PartObject<Instance>*>(self);
+  if (!p->instance || p->busy) {
+    PyErr_SetString(PyExc_RuntimeError, "the part is not available");
+    return NULL;
+  }
+  p->instance->Init(p->program, p->polyphony);
+  DefaultState(&p->state);
+  DefaultPatch(&p->patch);
+  Py_RETURN_NONE;
+}
+
+template<typename Instance>
+struct PartType {
+  static PyMethodDef methods[];
+  static PyType_Slot slots[];
+};
+
+template<typename Instance>
+PyMethodDef PartType<Instance>::methods[] = {
+  { "render", reinterpret_cast<PyCFunction>(PartRender<Instance>),
+    METH_VARARGS | METH_KEYWORDS,
+    "render(out, aux, input=None, patch=None, state=None, trajectories=None, "
+    "stride=24)\n\nRenders len(out) samples into out and aux. The patch and "
+    "state dicts update the settings kept by the part." },
+  { "reset", PartReset<Instance>, METH_NOARGS,
+    "Reinitializes the part and its settings." },
+  { NULL, NULL, 0, NULL }
+};
+
+template<typename Instance>
+PyType_Slot PartType<Instance>::slots[] = {
+  { Py_tp_new, reinterpret_cast<void*>(PyType_GenericNew) },
+  { Py_tp_init, reinterpret_cast<void*>(PartInit<Instance>) },
+  { Py_tp_dealloc, reinterpret_cast<void*>(PartDealloc<Instance>) },
+  { Py_tp_methods, PartType<Instance>::methods },
+  { 0, NULL }
+};
+
+static PyType_Spec part_spec = {
+  "rings.Part",
+  sizeof(PartObject<PartInstance>),
+  0,
+  Py_TPFLAGS_DEFAULT,
+  PartType<PartInstance>::slots
+};
+
+static PyType_Spec string_synth_part_spec = {
+  "rings.StringSynthPart",
+  sizeof(PartObject<StringSynthInstance>),
+  0,
+  Py_TPFLAGS_DEFAULT,
+  PartType<StringSynthInstance>::slots
+};
+
+/* Batch rendering */
+
+// Parses a sequence of num_items dicts (or None) into items.
+template<typename T>
+static bool ParseItems(
+    PyObject* sequence,
+    const Field* fields,
+    size_t num_fields,
+    const char* name,
+    vector<T>* items) {
+  if (!sequence || sequence == Py_None) {
+    return true;
+  }
+  PyObject* fast = PySequence_Fast(sequence, "expected a sequence of dicts");
+  if (!fast) {
+    return false;
+  }
+  bool success = true;
+  if (size_t(PySequence_Fast_GET_SIZE(fast)) != items->size()) {
+    PyErr_Format(PyExc_ValueError, "%s and patches differ in length", name);
+    success = false;
+  }
+  for (size_t i = 0; success && i < items->size(); ++i) {
+    success = ParseFields(
+        PySequence_Fast_GET_ITEM(fast, i), fields, num_fields, &(*items)[i]);
+  }
+  Py_DECREF(fast);
+  return success;
+}
+
+template<typename Instance>
+static void RenderItems(
+    int32_t program,
+    int32_t polyphony,
+    const vector<Patch>& patches,
+    const vector<PerformanceState>& states,
+    const Trajectories& trajectories,
+    size_t stride,
+    const float* input,
+    float* out,
+    float* aux,
+    size_t size) {
+  ThreadPool* pool = thread_pool();
+  vector<unique_ptr<Instance> > instances(pool->num_threads());
+  vector<float> silence(input ? 0 : size);
+  vector<vector<uint8_t> > initial_states(pool->num_threads());
+  
+  pool->Run(patches.size(), [&](size_t item, size_t worker) {
+    vector<PartEvent> events;
+    trajectories.BuildEvents(item, stride, size, &events);
+    if (!instances[worker]) {
+      // Each worker builds its own part, zero-initialized then initialized,
+      // so that all the workers start from the same state. The state of the
+      // noise generator is kept by the part, and saved with it.
+      instances[worker].reset(new Instance());
+      instances[worker]->Init(program, polyphony);
+      instances[worker]->Save(&initial_states[worker]);
+    }
+    Instance* instance = instances[worker].get();
+    instance->Load(initial_states[worker]);
+    instance->part.Process(
+        states[item],
+        patches[item],
+        events.empty() ? NULL : &events[0],
+        events.size(),
+        input ? input + item * size : &silence[0],
+        out + item * size,
+        aux + item * size,
+        size);
+  });
+}
+
+static PyObject* RenderBatch(PyObject* module, PyObject* args, PyObject* kwargs) {
+  static const char* kwlist[] = {
+    "out", "aux", "patches", "states", "inputs", "trajectories", "stride",
+    "model", "fx", "polyphony", NULL
+  };
+  PyObject* out_object;
+  PyObject* aux_object;
+  PyObject* patches_object;
+  PyObject* states_object = NULL;
+  PyObject* inputs_object = NULL;
+  PyObject* trajectories_object = NULL;
+  Py_ssize_t stride = kDefaultControlBlockSize;
+  int model = 0;
+  int fx = -1;
+  int polyphony = 1;
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kwargs, "OOO|OOOniii:render_batch", const_cast<char**>(kwlist),
+          &out_object, &aux_object, &patches_object, &states_object,
+          &inputs_object, &trajectories_object, &stride, &model, &fx,
+          &polyphony)) {
+    return NULL;
+  }
+  bool string_synth = fx >= 0;
+  if (stride <= 0) {
+    PyErr_SetString(PyExc_ValueError, "stride must be positive");
+    return NULL;
+  }
+  if (string_synth
+      ? !CheckSettings<StringSynthInstance>(fx, polyphony)
+      : !CheckSettings<PartInstance>(model, polyphony)) {
+    return NULL;
+  }
+  
+  // Everything touching Python objects is done before releasing the GIL.
+  Py_ssize_t num_items = PySequence_Size(patches_object);
+  if (num_items < 0) {
+    return NULL;
+  }
+  vector<Patch> patches(num_items);
+  vector<PerformanceState> states(num_items);
+  for (Py_ssize_t i = 0; i < num_items; ++i) {
+    DefaultPatch(&patches[i]);
+    DefaultState(&states[i]);
+  }
+  if (!ParseItems(
+          patches_object, kPatchFields, arraysize(kPatchFields), "patches",
+          &patches) ||
+      !ParseItems(
+          states_object, kStateFields, arraysize(kStateFields), "states",
+          &states)) {
+    return NULL;
+  }
+  if (!num_items) {
+    Py_RETURN_NONE;
+  }
+  
+  BufferView out, aux, input;
+  Trajectories trajectories;
+  size_t size = AcquireBuffers(
+      out_object, aux_object, inputs_object, num_items, &out, &aux, &input);
+  if (!size ||
+      !trajectories.Parse(
+          trajectories_object, kTrajectoryFields,
+          arraysize(kTrajectoryFields), num_items)) {
+    return NULL;
+  }
+  
+  Py_BEGIN_ALLOW_THREADS
+  if (string_synth) {
+    RenderItems<StringSynthInstance>(
+        fx, polyphony, patches, states, trajectories, stride,
+        input.data(), out.data(), aux.data(), size);
+  } else {
+    RenderItems<PartInstance>(
+        model, polyphony, patches, states, trajectories, stride,
+        input.data(), out.data(), aux.data(), size);
+  }
+  Py_END_ALLOW_THREADS
+  Py_RETURN_NONE;
+}
+
+/* Module */
+
+static PyMethodDef rings_methods[] = {
+  { "render_batch", reinterpret_cast<PyCFunction>(RenderBatch),
+    METH_VARARGS | METH_KEYWORDS,
+    "render_batch(out, aux, patches, states=None, inputs=None, "
+    "trajectories=None, stride=24, model=0, fx=-1, polyphony=1)\n\n"
+    "Renders one item per patch, each with a new part, on the native threads "
+    "of the module." },
+  { "set_num_threads", SetNumThreads, METH_VARARGS,
+    "Sets the number of threads used by render_batch (0: one per core)." },
+  { "num_threads", NumThreads, METH_NOARGS,
+    "Number of threads used by render_batch." },
+  { NULL, NULL, 0, NULL }
+};
+
+static PyModuleDef rings_module = {
+  PyModuleDef_HEAD_INIT,
+  "rings",
+  "Bindings for the Rings parts.",
+  -1,
+  rings_methods,
+  NULL,
+  NULL,
+  NULL,
+  NULL
+};
+
+static bool AddType(PyObject* module, const char* name, PyType_Spec* spec) {
+  PyObject* type = PyType_FromSpec(spec);
+  if (!type || PyModule_AddObject(module, name, type) < 0) {
+    Py_XDECREF(type);
+    return false;
+  }
+  return true;
+}
+
+PyMODINIT_FUNC PyInit_rings() {
+  PyObject* module = PyModule_Create(&rings_module);
+  if (!module) {
+    return NULL;
+  }
+  if (!AddType(module, "Part", &part_spec) ||
+      !AddType(module, "StringSynthPart", &string_synth_part_spec)) {
+    Py_DECREF(module);
+    return NULL;
+  }
+  PyModule_AddIntConstant(module, "SAMPLE_RATE", kSampleRate);
+  PyModule_AddIntConstant(module, "MODEL_MODAL", RESONATOR_MODEL_MODAL);
+  PyModule_AddIntConstant(
+      module, "MODEL_SYMPATHETIC_STRING", RESONATOR_MODEL_SYMPATHETIC_STRING);
+  PyModule_AddIntConstant(module, "MODEL_STRING", RESONATOR_MODEL_STRING);
+  PyModule_AddIntConstant(module, "MODEL_FM_VOICE", RESONATOR_MODEL_FM_VOICE);
+  PyModule_AddIntConstant(
+      module, "MODEL_SYMPATHETIC_STRING_QUANTIZED",
+      RESONATOR_MODEL_SYMPATHETIC_STRING_QUANTIZED);
+  PyModule_AddIntConstant(
+      module, "MODEL_STRING_AND_REVERB", RESONATOR_MODEL_STRING_AND_REVERB);
+  PyModule_AddIntConstant(module, "FX_FORMANT", FX_FORMANT);
+  PyModule_AddIntConstant(module, "FX_CHORUS", FX_CHORUS);
+  PyModule_AddIntConstant(module, "FX_REVERB", FX_REVERB);
+  PyModule_AddIntConstant(module, "FX_FORMANT_2", FX_FORMANT_2);
+  PyModule_AddIntConstant(module, "FX_ENSEMBLE", FX_ENSEMBLE);
+  PyModule_AddIntConstant(module, "FX_REVERB_2", FX_REVERB_2);
+  return module;
+}
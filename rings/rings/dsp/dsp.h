@@ -38,7 +38,17 @@ namespace rings {
   
 static const float kSampleRate = 48000.0f;
 const float a3 = 440.0f / kSampleRate;
-const size_t kMaxBlockSize = 24;
+
+// Largest block accepted by Part::Process() and StringSynthPart::Process().
+const size_t kMaxBlockSize = 512;
+
+// The parts update their controls (note filter, envelopes, voice parameters)
+// once per control block. The control blocks run across the blocks given to
+// Process(), which are split at their boundaries, and the effects and limiter
+// run once over the whole block. The module updates its controls every 24
+// samples.
+const size_t kDefaultControlBlockSize = 24;
+const size_t kMaxControlBlockSize = 128;
 
 }  // namespace rings
 
@@ -61,6 +61,8 @@ void FMVoice::Init() {
   modulator_phase_ = 0;
   gain_ = 0.0f;
   fm_amount_ = 0.0f;
+  previous_sample_ = 0.0f;
+  decay_coefficients_.Init();
   
   follower_.Init(
       8.0f / kSampleRate,
@@ -68,15 +70,27 @@ void FMVoice::Init() {
       1600.0f / kSampleRate);
 }
 
-void FMVoice::Process(const float* in, float* out, float* aux, size_t size) {
+void FMVoice::Process(
+    const float* in,
+    float* out,
+    float* aux,
+    size_t size,
+    size_t ramp_size) {
   // Interpolate between the "oscillator" behaviour and the "FMLPGed thing"
   // behaviour.
   float envelope_amount = damping_ < 0.9f ? 1.0f : (1.0f - damping_) * 10.0f;
-  float amplitude_rt60 = 0.1f * SemitonesToRatio(damping_ * 96.0f) * kSampleRate;
-  float amplitude_decay = 1.0f - powf(0.001f, 1.0f / amplitude_rt60);
+  const float parameters[] = { damping_ };
+  if (decay_coefficients_.Update(parameters)) {
+    float amplitude_rt60 = 0.1f * SemitonesToRatio(damping_ * 96.0f) * \
+        kSampleRate;
+    amplitude_decay_ = 1.0f - powf(0.001f, 1.0f / amplitude_rt60);
 
-  float brightness_rt60 = 0.1f * SemitonesToRatio(damping_ * 84.0f) * kSampleRate;
-  float brightness_decay = 1.0f - powf(0.001f, 1.0f / brightness_rt60);
+    float brightness_rt60 = 0.1f * SemitonesToRatio(damping_ * 84.0f) * \
+        kSampleRate;
+    brightness_decay_ = 1.0f - powf(0.001f, 1.0f / brightness_rt60);
+  }
+  float amplitude_decay = amplitude_decay_;
+  float brightness_decay = brightness_decay_;
   
   float ratio = Interpolate(lut_fm_frequency_quantizer, ratio_, 128.0f);
   float modulator_frequency = carrier_frequency_ * SemitonesToRatio(ratio);
@@ -88,13 +102,13 @@ void FMVoice::Process(const float* in, float* out, float* aux, size_t size) {
   float feedback = (feedback_amount_ - 0.5f) * 2.0f;
   
   ParameterInterpolator carrier_increment(
-      &previous_carrier_frequency_, carrier_frequency_, size);
+      &previous_carrier_frequency_, carrier_frequency_, ramp_size);
   ParameterInterpolator modulator_increment(
-      &previous_modulator_frequency_, modulator_frequency, size);
+      &previous_modulator_frequency_, modulator_frequency, ramp_size);
   ParameterInterpolator brightness(
-      &previous_brightness_, brightness_, size);
+      &previous_brightness_, brightness_, ramp_size);
   ParameterInterpolator feedback_amount(
-      &previous_feedback_amount_, feedback, size);
+      &previous_feedback_amount_, feedback, ramp_size);
 
   uint32_t carrier_phase = carrier_phase_;
   uint32_t modulator_phase = modulator_phase_;
@@ -33,6 +33,7 @@
 
 #include <algorithm>
 
+#include "stmlib/dsp/coefficient_cache.h"
 #include "stmlib/dsp/filter.h"
 
 #include "rings/dsp/dsp.h"
@@ -50,11 +51,14 @@ class FMVoice {
   ~FMVoice() { }
   
   void Init();
+  // Frequencies, brightness and feedback glide to their new values over
+  // ramp_size >= size samples.
   void Process(
       const float* in,
       float* out,
       float* aux,
-      size_t size);
+      size_t size,
+      size_t ramp_size);
   
   inline void set_frequency(float frequency) {
     carrier_frequency_ = frequency;
@@ -116,6 +120,11 @@ class FMVoice {
   uint32_t modulator_phase_;
   float previous_sample_;
   
+  // Envelope decay rates, recomputed when damping changes.
+  stmlib::CoefficientCache<1> decay_coefficients_;
+  float amplitude_decay_;
+  float brightness_decay_;
+  
   Follower follower_;
   
   DISALLOW_COPY_AND_ASSIGN(FMVoice);
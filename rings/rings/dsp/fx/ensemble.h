@@ -116,6 +116,10 @@ class Ensemble {
     depth_ = depth * 128.0f;
   }
   
+  inline void Clear() {
+    engine_.Clear();
+  }
+  
  private:
   typedef FxEngine<4096, FORMAT_16_BIT> E;
   E engine_;
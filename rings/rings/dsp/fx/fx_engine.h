@@ -35,6 +35,8 @@
 
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/cosine_oscillator.h"
+#include "stmlib/dsp/denormal.h"
+#include "stmlib/utils/snapshot.h"
 
 namespace rings {
 
@@ -91,7 +93,7 @@ struct DataType<FORMAT_32_BIT> {
   }
   
   static inline T Compress(float value) {
-    return value;
+    return stmlib::FlushDenormal(value);
   }
 };
 
@@ -114,6 +116,10 @@ class FxEngine {
     write_ptr_ = 0;
   }
 
+  void ListPointers(stmlib::SnapshotPointers* pointers) const {
+    pointers->Add(&buffer_);
+  }
+
   struct Empty { };
   
   template<int32_t l, typename T = Empty>
@@ -37,6 +37,9 @@ namespace rings {
 
 class Reverb {
  public:
+  // Size of the buffer passed to Init(), in words.
+  static const size_t kBufferSize = 32768;
+
   Reverb() { }
   ~Reverb() { }
   
@@ -135,8 +138,8 @@ class Reverb {
       ++right;
     }
     
-    lp_decay_1_ = lp_1;
-    lp_decay_2_ = lp_2;
+    lp_decay_1_ = stmlib::FlushDenormal(lp_1);
+    lp_decay_2_ = stmlib::FlushDenormal(lp_2);
   }
   
   inline void set_amount(float amount) {
@@ -162,9 +165,13 @@ class Reverb {
   inline void Clear() {
     engine_.Clear();
   }
+
+  inline void ListPointers(stmlib::SnapshotPointers* pointers) const {
+    engine_.ListPointers(pointers);
+  }
   
  private:
-  typedef FxEngine<32768, FORMAT_16_BIT> E;
+  typedef FxEngine<kBufferSize, FORMAT_16_BIT> E;
   E engine_;
   
   float amount_;
@@ -0,0 +1,120 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Send/return reverb shared by several parts.
+//
+// Parts attached to a bus do not run their own reverb. They send their output,
+// after their limiter, into the bus and attenuate their dry signal; the host
+// then calls Process() once per block to render a single reverb over the sum
+// of all the sends and mix the return into its own output buffers.
+//
+// The reverb time, diffusion and low-pass filter are those of the bus, set by
+// the host: the parts' own settings, which follow their patch, do not apply.
+
+#ifndef RINGS_DSP_FX_REVERB_BUS_H_
+#define RINGS_DSP_FX_REVERB_BUS_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+
+#include "stmlib/utils/profiler.h"
+
+#include "rings/dsp/dsp.h"
+#include "rings/dsp/fx/reverb.h"
+
+namespace rings {
+
+class ReverbBus {
+ public:
+  ReverbBus() { }
+  ~ReverbBus() { }
+  
+  void Init(uint16_t* reverb_buffer) {
+    reverb_.Init(reverb_buffer);
+    reverb_.set_amount(1.0f);
+    reverb_.set_input_gain(0.2f);
+    reverb_.set_diffusion(0.625f);
+    reverb_.set_time(0.665f);
+    reverb_.set_lp(0.6f);
+    std::fill(&send_left_[0], &send_left_[kMaxBlockSize], 0.0f);
+    std::fill(&send_right_[0], &send_right_[kMaxBlockSize], 0.0f);
+  }
+  
+  // Accumulates the outputs of a part into the bus, aux inverted as the part
+  // outputs it. All the parts feeding the bus during a block must use the
+  // same block size, and must be processed from the same thread as Process().
+  inline void Send(const float* out, const float* aux, float gain, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      send_left_[i] += out[i] * gain;
+      send_right_[i] -= aux[i] * gain;
+    }
+  }
+  
+  // Renders the reverb over the accumulated sends, adds the return to
+  // out/aux (aux is inverted, like the parts' own AUX outputs) and empties
+  // the bus for the next block.
+  void Process(float* out, float* aux, size_t size) {
+    STMLIB_PROFILE_SCOPE("rings/reverb_bus");
+    reverb_.Process(send_left_, send_right_, size);
+    for (size_t i = 0; i < size; ++i) {
+      out[i] += send_left_[i];
+      aux[i] -= send_right_[i];
+    }
+    std::fill(&send_left_[0], &send_left_[size], 0.0f);
+    std::fill(&send_right_[0], &send_right_[size], 0.0f);
+  }
+  
+  inline void set_input_gain(float input_gain) {
+    reverb_.set_input_gain(input_gain);
+  }
+
+  inline void set_time(float reverb_time) {
+    reverb_.set_time(reverb_time);
+  }
+  
+  inline void set_diffusion(float diffusion) {
+    reverb_.set_diffusion(diffusion);
+  }
+  
+  inline void set_lp(float lp) {
+    reverb_.set_lp(lp);
+  }
+  
+  inline void Clear() {
+    reverb_.Clear();
+  }
+  
+ private:
+  Reverb reverb_;
+  
+  float send_left_[kMaxBlockSize];
+  float send_right_[kMaxBlockSize];
+  
+  DISALLOW_COPY_AND_ASSIGN(ReverbBus);
+};
+
+}  // namespace rings
+
+#endif  // RINGS_DSP_FX_REVERB_BUS_H_
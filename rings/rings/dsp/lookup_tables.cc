@@ -0,0 +1,65 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Lookup tables computed at compile time.
+
+#include "rings/dsp/lookup_tables.h"
+
+namespace rings {
+using namespace lookup_tables;
+
+// The tables are evaluated in this translation unit only.
+constexpr stmlib::LookupTable<LUT_SINE_SIZE> sine = Sine<4096>();
+constexpr stmlib::LookupTable<LUT_4_DECADES_SIZE> four_decades = Decades<256, 4>();
+constexpr stmlib::LookupTable<LUT_SVF_SHIFT_SIZE> svf_shift = SvfShift<257>();
+constexpr stmlib::LookupTable<LUT_STIFFNESS_SIZE> stiffness = Stiffness<256>();
+constexpr stmlib::LookupTable<LUT_FM_FREQUENCY_QUANTIZER_SIZE> fm_frequency_quantizer = FmFrequencyQuantizer();
+
+const float lut_sine[LUT_SINE_SIZE] = {
+  STMLIB_LOOKUP_TABLE_VALUES_4096(sine, 0),
+  STMLIB_LOOKUP_TABLE_VALUES_1024(sine, 4096),
+  STMLIB_LOOKUP_TABLE_VALUES_1(sine, 5120)
+};
+
+const float lut_4_decades[LUT_4_DECADES_SIZE] = {
+  STMLIB_LOOKUP_TABLE_VALUES_256(four_decades, 0),
+  STMLIB_LOOKUP_TABLE_VALUES_1(four_decades, 256)
+};
+
+const float lut_svf_shift[LUT_SVF_SHIFT_SIZE] = {
+  STMLIB_LOOKUP_TABLE_VALUES_256(svf_shift, 0),
+  STMLIB_LOOKUP_TABLE_VALUES_1(svf_shift, 256)
+};
+
+const float lut_stiffness[LUT_STIFFNESS_SIZE] = {
+  STMLIB_LOOKUP_TABLE_VALUES_256(stiffness, 0),
+  STMLIB_LOOKUP_TABLE_VALUES_1(stiffness, 256)
+};
+
+const float lut_fm_frequency_quantizer[LUT_FM_FREQUENCY_QUANTIZER_SIZE] = {
+  STMLIB_LOOKUP_TABLE_VALUES_128(fm_frequency_quantizer, 0),
+  STMLIB_LOOKUP_TABLE_VALUES_1(fm_frequency_quantizer, 128)
+};
+
+}  // namespace rings
@@ -0,0 +1,76 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Lookup tables computed at compile time. They used to be generated by
+// resources/lookup_tables.py; the generators follow the python code line by
+// line. Generators shared with other modules are in stmlib.
+
+#ifndef RINGS_DSP_LOOKUP_TABLES_H_
+#define RINGS_DSP_LOOKUP_TABLES_H_
+
+#include "stmlib/stmlib.h"
+#include "stmlib/dsp/constexpr_math.h"
+#include "stmlib/dsp/lookup_table_generators.h"
+
+namespace rings {
+
+namespace lookup_tables {
+
+using namespace stmlib::constexpr_math;
+using namespace stmlib::lookup_table_generators;
+
+// Exponentials covering several decades in 256 steps, with safeguard.
+template<size_t size, int decades>
+constexpr stmlib::LookupTable<size + 1> Decades() {
+  return stmlib::MakeLookupTable<size + 1>([](size_t i) {
+    return Pow(10.0, decades * double(i) / double(size));
+  });
+}
+
+// Delay compensation factor for SVF, one entry per semitone.
+template<size_t size>
+constexpr stmlib::LookupTable<size> SvfShift() {
+  return stmlib::MakeLookupTable<size>([](size_t i) {
+    double ratio = Pow(2.0, double(i) / 12.0);
+    return 2.0 * Atan(1.0 / ratio) / (2.0 * kPi);
+  });
+}
+
+}  // namespace lookup_tables
+
+const size_t LUT_SINE_SIZE = 5121;
+const size_t LUT_4_DECADES_SIZE = 257;
+const size_t LUT_SVF_SHIFT_SIZE = 257;
+const size_t LUT_STIFFNESS_SIZE = 257;
+const size_t LUT_FM_FREQUENCY_QUANTIZER_SIZE = 129;
+
+extern const float lut_sine[LUT_SINE_SIZE];
+extern const float lut_4_decades[LUT_4_DECADES_SIZE];
+extern const float lut_svf_shift[LUT_SVF_SHIFT_SIZE];
+extern const float lut_stiffness[LUT_STIFFNESS_SIZE];
+extern const float lut_fm_frequency_quantizer[LUT_FM_FREQUENCY_QUANTIZER_SIZE];
+
+}  // namespace rings
+
+#endif  // RINGS_DSP_LOOKUP_TABLES_H_
@@ -28,7 +28,12 @@
 
 #include "rings/dsp/part.h"
 
+#include <new>
+
+#include "stmlib/dsp/denormal.h"
 #include "stmlib/dsp/units.h"
+#include "stmlib/utils/profiler.h"
+#include "stmlib/utils/random.h"
 
 #include "rings/resources.h"
 
@@ -37,7 +42,7 @@ namespace rings {
 using namespace std;
 using namespace stmlib;
 
-void Part::Init(uint16_t* reverb_buffer) {
+void Part::Init(uint16_t* reverb_buffer, ReverbBus* reverb_bus) {
   active_voice_ = 0;
   
   fill(&note_[0], &note_[kMaxPolyphony], 0.0f);
@@ -46,22 +51,87 @@ void Part::Init(uint16_t* reverb_buffer) {
   polyphony_ = 1;
   model_ = RESONATOR_MODEL_MODAL;
   dirty_ = true;
+  random_state_ = Random::kDefaultSeed;
   
   for (int32_t i = 0; i < kMaxPolyphony; ++i) {
     excitation_filter_[i].Init();
-    plucker_[i].Init();
     dc_blocker_[i].Init(1.0f - 10.0f / kSampleRate);
   }
   
-  reverb_.Init(reverb_buffer);
+  reverb_bus_ = reverb_bus;
+  reverb_buffer_ = reverb_bus_ ? NULL : reverb_buffer;
+  if (!reverb_bus_) {
+    reverb_.Init(reverb_buffer);
+  }
   limiter_.Init();
+  
+  set_control_block_size(kDefaultControlBlockSize);
+}
 
+void Part::set_control_block_size(size_t control_block_size) {
+  control_block_size_ = max(
+      min(control_block_size, kMaxControlBlockSize),
+      size_t(1));
   note_filter_.Init(
-      kSampleRate / kMaxBlockSize,
+      kSampleRate / control_block_size_,
       0.001f,  // Lag time with a sharp edge on the V/Oct input or trigger.
       0.010f,  // Lag time after the trigger has been received.
       0.050f,  // Time to transition from reactive to filtered.
       0.004f); // Prevent a sharp edge to partly leak on the previous voice.
+  control_countdown_ = 0;
+  strum_pending_ = false;
+  
+  // The string LFOs run at control rate.
+  dirty_ = true;
+}
+
+void Part::SelectModelState(ModelStateMember member) {
+  if (member == model_state_member_) {
+    return;
+  }
+  
+  switch (model_state_member_) {
+    case MODEL_STATE_RESONATOR:
+      for (int32_t i = 0; i < kMaxPolyphony; ++i) {
+        model_state_.resonator[i].~Resonator();
+      }
+      break;
+    
+    case MODEL_STATE_STRINGS:
+      model_state_.strings.~Strings();
+      break;
+    
+    case MODEL_STATE_FM_VOICE:
+      for (int32_t i = 0; i < kMaxPolyphony; ++i) {
+        model_state_.fm_voice[i].~FMVoice();
+      }
+      break;
+    
+    default:
+      break;
+  }
+  
+  switch (member) {
+    case MODEL_STATE_RESONATOR:
+      for (int32_t i = 0; i < kMaxPolyphony; ++i) {
+        new(&model_state_.resonator[i]) Resonator();
+      }
+      break;
+    
+    case MODEL_STATE_STRINGS:
+      new(&model_state_.strings) ModelState::Strings();
+      break;
+    
+    case MODEL_STATE_FM_VOICE:
+      for (int32_t i = 0; i < kMaxPolyphony; ++i) {
+        new(&model_state_.fm_voice[i]) FMVoice();
+      }
+      break;
+    
+    default:
+      break;
+  }
+  model_state_member_ = member;
 }
 
 void Part::ConfigureResonators() {
@@ -72,10 +142,11 @@ void Part::ConfigureResonators() {
   switch (model_) {
     case RESONATOR_MODEL_MODAL:
       {
+        SelectModelState(MODEL_STATE_RESONATOR);
         int32_t resolution = 64 / polyphony_ - 4;
         for (int32_t i = 0; i < polyphony_; ++i) {
-          resonator_[i].Init();
-          resonator_[i].set_resolution(resolution);
+          model_state_.resonator[i].Init();
+          model_state_.resonator[i].set_resolution(resolution);
         }
       }
       break;
@@ -85,28 +156,31 @@ void Part::ConfigureResonators() {
     case RESONATOR_MODEL_SYMPATHETIC_STRING_QUANTIZED:
     case RESONATOR_MODEL_STRING_AND_REVERB:
       {
+        SelectModelState(MODEL_STATE_STRINGS);
         float lfo_frequencies[kNumStrings] = {
           0.5f, 0.4f, 0.35f, 0.23f, 0.211f, 0.2f, 0.171f
         };
         for (int32_t i = 0; i < kNumStrings; ++i) {
           bool has_dispersion = model_ == RESONATOR_MODEL_STRING || \
               model_ == RESONATOR_MODEL_STRING_AND_REVERB;
-          string_[i].Init(has_dispersion);
+          model_state_.strings.string[i].Init(has_dispersion);
 
-          float f_lfo = float(kMaxBlockSize) / float(kSampleRate);
+          float f_lfo = float(control_block_size_) / float(kSampleRate);
           f_lfo *= lfo_frequencies[i];
-          lfo_[i].Init<COSINE_OSCILLATOR_APPROXIMATE>(f_lfo);
+          model_state_.strings.lfo[i].Init<COSINE_OSCILLATOR_APPROXIMATE>(
+              f_lfo);
         }
-        for (int32_t i = 0; i < polyphony_; ++i) {
-          plucker_[i].Init();
+        for (int32_t i = 0; i < kMaxPolyphony; ++i) {
+          model_state_.strings.plucker[i].Init();
         }
       }
       break;
     
     case RESONATOR_MODEL_FM_VOICE:
       {
+        SelectModelState(MODEL_STATE_FM_VOICE);
         for (int32_t i = 0; i < polyphony_; ++i) {
-          fm_voice_[i].Init();
+          model_state_.fm_voice[i].Init();
         }
       }
       break;
@@ -118,6 +192,8 @@ void Part::ConfigureResonators() {
   if (active_voice_ >= polyphony_) {
     active_voice_ = 0;
   }
+  // The new resonators are configured by a control update straight away.
+  control_countdown_ = 0;
   dirty_ = false;
 }
 
@@ -302,26 +378,32 @@ void Part::RenderModalVoice(
     const Patch& patch,
     float frequency,
     float filter_cutoff,
-    size_t size) {
-  // Internal exciter is a pulse, pre-filter.
-  if (performance_state.internal_exciter &&
-      voice == active_voice_ &&
-      performance_state.strum) {
-    resonator_input_[0] += 0.25f * SemitonesToRatio(
-        filter_cutoff * filter_cutoff * 24.0f) / filter_cutoff;
+    size_t size,
+    size_t ramp_size) {
+  {
+    STMLIB_PROFILE_SCOPE("rings/excitation");
+    // Internal exciter is a pulse, pre-filter.
+    if (performance_state.internal_exciter &&
+        voice == active_voice_ &&
+        performance_state.strum) {
+      resonator_input_[0] += 0.25f * SemitonesToRatio(
+          filter_cutoff * filter_cutoff * 24.0f) / filter_cutoff;
+    }
+    
+    // Process through filter.
+    excitation_filter_[voice].Process<FILTER_MODE_LOW_PASS>(
+        resonator_input_, resonator_input_, size);
+    excitation_filter_[voice].FlushDenormals();
   }
-  
-  // Process through filter.
-  excitation_filter_[voice].Process<FILTER_MODE_LOW_PASS>(
-      resonator_input_, resonator_input_, size);
 
-  Resonator& r = resonator_[voice];
+  STMLIB_PROFILE_SCOPE("rings/resonator");
+  Resonator& r = model_state_.resonator[voice];
   r.set_frequency(frequency);
   r.set_structure(patch.structure);
   r.set_brightness(patch.brightness * patch.brightness);
   r.set_position(patch.position);
   r.set_damping(patch.damping);
-  r.Process(resonator_input_, out_buffer_, aux_buffer_, size);
+  r.Process(resonator_input_, out_buffer_, aux_buffer_, size, ramp_size);
 }
 
 void Part::RenderFMVoice(
@@ -330,8 +412,10 @@ void Part::RenderFMVoice(
     const Patch& patch,
     float frequency,
     float filter_cutoff,
-    size_t size) {
-  FMVoice& v = fm_voice_[voice];
+    size_t size,
+    size_t ramp_size) {
+  STMLIB_PROFILE_SCOPE("rings/fm_voice");
+  FMVoice& v = model_state_.fm_voice[voice];
   if (performance_state.internal_exciter &&
       voice == active_voice_ &&
       performance_state.strum) {
@@ -344,16 +428,18 @@ void Part::RenderFMVoice(
   v.set_feedback_amount(patch.position);
   v.set_position(/*patch.position*/ 0.0f);
   v.set_damping(patch.damping);
-  v.Process(resonator_input_, out_buffer_, aux_buffer_, size);
+  v.Process(resonator_input_, out_buffer_, aux_buffer_, size, ramp_size);
 }
 
 void Part::RenderStringVoice(
     int32_t voice,
     const PerformanceState& performance_state,
     const Patch& patch,
+    bool control_update,
     float frequency,
     float filter_cutoff,
-    size_t size) {
+    size_t size,
+    size_t ramp_size) {
   // Compute number of strings and frequency.
   int32_t num_strings = 1;
   float frequencies[kNumStrings];
@@ -377,29 +463,36 @@ void Part::RenderStringVoice(
     frequencies[0] = frequency;
   }
 
-  if (voice == active_voice_) {
-    const float gain = 1.0f / Sqrt(static_cast<float>(num_strings) * 2.0f);
-    for (size_t i = 0; i < size; ++i) {
-      resonator_input_[i] *= gain;
-    }
-  }
-
-  // Process external input.
-  excitation_filter_[voice].Process<FILTER_MODE_LOW_PASS>(
-      resonator_input_, resonator_input_, size);
-
-  // Add noise burst.
-  if (performance_state.internal_exciter) {
-    if (voice == active_voice_ && performance_state.strum) {
-      plucker_[voice].Trigger(frequency, filter_cutoff * 8.0f, patch.position);
+  {
+    STMLIB_PROFILE_SCOPE("rings/excitation");
+    if (voice == active_voice_) {
+      const float gain = 1.0f / Sqrt(static_cast<float>(num_strings) * 2.0f);
+      for (size_t i = 0; i < size; ++i) {
+        resonator_input_[i] *= gain;
+      }
     }
-    plucker_[voice].Process(noise_burst_buffer_, size);
-    for (size_t i = 0; i < size; ++i) {
-      resonator_input_[i] += noise_burst_buffer_[i];
+    
+    // Process external input.
+    excitation_filter_[voice].Process<FILTER_MODE_LOW_PASS>(
+        resonator_input_, resonator_input_, size);
+    excitation_filter_[voice].FlushDenormals();
+    
+    // Add noise burst.
+    if (performance_state.internal_exciter) {
+      Plucker& plucker = model_state_.strings.plucker[voice];
+      if (voice == active_voice_ && performance_state.strum) {
+        plucker.Trigger(frequency, filter_cutoff * 8.0f, patch.position);
+      }
+      plucker.Process(noise_burst_buffer_, size);
+      for (size_t i = 0; i < size; ++i) {
+        resonator_input_[i] += noise_burst_buffer_[i];
+      }
     }
+    dc_blocker_[voice].Process(resonator_input_, size);
+    dc_blocker_[voice].FlushDenormals();
   }
-  dc_blocker_[voice].Process(resonator_input_, size);
   
+  STMLIB_PROFILE_SCOPE("rings/string");
   fill(&out_buffer_[0], &out_buffer_[size], 0.0f);
   fill(&aux_buffer_[0], &aux_buffer_[size], 0.0f);
   
@@ -410,40 +503,48 @@ void Part::RenderStringVoice(
   
   for (int32_t string = 0; string < num_strings; ++string) {
     int32_t i = voice + string * polyphony_;
-    String& s = string_[i];
-    float lfo_value = lfo_[i].Next();
-    
-    float brightness = patch.brightness;
-    float damping = patch.damping;
-    float position = patch.position;
-    float glide = 1.0f;
-    float string_index = static_cast<float>(string) / static_cast<float>(num_strings);
-    const float* input = resonator_input_;
-    
-    if (model_ == RESONATOR_MODEL_STRING_AND_REVERB) {
-      damping *= (2.0f - damping);
-    }
+    String& s = model_state_.strings.string[i];
     
     // When the internal exciter is used, string 0 is the main
     // source, the other strings are vibrating by sympathetic resonance.
     // When the internal exciter is not used, all strings are vibrating
     // by sympathetic resonance.
-    if (string > 0 && performance_state.internal_exciter) {
-      brightness *= (2.0f - brightness);
-      brightness *= (2.0f - brightness);
-      damping = 0.7f + patch.damping * 0.27f;
-      float amount = (0.5f - fabs(0.5f - patch.position)) * 0.9f;
-      position = patch.position + lfo_value * amount;
-      glide = SemitonesToRatio((brightness - 1.0f) * 36.0f);
-      input = sympathetic_resonator_input_;
-    }
+    bool sympathetic = string > 0 && performance_state.internal_exciter;
+    const float* input = sympathetic
+        ? sympathetic_resonator_input_
+        : resonator_input_;
     
-    s.set_dispersion(dispersion);
-    s.set_frequency(frequencies[string], glide);
-    s.set_brightness(brightness);
-    s.set_position(position);
-    s.set_damping(damping + string_index * (0.95f - damping));
-    s.Process(input, out_buffer_, aux_buffer_, size);
+    // The LFOs and the frequency glide advance once per control block.
+    if (control_update) {
+      float lfo_value = model_state_.strings.lfo[i].Next();
+      
+      float brightness = patch.brightness;
+      float damping = patch.damping;
+      float position = patch.position;
+      float glide = 1.0f;
+      float string_index = static_cast<float>(string) / \
+          static_cast<float>(num_strings);
+      
+      if (model_ == RESONATOR_MODEL_STRING_AND_REVERB) {
+        damping *= (2.0f - damping);
+      }
+      
+      if (sympathetic) {
+        brightness *= (2.0f - brightness);
+        brightness *= (2.0f - brightness);
+        damping = 0.7f + patch.damping * 0.27f;
+        float amount = (0.5f - fabs(0.5f - patch.position)) * 0.9f;
+        position = patch.position + lfo_value * amount;
+        glide = SemitonesToRatio((brightness - 1.0f) * 36.0f);
+      }
+      
+      s.set_dispersion(dispersion);
+      s.set_frequency(frequencies[string], glide);
+      s.set_brightness(brightness);
+      s.set_position(position);
+      s.set_damping(damping + string_index * (0.95f - damping));
+    }
+    s.Process(input, out_buffer_, aux_buffer_, size, ramp_size);
     
     if (string == 0) {
       // Was 0.1f, Ben Wilson -> 0.2f
@@ -460,39 +561,33 @@ const int32_t kPingPattern[] = {
   1, 0, 2, 1, 0, 2, 1, 0
 };
 
-void Part::Process(
+void Part::RenderVoices(
     const PerformanceState& performance_state,
     const Patch& patch,
+    bool control_update,
     const float* in,
     float* out,
     float* aux,
-    size_t size) {
-
-  // Copy inputs to outputs when bypass mode is enabled.
-  if (bypass_) {
-    copy(&in[0], &in[size], &out[0]);
-    copy(&in[0], &in[size], &aux[0]);
-    return;
-  }
-  
-  ConfigureResonators();
-  
-  note_filter_.Process(
-      performance_state.note,
-      performance_state.strum);
-
-  if (performance_state.strum) {
-    note_[active_voice_] = note_filter_.stable_note();
-    if (polyphony_ > 1 && polyphony_ & 1) {
-      active_voice_ = kPingPattern[step_counter_ % 8];
-      step_counter_ = (step_counter_ + 1) % 8;
-    } else {
-      active_voice_ = (active_voice_ + 1) % polyphony_;
+    size_t size,
+    size_t ramp_size) {
+  if (control_update) {
+    note_filter_.Process(
+        performance_state.note,
+        performance_state.strum);
+
+    if (performance_state.strum) {
+      note_[active_voice_] = note_filter_.stable_note();
+      if (polyphony_ > 1 && polyphony_ & 1) {
+        active_voice_ = kPingPattern[step_counter_ % 8];
+        step_counter_ = (step_counter_ + 1) % 8;
+      } else {
+        active_voice_ = (active_voice_ + 1) % polyphony_;
+      }
     }
+    
+    note_[active_voice_] = note_filter_.note();
   }
   
-  note_[active_voice_] = note_filter_.note();
-  
   fill(&out[0], &out[size], 0.0f);
   fill(&aux[0], &aux[size], 0.0f);
   for (int32_t voice = 0; voice < polyphony_; ++voice) {
@@ -519,13 +614,16 @@ void Part::Process(
     
     if (model_ == RESONATOR_MODEL_MODAL) {
       RenderModalVoice(
-          voice, performance_state, patch, frequency, filter_cutoff, size);
+          voice, performance_state, patch, frequency, filter_cutoff,
+          size, ramp_size);
     } else if (model_ == RESONATOR_MODEL_FM_VOICE) {
       RenderFMVoice(
-          voice, performance_state, patch, frequency, filter_cutoff, size);
+          voice, performance_state, patch, frequency, filter_cutoff,
+          size, ramp_size);
     } else {
       RenderStringVoice(
-          voice, performance_state, patch, frequency, filter_cutoff, size);
+          voice, performance_state, patch, control_update, frequency,
+          filter_cutoff, size, ramp_size);
     }
     
     if (polyphony_ == 1) {
@@ -542,27 +640,153 @@ void Part::Process(
       }
     }
   }
+}
+
+void Part::Process(
+    const PerformanceState& performance_state,
+    const Patch& patch,
+    const float* in,
+    float* out,
+    float* aux,
+    size_t size) {
+  STMLIB_PROFILE_SCOPE("rings/part");
+  ScopedFlushDenormals flush_denormals;
+  ScopedRandomState random_state(&random_state_);
+
+  // Copy inputs to outputs when bypass mode is enabled.
+  if (bypass_) {
+    copy(&in[0], &in[size], &out[0]);
+    copy(&in[0], &in[size], &aux[0]);
+    return;
+  }
+  
+  ConfigureResonators();
+  
+  // The voices are rendered by control blocks, the reverb and limiter, which
+  // do not depend on the block size, over the whole block. The control blocks
+  // run across calls, so that the output does not depend on how the host
+  // splits the audio: a control block started by a previous call is finished
+  // with the state and patch it was started with.
+  strum_pending_ = strum_pending_ || performance_state.strum;
+  size_t start = 0;
+  while (start < size) {
+    bool control_update = !control_countdown_;
+    if (control_update) {
+      control_state_ = performance_state;
+      control_state_.strum = strum_pending_;
+      control_patch_ = patch;
+      control_countdown_ = control_block_size_;
+      strum_pending_ = false;
+    }
+    size_t block_size = min(control_countdown_, size - start);
+    RenderVoices(
+        control_state_, control_patch_, control_update,
+        in + start, out + start, aux + start,
+        block_size, control_countdown_);
+    control_state_.strum = false;
+    control_countdown_ -= block_size;
+    start += block_size;
+  }
   
+  float reverb_amount = 0.1f + patch.damping * 0.5f;
   if (model_ == RESONATOR_MODEL_STRING_AND_REVERB) {
+    STMLIB_PROFILE_SCOPE("rings/reverb");
     for (size_t i = 0; i < size; ++i) {
       float l = out[i];
       float r = aux[i];
       out[i] = l * patch.position + (1.0f - patch.position) * r;
       aux[i] = r * patch.position + (1.0f - patch.position) * l;
     }
-    reverb_.set_amount(0.1f + patch.damping * 0.5f);
-    reverb_.set_diffusion(0.625f);
-    reverb_.set_time(0.35f + 0.63f * patch.damping);
-    reverb_.set_input_gain(0.2f);
-    reverb_.set_lp(0.3f + patch.brightness * 0.6f);
-    reverb_.Process(out, aux, size);
+    if (!reverb_bus_) {
+      reverb_.set_amount(reverb_amount);
+      reverb_.set_diffusion(0.625f);
+      reverb_.set_time(0.35f + 0.63f * patch.damping);
+      reverb_.set_input_gain(0.2f);
+      reverb_.set_lp(0.3f + patch.brightness * 0.6f);
+      reverb_.Process(out, aux, size);
+    }
     for (size_t i = 0; i < size; ++i) {
       aux[i] = -aux[i];
     }
   }
   
   // Apply limiter to string output.
-  limiter_.Process(out, aux, size, model_gains_[model_]);
+  {
+    STMLIB_PROFILE_SCOPE("rings/limiter");
+    limiter_.Process(out, aux, size, model_gains_[model_]);
+  }
+  
+  // The send to a shared reverb is taken after the limiter, which sets the
+  // output level of the model, so that the balance between the dry signal
+  // and the return is the same as with the reverb of the part.
+  if (model_ == RESONATOR_MODEL_STRING_AND_REVERB && reverb_bus_) {
+    reverb_bus_->Send(out, aux, reverb_amount, size);
+    for (size_t i = 0; i < size; ++i) {
+      out[i] *= 1.0f - reverb_amount;
+      aux[i] *= 1.0f - reverb_amount;
+    }
+  }
+}
+
+size_t Part::working_set_size() const {
+  const uint8_t* begin = reinterpret_cast<const uint8_t*>(this);
+  const uint8_t* model_state = reinterpret_cast<const uint8_t*>(&model_state_);
+  size_t size = model_state - begin;
+  
+  switch (model_) {
+    case RESONATOR_MODEL_MODAL:
+      size += polyphony_ * sizeof(Resonator);
+      break;
+    
+    case RESONATOR_MODEL_FM_VOICE:
+      size += polyphony_ * sizeof(FMVoice);
+      break;
+    
+    default:
+      {
+        bool sympathetic = model_ == RESONATOR_MODEL_SYMPATHETIC_STRING ||
+            model_ == RESONATOR_MODEL_SYMPATHETIC_STRING_QUANTIZED;
+        int32_t num_strings = sympathetic
+            ? 2 * kMaxPolyphony / polyphony_ * polyphony_
+            : polyphony_;
+        size += sizeof(model_state_.strings.lfo);
+        size += polyphony_ * sizeof(Plucker) + num_strings * sizeof(String);
+      }
+      break;
+  }
+  
+  if (model_ == RESONATOR_MODEL_STRING_AND_REVERB && reverb_buffer_) {
+    size += Reverb::kBufferSize * sizeof(uint16_t);
+  }
+  return size;
+}
+
+void Part::Process(
+    const PerformanceState& performance_state,
+    const Patch& patch,
+    const PartEvent* events,
+    size_t num_events,
+    const float* in,
+    float* out,
+    float* aux,
+    size_t size) {
+  PerformanceState state = performance_state;
+  Patch p = patch;
+  
+  size_t start = 0;
+  while (start < size) {
+    for (; num_events && events->time <= start; ++events, --num_events) {
+      ApplyPartEvent(*events, &state, &p);
+    }
+    
+    size_t end = min(start + kMaxBlockSize, size);
+    if (num_events && events->time < end) {
+      end = events->time;
+    }
+    Process(state, p, in + start, out + start, aux + start, end - start);
+    state.strum = false;
+    start = end;
+  }
 }
 
 /* static */
@@ -575,4 +799,50 @@ float Part::model_gains_[] = {
   1.4f,  // RESONATOR_MODEL_STRING_AND_REVERB
 };
 
+// "RGPT"
+const uint32_t kSnapshotMagic = 0x54504752;
+const uint16_t kSnapshotVersion = 5;
+
+void Part::ListPointers(SnapshotPointers* pointers) const {
+  pointers->Add(&reverb_bus_);
+  pointers->Add(&reverb_buffer_);
+  if (!reverb_bus_) {
+    reverb_.ListPointers(pointers);
+  }
+}
+
+size_t Part::snapshot_size() const {
+  size_t reverb_buffer_size = reverb_buffer_ ? Reverb::kBufferSize : 0;
+  SnapshotPointers pointers;
+  ListPointers(&pointers);
+  return stmlib::Snapshot::size(
+      sizeof(*this),
+      reverb_buffer_size * sizeof(uint16_t),
+      pointers);
+}
+
+size_t Part::Snapshot(void* buffer, size_t size) const {
+  size_t reverb_buffer_size = reverb_buffer_ ? Reverb::kBufferSize : 0;
+  SnapshotPointers pointers;
+  ListPointers(&pointers);
+  return stmlib::Snapshot::Save(
+      kSnapshotMagic, kSnapshotVersion,
+      this, sizeof(*this),
+      reverb_buffer_, reverb_buffer_size * sizeof(uint16_t),
+      pointers,
+      buffer, size);
+}
+
+bool Part::Restore(const void* buffer, size_t size) {
+  size_t reverb_buffer_size = reverb_buffer_ ? Reverb::kBufferSize : 0;
+  SnapshotPointers pointers;
+  ListPointers(&pointers);
+  return stmlib::Snapshot::Restore(
+      kSnapshotMagic, kSnapshotVersion,
+      this, sizeof(*this),
+      reverb_buffer_, reverb_buffer_size * sizeof(uint16_t),
+      pointers,
+      buffer, size);
+}
+
 }  // namespace rings
\ No newline at end of file
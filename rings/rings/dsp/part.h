@@ -34,12 +34,15 @@
 #include "stmlib/stmlib.h"
 #include "stmlib/dsp/cosine_oscillator.h"
 #include "stmlib/dsp/delay_line.h"
+#include "stmlib/utils/snapshot.h"
 
 #include "rings/dsp/dsp.h"
 #include "rings/dsp/fm_voice.h"
 #include "rings/dsp/fx/reverb.h"
+#include "rings/dsp/fx/reverb_bus.h"
 #include "rings/dsp/limiter.h"
 #include "rings/dsp/note_filter.h"
+#include "rings/dsp/part_event.h"
 #include "rings/dsp/patch.h"
 #include "rings/dsp/performance_state.h"
 #include "rings/dsp/plucker.h"
@@ -65,19 +68,49 @@ const int32_t kNumStrings = kMaxPolyphony * 2;
 
 class Part {
  public:
-  Part() { }
-  ~Part() { }
+  Part() : model_state_member_(MODEL_STATE_NONE) { }
+  ~Part() {
+    SelectModelState(MODEL_STATE_NONE);
+  }
+  
+  // When a reverb bus is given, RESONATOR_MODEL_STRING_AND_REVERB sends its
+  // wet signal to the bus instead of running the part's own reverb, and
+  // reverb_buffer can be NULL.
+  void Init(uint16_t* reverb_buffer, ReverbBus* reverb_bus = NULL);
   
-  void Init(uint16_t* reverb_buffer);
+  // Processes a block of up to kMaxBlockSize samples. The voices are updated
+  // every control_block_size() samples, on a grid which runs across calls:
+  // the performance state and patch are sampled at these updates, and
+  // performance_state.strum strums at the next one.
+  void Process(
+      const PerformanceState& performance_state,
+      const Patch& patch,
+      const float* in,
+      float* out,
+      float* aux,
+      size_t size);
   
+  // Processes a block of any size, applying the events (sorted by time) to
+  // copies of the performance state and patch at the sample they are
+  // scheduled for. The block is only split at the events, and in chunks of
+  // kMaxBlockSize. performance_state.strum strums at the next control update.
   void Process(
       const PerformanceState& performance_state,
       const Patch& patch,
+      const PartEvent* events,
+      size_t num_events,
       const float* in,
       float* out,
       float* aux,
       size_t size);
 
+  inline size_t control_block_size() const { return control_block_size_; }
+  
+  // Number of samples between two control updates, up to
+  // kMaxControlBlockSize. The default, kDefaultControlBlockSize, matches the
+  // module. Resets the note filter and the resonators.
+  void set_control_block_size(size_t control_block_size);
+
   inline bool bypass() const { return bypass_; }
   inline void set_bypass(bool bypass) { bypass_ = bypass; }
 
@@ -91,6 +124,19 @@ class Part {
     dirty_ = true;
   }
   
+  // Snapshot of the whole state of the part (resonators, strings, filters,
+  // noise generator, reverb and its buffer), see stmlib/utils/snapshot.h. The
+  // reverb bus, when one is used, is shared and not part of the snapshot. A
+  // snapshot can be restored into any part initialized the same way: both
+  // with, or both without, a reverb bus.
+  size_t snapshot_size() const;
+  size_t Snapshot(void* buffer, size_t size) const;
+  bool Restore(const void* buffer, size_t size);
+
+  // Number of bytes of state read or written by Process() with the current
+  // model and polyphony, reverb buffer included.
+  size_t working_set_size() const;
+
   inline ResonatorModel model() const { return model_; }
   inline void set_model(ResonatorModel model) {
     if (model != model_) {
@@ -100,28 +146,53 @@ class Part {
   }
 
  private:
+  enum ModelStateMember {
+    MODEL_STATE_NONE,
+    MODEL_STATE_RESONATOR,
+    MODEL_STATE_STRINGS,
+    MODEL_STATE_FM_VOICE
+  };
+  
+  // Ends the lifetime of the alive member of model_state_, and starts the
+  // lifetime of the given one.
+  void SelectModelState(ModelStateMember member);
   void ConfigureResonators();
+  // Renders size samples of the current control block, of which ramp_size
+  // samples remain. control_update is set for the first chunk of the block.
+  void RenderVoices(
+      const PerformanceState& performance_state,
+      const Patch& patch,
+      bool control_update,
+      const float* in,
+      float* out,
+      float* aux,
+      size_t size,
+      size_t ramp_size);
   void RenderModalVoice(
       int32_t voice,
       const PerformanceState& performance_state,
       const Patch& patch,
       float frequency,
       float filter_cutoff,
-      size_t size);
+      size_t size,
+      size_t ramp_size);
   void RenderStringVoice(
       int32_t voice,
       const PerformanceState& performance_state,
       const Patch& patch,
+      bool control_update,
       float frequency,
       float filter_cutoff,
-      size_t size);
+      size_t size,
+      size_t ramp_size);
   void RenderFMVoice(
       int32_t voice,
       const PerformanceState& performance_state,
       const Patch& patch,
       float frequency,
       float filter_cutoff,
-      size_t size);
+      size_t size,
+      size_t ramp_size);
   
 
   inline float Squash(float x) const {
@@ -149,7 +220,10 @@ class Part {
       float parameter,
       float* destination,
       size_t num_strings);
+  void ListPointers(stmlib::SnapshotPointers* pointers) const;
   
+  // Scalar state and filters used by every model, packed at the beginning
+  // of the object.
   bool bypass_;
   bool dirty_;
 
@@ -159,28 +233,57 @@ class Part {
   int32_t active_voice_;
   uint32_t step_counter_;
   int32_t polyphony_;
+  size_t control_block_size_;
   
-  Resonator resonator_[kMaxPolyphony];
-  String string_[kNumStrings];
-  stmlib::CosineOscillator lfo_[kNumStrings];
-  FMVoice fm_voice_[kMaxPolyphony];
+  // State of the noise generator, which the exciters and strings draw from
+  // while the part is processed.
+  uint32_t random_state_;
+  
+  // Samples left before the next control update, and the performance state
+  // and patch sampled at the last one. A strum received in between is held
+  // until the next update.
+  size_t control_countdown_;
+  bool strum_pending_;
+  PerformanceState control_state_;
+  Patch control_patch_;
   
-  stmlib::Svf excitation_filter_[kMaxPolyphony];
-  stmlib::DCBlocker dc_blocker_[kMaxPolyphony];
-  Plucker plucker_[kMaxPolyphony];
-
   float note_[kMaxPolyphony];
   NoteFilter note_filter_;
   
-  float resonator_input_[kMaxBlockSize];
-  float sympathetic_resonator_input_[kMaxBlockSize];
-  float noise_burst_buffer_[kMaxBlockSize];
-  
-  float out_buffer_[kMaxBlockSize];
-  float aux_buffer_[kMaxBlockSize];
+  stmlib::Svf excitation_filter_[kMaxPolyphony];
+  stmlib::DCBlocker dc_blocker_[kMaxPolyphony];
+  Limiter limiter_;
   
+  ReverbBus* reverb_bus_;
+  uint16_t* reverb_buffer_;
   Reverb reverb_;
-  Limiter limiter_;
+  
+  alignas(64) float resonator_input_[kMaxControlBlockSize];
+  float sympathetic_resonator_input_[kMaxControlBlockSize];
+  float noise_burst_buffer_[kMaxControlBlockSize];
+  
+  float out_buffer_[kMaxControlBlockSize];
+  float aux_buffer_[kMaxControlBlockSize];
+  
+  // State of the resonator models. The models share the same memory: only
+  // the member used by the active model is alive. It is constructed by
+  // SelectModelState(), and initialized by ConfigureResonators(), whenever
+  // the model changes.
+  union ModelState {
+    ModelState() { }
+    ~ModelState() { }
+    
+    Resonator resonator[kMaxPolyphony];
+    struct Strings {
+      // Small per-string state first, delay lines last.
+      stmlib::CosineOscillator lfo[kNumStrings];
+      Plucker plucker[kMaxPolyphony];
+      String string[kNumStrings];
+    } strings;
+    FMVoice fm_voice[kMaxPolyphony];
+  };
+  ModelStateMember model_state_member_;
+  alignas(64) ModelState model_state_;
   
   static float model_gains_[RESONATOR_MODEL_LAST];
   
@@ -0,0 +1,93 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Timestamped events applied inside a block processed by Part.
+
+#ifndef RINGS_DSP_PART_EVENT_H_
+#define RINGS_DSP_PART_EVENT_H_
+
+#include "stmlib/stmlib.h"
+
+#include "rings/dsp/patch.h"
+#include "rings/dsp/performance_state.h"
+
+namespace rings {
+
+enum PartEventType {
+  PART_EVENT_STRUM,  // value is ignored.
+  PART_EVENT_NOTE,
+  PART_EVENT_TONIC,
+  PART_EVENT_FM,
+  PART_EVENT_CHORD,
+  PART_EVENT_STRUCTURE,
+  PART_EVENT_BRIGHTNESS,
+  PART_EVENT_DAMPING,
+  PART_EVENT_POSITION
+};
+
+struct PartEvent {
+  // Index of the sample of the block at which the event takes effect.
+  size_t time;
+  PartEventType type;
+  float value;
+};
+
+inline void ApplyPartEvent(
+    const PartEvent& event,
+    PerformanceState* performance_state,
+    Patch* patch) {
+  switch (event.type) {
+    case PART_EVENT_STRUM:
+      performance_state->strum = true;
+      break;
+    case PART_EVENT_NOTE:
+      performance_state->note = event.value;
+      break;
+    case PART_EVENT_TONIC:
+      performance_state->tonic = event.value;
+      break;
+    case PART_EVENT_FM:
+      performance_state->fm = event.value;
+      break;
+    case PART_EVENT_CHORD:
+      performance_state->chord = static_cast<int32_t>(event.value);
+      break;
+    case PART_EVENT_STRUCTURE:
+      patch->structure = event.value;
+      break;
+    case PART_EVENT_BRIGHTNESS:
+      patch->brightness = event.value;
+      break;
+    case PART_EVENT_DAMPING:
+      patch->damping = event.value;
+      break;
+    case PART_EVENT_POSITION:
+      patch->position = event.value;
+      break;
+  }
+}
+
+}  // namespace rings
+
+#endif  // RINGS_DSP_PART_EVENT_H_
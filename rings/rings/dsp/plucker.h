@@ -49,6 +49,7 @@ class Plucker {
     comb_filter_.Init();
     remaining_samples_ = 0;
     comb_filter_period_ = 0.0f;
+    comb_filter_gain_ = 0.0f;
   }
   
   void Trigger(float frequency, float cutoff, float position) {
@@ -72,18 +73,20 @@ class Plucker {
         in = 2.0f * Random::GetFloat() - 1.0f;
         --remaining_samples_;
       }
-      out[i] = in + comb_gain * comb_filter_.Read(comb_delay);
+      out[i] = stmlib::FlushDenormal(
+          in + comb_gain * comb_filter_.Read(comb_delay));
       comb_filter_.Write(out[i]);
     }
     svf_.Process<FILTER_MODE_LOW_PASS>(out, out, size);
+    svf_.FlushDenormals();
   }
 
  private:
   stmlib::Svf svf_;
-  stmlib::DelayLine<float, 256> comb_filter_;
   size_t remaining_samples_;
   float comb_filter_period_;
   float comb_filter_gain_;
+  stmlib::DelayLine<float, 256> comb_filter_;
   
   DISALLOW_COPY_AND_ASSIGN(Plucker);
 };
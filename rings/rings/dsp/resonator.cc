@@ -51,9 +51,22 @@ void Resonator::Init() {
   set_position(0.999f);
   previous_position_ = 0.0f;
   set_resolution(kMaxModes);
+  coefficients_.Init();
+  num_modes_ = 0;
 }
 
 int32_t Resonator::ComputeFilters() {
+  const float parameters[] = {
+    frequency_,
+    structure_,
+    brightness_,
+    damping_,
+    static_cast<float>(resolution_)
+  };
+  if (!coefficients_.Update(parameters)) {
+    return num_modes_;
+  }
+  
   float stiffness = Interpolate(lut_stiffness, structure_, 256.0f);
   float harmonic = frequency_;
   float stretch_factor = 1.0f; 
@@ -95,13 +108,19 @@ int32_t Resonator::ComputeFilters() {
     q *= q_loss;
   }
   
+  num_modes_ = num_modes;
   return num_modes;
 }
 
-void Resonator::Process(const float* in, float* out, float* aux, size_t size) {
+void Resonator::Process(
+    const float* in,
+    float* out,
+    float* aux,
+    size_t size,
+    size_t ramp_size) {
   int32_t num_modes = ComputeFilters();
   
-  ParameterInterpolator position(&previous_position_, position_, size);
+  ParameterInterpolator position(&previous_position_, position_, ramp_size);
   while (size--) {
     CosineOscillator amplitudes;
     amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(position.Next());
@@ -117,6 +136,9 @@ void Resonator::Process(const float* in, float* out, float* aux, size_t size) {
     *out++ = odd;
     *aux++ = even;
   }
+  for (int32_t i = 0; i < num_modes; ++i) {
+    f_[i].FlushDenormals();
+  }
 }
 
 }  // namespace rings
@@ -34,6 +34,7 @@
 #include <algorithm>
 
 #include "rings/dsp/dsp.h"
+#include "stmlib/dsp/coefficient_cache.h"
 #include "stmlib/dsp/filter.h"
 #include "stmlib/dsp/delay_line.h"
 
@@ -47,11 +48,13 @@ class Resonator {
   ~Resonator() { }
   
   void Init();
+  // The position is interpolated over ramp_size >= size samples.
   void Process(
       const float* in,
       float* out,
       float* aux,
-      size_t size);
+      size_t size,
+      size_t ramp_size);
   
   inline void set_frequency(float frequency) {
     frequency_ = frequency;
@@ -89,6 +92,11 @@ class Resonator {
   
   int32_t resolution_;
   
+  // The filters are only recomputed when frequency, structure, brightness,
+  // damping or resolution change.
+  stmlib::CoefficientCache<5> coefficients_;
+  int32_t num_modes_;
+  
   stmlib::Svf f_[kMaxModes];
   
   DISALLOW_COPY_AND_ASSIGN(Resonator);
@@ -30,6 +30,7 @@
 
 #include <cmath>
 
+#include "stmlib/dsp/denormal.h"
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/parameter_interpolator.h"
 #include "stmlib/dsp/units.h"
@@ -62,7 +63,9 @@ void String::Init(bool enable_dispersion) {
   dispersion_noise_ = 0.0f;
   curved_bridge_ = 0.0f;
   previous_damping_compensation_ = 0.0f;
+  damping_coefficients_.Init();
   
+  src_phase_ = 0.0f;
   out_sample_[0] = out_sample_[1] = 0.0f;
   aux_sample_[0] = aux_sample_[1] = 0.0f;
   
@@ -74,7 +77,8 @@ void String::ProcessInternal(
     const float* in,
     float* out,
     float* aux,
-    size_t size) {
+    size_t size,
+    size_t ramp_size) {
   float delay = 1.0f / frequency_;
   CONSTRAIN(delay, 4.0f, kDelayLineSize - 4.0f);
   
@@ -93,39 +97,53 @@ void String::ProcessInternal(
   
   // Linearly interpolate all comb-related CV parameters for each sample.
   ParameterInterpolator delay_modulation(
-      &delay_, delay, size);
+      &delay_, delay, ramp_size);
   ParameterInterpolator position_modulation(
-      &clamped_position_, clamped_position, size);
+      &clamped_position_, clamped_position, ramp_size);
   ParameterInterpolator dispersion_modulation(
-      &previous_dispersion_, dispersion_, size);
+      &previous_dispersion_, dispersion_, ramp_size);
   
   // For damping/absorption, the interpolation is done in the filter code.
-  float lf_damping = damping_ * (2.0f - damping_);
-  float rt60 = 0.07f * SemitonesToRatio(lf_damping * 96.0f) * kSampleRate;
-  float rt60_base_2_12 = max(-120.0f * delay / src_ratio / rt60, -127.0f);
-  float damping_coefficient = SemitonesToRatio(rt60_base_2_12);
-  float brightness = brightness_ * brightness_;
-  float noise_filter = SemitonesToRatio((brightness_ - 1.0f) * 48.0f);
-  float damping_cutoff = min(
-      24.0f + damping_ * damping_ * 48.0f + brightness_ * brightness_ * 24.0f,
-      84.0f);
-  float damping_f = min(frequency_ * SemitonesToRatio(damping_cutoff), 0.499f);
-  
-  // Crossfade to infinite decay.
-  if (damping_ >= 0.95f) {
-    float to_infinite = 20.0f * (damping_ - 0.95f);
-    damping_coefficient += to_infinite * (1.0f - damping_coefficient);
-    brightness += to_infinite * (1.0f - brightness);
-    damping_f += to_infinite * (0.4999f - damping_f);
-    damping_cutoff += to_infinite * (128.0f - damping_cutoff);
+  // The damping coefficients only depend on frequency, damping and
+  // brightness.
+  const float parameters[] = { frequency_, damping_, brightness_ };
+  if (damping_coefficients_.Update(parameters)) {
+    float lf_damping = damping_ * (2.0f - damping_);
+    float rt60 = 0.07f * SemitonesToRatio(lf_damping * 96.0f) * kSampleRate;
+    float rt60_base_2_12 = max(-120.0f * delay / src_ratio / rt60, -127.0f);
+    float damping_coefficient = SemitonesToRatio(rt60_base_2_12);
+    float brightness = brightness_ * brightness_;
+    float damping_cutoff = min(
+        24.0f + damping_ * damping_ * 48.0f + \
+            brightness_ * brightness_ * 24.0f,
+        84.0f);
+    float damping_f = min(
+        frequency_ * SemitonesToRatio(damping_cutoff), 0.499f);
+    
+    // Crossfade to infinite decay.
+    if (damping_ >= 0.95f) {
+      float to_infinite = 20.0f * (damping_ - 0.95f);
+      damping_coefficient += to_infinite * (1.0f - damping_coefficient);
+      brightness += to_infinite * (1.0f - brightness);
+      damping_f += to_infinite * (0.4999f - damping_f);
+      damping_cutoff += to_infinite * (128.0f - damping_cutoff);
+    }
+    
+    damping_coefficient_ = damping_coefficient;
+    damping_brightness_ = brightness;
+    noise_filter_ = SemitonesToRatio((brightness_ - 1.0f) * 48.0f);
+    damping_compensation_ = 1.0f - Interpolate(
+        lut_svf_shift, damping_cutoff, 1.0f);
+    iir_damping_filter_.set_f_q<FREQUENCY_ACCURATE>(damping_f, 0.5f);
   }
+  float noise_filter = noise_filter_;
   
-  fir_damping_filter_.Configure(damping_coefficient, brightness, size);
-  iir_damping_filter_.set_f_q<FREQUENCY_ACCURATE>(damping_f, 0.5f);
+  fir_damping_filter_.Configure(
+      damping_coefficient_, damping_brightness_, ramp_size);
   ParameterInterpolator damping_compensation_modulation(
       &previous_damping_compensation_,
-      1.0f - Interpolate(lut_svf_shift, damping_cutoff, 1.0f),
-      size);
+      damping_compensation_,
+      ramp_size);
   
   while (size--) {
     src_phase_ += src_ratio;
@@ -193,6 +211,7 @@ void String::ProcessInternal(
 #ifndef MIC_W
       s = iir_damping_filter_.Process<FILTER_MODE_LOW_PASS>(s);
 #endif  // MIC_W
+      s = FlushDenormal(s);
       string_.Write(s);
 
       out_sample_[1] = out_sample_[0];
@@ -205,13 +224,20 @@ void String::ProcessInternal(
     *aux++ += Crossfade(aux_sample_[1], aux_sample_[0], src_phase_);
     in++;
   }
+  iir_damping_filter_.FlushDenormals();
+  dc_blocker_.FlushDenormals();
 }
 
-void String::Process(const float* in, float* out, float* aux, size_t size) {
+void String::Process(
+    const float* in,
+    float* out,
+    float* aux,
+    size_t size,
+    size_t ramp_size) {
   if (enable_dispersion_) {
-    ProcessInternal<true>(in, out, aux, size);
+    ProcessInternal<true>(in, out, aux, size, ramp_size);
   } else {
-    ProcessInternal<false>(in, out, aux, size);
+    ProcessInternal<false>(in, out, aux, size, ramp_size);
   }
 }
 
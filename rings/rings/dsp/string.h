@@ -33,6 +33,7 @@
 
 #include <algorithm>
 
+#include "stmlib/dsp/coefficient_cache.h"
 #include "stmlib/dsp/delay_line.h"
 #include "stmlib/dsp/filter.h"
 
@@ -90,8 +91,18 @@ class DampingFilter {
   DISALLOW_COPY_AND_ASSIGN(DampingFilter);
 };
 
-typedef stmlib::DelayLine<float, kDelayLineSize> StringDelayLine;
-typedef stmlib::DelayLine<float, kDelayLineSize / 2> StiffnessDelayLine;
+// Building with RINGS_HALF_PRECISION_STRINGS stores the string and stiffness
+// delay lines as fp16 instead of float, which halves the size of a Part.
+#ifdef RINGS_HALF_PRECISION_STRINGS
+typedef stmlib::Half StringSample;
+#else
+typedef float StringSample;
+#endif  // RINGS_HALF_PRECISION_STRINGS
+
+typedef stmlib::DelayLine<
+    float, kDelayLineSize, StringSample> StringDelayLine;
+typedef stmlib::DelayLine<
+    float, kDelayLineSize / 2, StringSample> StiffnessDelayLine;
 
 class String {
  public:
@@ -99,7 +110,14 @@ class String {
   ~String() { }
   
   void Init(bool enable_dispersion);
-  void Process(const float* in, float* out, float* aux, size_t size);
+  // The comb parameters are interpolated over ramp_size samples, of which
+  // this call renders the first size.
+  void Process(
+      const float* in,
+      float* out,
+      float* aux,
+      size_t size,
+      size_t ramp_size);
   
   inline void set_frequency(float frequency) {
     frequency_ = frequency;
@@ -129,7 +147,12 @@ class String {
   
  private:
   template<bool enable_dispersion>
-  void ProcessInternal(const float* in, float* out, float* aux, size_t size);
+  void ProcessInternal(
+      const float* in,
+      float* out,
+      float* aux,
+      size_t size,
+      size_t ramp_size);
    
   float frequency_;
   float dispersion_;
@@ -142,6 +165,14 @@ class String {
   float previous_dispersion_;
   float previous_damping_compensation_;
   
+  // Damping coefficients, recomputed when frequency, damping or brightness
+  // change.
+  stmlib::CoefficientCache<3> damping_coefficients_;
+  float damping_coefficient_;
+  float damping_brightness_;
+  float damping_compensation_;
+  float noise_filter_;
+  
   bool enable_dispersion_;
   bool enable_iir_damping_;
   float dispersion_noise_;
@@ -154,13 +185,13 @@ class String {
   
   float curved_bridge_;
   
-  StringDelayLine string_;
-  StiffnessDelayLine stretch_;
-  
   DampingFilter fir_damping_filter_;
   stmlib::Svf iir_damping_filter_;
   stmlib::DCBlocker dc_blocker_;
   
+  StringDelayLine string_;
+  StiffnessDelayLine stretch_;
+  
   DISALLOW_COPY_AND_ASSIGN(String);
 };
 
@@ -0,0 +1,315 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of string synth voices, in the style of divide-down organs.
+//
+// Instead of running one oscillator per harmonic, each voice derives its
+// octaves from a single phase counter running from 0 to 2^num_harmonics.
+// With 3 harmonics:
+//
+// Harmonic   Square high when   Sawtooth phase
+// 8'         segment & 4        phase / 8
+// 4'         segment & 2        (phase - (segment & 4)) / 4
+// 2'         segment & 1        (phase - (segment & 6)) / 2
+//
+// where segment is the integral part of the counter. As with
+// StringSynthOscillator, the lowest square is low-passed ("dark square") and
+// the others are high-passed ("bright square").
+//
+// All the edges fall on integer values of the counter, so a voice computes
+// the BLEP corrections of the last two integers it crossed, which are shared
+// by the harmonics. Above 1/8 of the sample rate the counter crosses two
+// integers per sample; above 1/4 all the harmonics are muted and the frequency
+// is clamped, so it never crosses more. The
+// voices are processed side by side, one array per state variable, and the
+// corrections are applied with 0/1 factors, so that the loops over voices can
+// be vectorized.
+
+#ifndef RINGS_DSP_STRING_SYNTH_OSCILLATOR_BANK_H_
+#define RINGS_DSP_STRING_SYNTH_OSCILLATOR_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+
+#include "stmlib/dsp/polyblep.h"
+
+namespace rings {
+
+template<size_t num_voices, size_t num_harmonics>
+class StringSynthOscillatorBank {
+ public:
+  StringSynthOscillatorBank() { }
+  ~StringSynthOscillatorBank() { }
+  
+  void Init() {
+    set_num_voices(num_voices);
+    ramp_remaining_ = 0;
+    for (size_t i = 0; i < num_voices; ++i) {
+      phase_[i] = 0.0f;
+      increment_[i] = 0.01f * static_cast<float>(kCounterSize);
+      target_increment_[i] = increment_[i];
+      destination_[i] = 0.0f;
+      for (size_t j = 0; j < num_harmonics; ++j) {
+        next_square_[j][i] = 0.0f;
+        next_saw_[j][i] = 0.0f;
+        filter_state_[j][i] = 0.0f;
+        gain_[j][i] = 0.0f;
+        gain_saw_[j][i] = 0.0f;
+        target_gain_[j][i] = 0.0f;
+        target_gain_saw_[j][i] = 0.0f;
+      }
+    }
+  }
+  
+  // Only the first voices are rendered; the others keep their state until
+  // they are used again.
+  inline void set_num_voices(size_t num_voices_in_use) {
+    num_voice_groups_ = std::min(
+        (num_voices_in_use + kVoiceGroupSize - 1) / kVoiceGroupSize,
+        num_voices / kVoiceGroupSize);
+  }
+  
+  // Sets the parameters of a voice for the next call to Render(). amplitudes
+  // holds the square and sawtooth gains of each harmonic; harmonics above
+  // summed_harmonics are muted. A voice which is not configured before
+  // Render() fades out over the next ramp.
+  void Configure(
+      size_t voice,
+      float frequency,
+      const float* amplitudes,
+      size_t summed_harmonics,
+      bool aux) {
+    // All the harmonics are muted above 0.25, and the counter does not cross
+    // more than 2 integers per sample below.
+    target_increment_[voice] = std::min(frequency, 0.25f) * \
+        static_cast<float>(kCounterSize);
+    destination_[voice] = aux ? 1.0f : 0.0f;
+    for (size_t i = 0; i < num_harmonics; ++i) {
+      float gain = amplitudes[0];
+      float gain_saw = amplitudes[1];
+      amplitudes += 2;
+      
+      // Cut harmonics above 12kHz, and low-pass harmonics above 8kHz to clear
+      // highs
+      if (frequency >= 0.17f) {
+        gain *= 1.0f - (frequency - 0.17f) * 12.5f;
+      }
+      if (frequency >= 0.25f || i >= summed_harmonics) {
+        gain = 0.0f;
+        gain_saw = 0.0f;
+      }
+      target_gain_[i][voice] = gain;
+      target_gain_saw_[i][voice] = gain_saw;
+      frequency *= 2.0f;
+    }
+  }
+  
+  // Renders size samples. The voices reach their targets after ramp_size
+  // samples, which can span several calls when a control block is rendered in
+  // chunks: a call which continues the ramp passes the number of samples left
+  // in it, and reuses the increments computed when it started, so that the
+  // chunks render exactly what a single call would.
+  void Render(float* out, float* aux, size_t size, size_t ramp_size) {
+    // Only the voices in use are rendered, by groups of 4.
+    const size_t n = num_voice_groups_ * kVoiceGroupSize;
+    if (ramp_size != ramp_remaining_) {
+      StartRamp(n, ramp_size);
+    }
+    ramp_remaining_ -= std::min(size, ramp_remaining_);
+    const bool end_of_ramp = !ramp_remaining_;
+    
+    while (size--) {
+      // All the edges fall on integer values of the counter, so the BLEP
+      // corrections are computed once per voice and shared by the harmonics
+      // which have an edge at these integers: the integral part of the
+      // counter, and the integer before if it was crossed in the same sample.
+      int32_t segment[num_voices];
+      float fraction[num_voices];
+      float this_blep[num_voices];
+      float next_blep[num_voices];
+      float this_blep_before[num_voices];
+      float next_blep_before[num_voices];
+      for (size_t i = 0; i < n; ++i) {
+        const float increment = increment_[i] + increment_step_[i];
+        float phase = phase_[i] + increment;
+        const int32_t integral = static_cast<int32_t>(phase);
+        phase -= static_cast<float>(integral & kCounterSize);
+        increment_[i] = increment;
+        phase_[i] = phase;
+        
+        segment[i] = integral & (kCounterSize - 1);
+        fraction[i] = phase - static_cast<float>(segment[i]);
+        const float edge = fraction[i] < increment ? 1.0f : 0.0f;
+        const float t = fraction[i] / increment;
+        this_blep[i] = edge * stmlib::ThisBlepSample(t);
+        next_blep[i] = edge * stmlib::NextBlepSample(t);
+        const float edge_before = fraction[i] + 1.0f < increment ? 1.0f : 0.0f;
+        const float t_before = (fraction[i] + 1.0f) / increment;
+        this_blep_before[i] = edge_before * stmlib::ThisBlepSample(t_before);
+        next_blep_before[i] = edge_before * stmlib::NextBlepSample(t_before);
+      }
+      
+      float sample[num_voices];
+      std::fill(&sample[0], &sample[n], 0.0f);
+      for (size_t j = 0; j < num_harmonics; ++j) {
+        // The square of the harmonic goes high at odd half periods, and both
+        // waveforms reset at even ones.
+        const int32_t shift = num_harmonics - 1 - j;
+        const int32_t half_period = 1 << shift;
+        const float inverse_half_period = 1.0f / static_cast<float>(half_period);
+        
+        // Dark square: 2 * square, low-passed. Bright square: square minus its
+        // low-passed version, halved.
+        const float drive = j == 0 ? 2.0f : 1.0f;
+        const float dry = j == 0 ? 0.0f : 0.5f;
+        const float wet = j == 0 ? 1.0f : -0.5f;
+        
+        for (size_t i = 0; i < n; ++i) {
+          // Integer arithmetic only, to keep the compiler from turning the
+          // selections into branches.
+          const int32_t s = segment[i] & (2 * half_period - 1);
+          const int32_t reset_mask = (s - 1) >> 31;
+          const int32_t rise_mask = ((s ^ half_period) - 1) >> 31;
+          const float high = static_cast<float>(s >> shift);
+          const float reset = static_cast<float>(-reset_mask);
+          const float direction = static_cast<float>(reset_mask - rise_mask);
+          
+          const int32_t s_before = (segment[i] - 1) & (2 * half_period - 1);
+          const int32_t reset_mask_before = (s_before - 1) >> 31;
+          const int32_t rise_mask_before = \
+              ((s_before ^ half_period) - 1) >> 31;
+          const float reset_before = static_cast<float>(-reset_mask_before);
+          const float direction_before = static_cast<float>(
+              reset_mask_before - rise_mask_before);
+          const float saw = 0.5f * inverse_half_period * (fraction[i] + \
+              static_cast<float>(s));
+          
+          const float this_square = next_square_[j][i] + \
+              direction * this_blep[i] + \
+              direction_before * this_blep_before[i];
+          const float this_saw = next_saw_[j][i] - reset * this_blep[i] - \
+              reset_before * this_blep_before[i];
+          next_square_[j][i] = high + direction * next_blep[i] + \
+              direction_before * next_blep_before[i];
+          next_saw_[j][i] = saw - reset * next_blep[i] - \
+              reset_before * next_blep_before[i];
+          
+          const float square = drive * (2.0f * this_square - 1.0f);
+          float filter_state = filter_state_[j][i];
+          filter_state += coefficient_[j][i] * (square - filter_state);
+          filter_state_[j][i] = filter_state;
+          
+          const float gain = gain_[j][i] + gain_step_[j][i];
+          const float gain_saw = gain_saw_[j][i] + gain_saw_step_[j][i];
+          gain_[j][i] = gain;
+          gain_saw_[j][i] = gain_saw;
+          sample[i] += (dry * square + wet * filter_state) * gain + \
+              (2.0f * this_saw - 1.0f) * gain_saw;
+        }
+      }
+      
+      // Mixes down 4 voices at a time, to shorten the chain of additions.
+      float out_sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      float aux_sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      for (size_t i = 0; i < n; i += kVoiceGroupSize) {
+        for (size_t k = 0; k < kVoiceGroupSize; ++k) {
+          out_sum[k] += sample[i + k] * (1.0f - destination_[i + k]);
+          aux_sum[k] += sample[i + k] * destination_[i + k];
+        }
+      }
+      *out++ += (out_sum[0] + out_sum[1]) + (out_sum[2] + out_sum[3]);
+      *aux++ += (aux_sum[0] + aux_sum[1]) + (aux_sum[2] + aux_sum[3]);
+    }
+    
+    // Land exactly on the targets, so that the gains of muted voices do not
+    // decay into denormals.
+    if (!end_of_ramp) {
+      return;
+    }
+    for (size_t j = 0; j < num_harmonics; ++j) {
+      for (size_t i = 0; i < n; ++i) {
+        gain_[j][i] = target_gain_[j][i];
+        gain_saw_[j][i] = target_gain_saw_[j][i];
+        target_gain_[j][i] = 0.0f;
+        target_gain_saw_[j][i] = 0.0f;
+      }
+    }
+  }
+
+ private:
+  void StartRamp(size_t n, size_t ramp_size) {
+    const float step = 1.0f / static_cast<float>(ramp_size);
+    for (size_t i = 0; i < n; ++i) {
+      increment_step_[i] = (target_increment_[i] - increment_[i]) * step;
+      float coefficient = target_increment_[i] * (2.0f / kCounterSize);
+      for (size_t j = 0; j < num_harmonics; ++j) {
+        // The integrator coefficient, twice the frequency of the harmonic,
+        // is bounded to keep the filters of muted harmonics stable.
+        coefficient_[j][i] = std::min(coefficient, 0.5f);
+        coefficient *= 2.0f;
+        gain_step_[j][i] = (target_gain_[j][i] - gain_[j][i]) * step;
+        gain_saw_step_[j][i] = (target_gain_saw_[j][i] - gain_saw_[j][i]) * \
+            step;
+      }
+    }
+    ramp_remaining_ = ramp_size;
+  }
+  
+  static const int32_t kCounterSize = 1 << num_harmonics;
+  static const size_t kVoiceGroupSize = 4;
+  
+  static_assert(num_voices % kVoiceGroupSize == 0, "Voices come by groups of 4");
+  
+  size_t num_voice_groups_;
+  
+  // Voice state, one entry per voice.
+  float phase_[num_voices];
+  float increment_[num_voices];
+  float next_square_[num_harmonics][num_voices];
+  float next_saw_[num_harmonics][num_voices];
+  float filter_state_[num_harmonics][num_voices];
+  float gain_[num_harmonics][num_voices];
+  float gain_saw_[num_harmonics][num_voices];
+  
+  // Parameters for the next block.
+  float target_increment_[num_voices];
+  float target_gain_[num_harmonics][num_voices];
+  float target_gain_saw_[num_harmonics][num_voices];
+  float destination_[num_voices];
+  
+  // Per-sample parameter increments and filter coefficients for the current
+  // ramp, and number of samples left in it.
+  size_t ramp_remaining_;
+  float increment_step_[num_voices];
+  float gain_step_[num_harmonics][num_voices];
+  float gain_saw_step_[num_harmonics][num_voices];
+  float coefficient_[num_harmonics][num_voices];
+  
+  DISALLOW_COPY_AND_ASSIGN(StringSynthOscillatorBank);
+};
+
+}  // namespace rings
+
+#endif  // RINGS_DSP_STRING_SYNTH_OSCILLATOR_BANK_H_
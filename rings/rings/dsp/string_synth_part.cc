@@ -28,6 +28,10 @@
 
 #include "rings/dsp/string_synth_part.h"
 
+#include "stmlib/dsp/denormal.h"
+#include "stmlib/dsp/units.h"
+#include "stmlib/utils/profiler.h"
+
 #include "rings/dsp/dsp.h"
 
 namespace rings {
@@ -35,16 +39,14 @@ namespace rings {
 using namespace std;
 using namespace stmlib;
 
-void StringSynthPart::Init(uint16_t* reverb_buffer) {
+void StringSynthPart::Init(uint16_t* reverb_buffer, ReverbBus* reverb_bus) {
   active_group_ = 0;
   acquisition_delay_ = 0;
   
   polyphony_ = 1;
   fx_type_ = FX_ENSEMBLE;
 
-  for (int32_t i = 0; i < kStringSynthVoices; ++i) {
-    voice_[i].Init();
-  }
+  voices_.Init();
   
   for (int32_t i = 0; i < kMaxStringSynthPolyphony; ++i) {
     group_[i].tonic = 0.0f;
@@ -57,16 +59,28 @@ void StringSynthPart::Init(uint16_t* reverb_buffer) {
   
   limiter_.Init();
   
-  reverb_.Init(reverb_buffer);
+  reverb_bus_ = reverb_bus;
+  if (!reverb_bus_) {
+    reverb_.Init(reverb_buffer);
+  }
   chorus_.Init(reverb_buffer);
   ensemble_.Init(reverb_buffer);
   
+  set_control_block_size(kDefaultControlBlockSize);
+}
+
+void StringSynthPart::set_control_block_size(size_t control_block_size) {
+  control_block_size_ = max(
+      min(control_block_size, kMaxControlBlockSize),
+      size_t(1));
   note_filter_.Init(
-      kSampleRate / kMaxBlockSize,
+      kSampleRate / control_block_size_,
       0.001f,  // Lag time with a sharp edge on the V/Oct input or trigger.
       0.005f,  // Lag time after the trigger has been received.
       0.050f,  // Time to transition from reactive to filtered.
       0.004f); // Prevent a sharp edge to partly leak on the previous voice.
+  control_countdown_ = 0;
+  strum_pending_ = false;
 }
 
 const int32_t kRegistrationTableSize = 11;
@@ -239,7 +253,7 @@ void StringSynthPart::ProcessEnvelopes(
   }
   
   // Convert the arbitrary values to actual units.
-  float period = kSampleRate / kMaxBlockSize;
+  float period = kSampleRate / control_block_size_;
   float attack_time = SemitonesToRatio(attack * 96.0f) * 0.005f * period;
   // float decay_time = SemitonesToRatio(decay * 96.0f) * 0.125f * period;
   float decay_time = SemitonesToRatio(decay * 84.0f) * 0.180f * period;
@@ -272,12 +286,6 @@ void StringSynthPart::ProcessFormantFilter(
     float* out,
     float* aux,
     size_t size) {
-  for (size_t i = 0; i < size; ++i) {
-    filter_in_buffer_[i] = out[i] + aux[i];
-  }
-  fill(&out[0], &out[size], 0.0f);
-  fill(&aux[0], &aux[size], 0.0f);
-
   vowel *= (kFormantTableSize - 1.001f);
   MAKE_INTEGRAL_FRACTIONAL(vowel);
   
@@ -287,15 +295,31 @@ void StringSynthPart::ProcessFormantFilter(
     float f = a + (b - a) * vowel_fractional;
     f *= shift;
     formant_filter_[i].set_f_q<FREQUENCY_DIRTY>(f / kSampleRate, resonance);
-    formant_filter_[i].Process<FILTER_MODE_BAND_PASS>(
-        filter_in_buffer_,
-        filter_out_buffer_,
-        size);
-    const float pan = i * 0.3f + 0.2f;
-    for (size_t j = 0; j < size; ++j) {
-      out[j] += filter_out_buffer_[j] * pan * 0.5f;
-      aux[j] += filter_out_buffer_[j] * (1.0f - pan) * 0.5f;
+  }
+  
+  // The filter buffers only hold a control block.
+  while (size) {
+    size_t block_size = min(size, kMaxControlBlockSize);
+    for (size_t i = 0; i < block_size; ++i) {
+      filter_in_buffer_[i] = out[i] + aux[i];
     }
+    fill(&out[0], &out[block_size], 0.0f);
+    fill(&aux[0], &aux[block_size], 0.0f);
+    
+    for (int32_t i = 0; i < kNumFormants; ++i) {
+      formant_filter_[i].Process<FILTER_MODE_BAND_PASS>(
+          filter_in_buffer_,
+          filter_out_buffer_,
+          block_size);
+      const float pan = i * 0.3f + 0.2f;
+      for (size_t j = 0; j < block_size; ++j) {
+        out[j] += filter_out_buffer_[j] * pan * 0.5f;
+        aux[j] += filter_out_buffer_[j] * (1.0f - pan) * 0.5f;
+      }
+    }
+    out += block_size;
+    aux += block_size;
+    size -= block_size;
   }
 }
 
@@ -304,13 +328,21 @@ struct ChordNote {
   float amplitude;
 };
 
-void StringSynthPart::Process(
+void StringSynthPart::RenderVoices(
     const PerformanceState& performance_state,
     const Patch& patch,
-    const float* in,
+    bool control_update,
     float* out,
     float* aux,
-    size_t size) {
+    size_t size,
+    size_t ramp_size) {
+  if (!control_update) {
+    // The voices keep ramping towards the targets set at the control update.
+    STMLIB_PROFILE_SCOPE("rings/string_synth/voices");
+    voices_.Render(out, aux, size, ramp_size);
+    return;
+  }
+  
   // Assign note to a voice.
   uint8_t envelope_flags[kMaxStringSynthPolyphony];
   
@@ -336,9 +368,8 @@ void StringSynthPart::Process(
   float envelope_values[kMaxStringSynthPolyphony];
   ProcessEnvelopes(patch.damping, envelope_flags, envelope_values);
   
-  copy(&in[0], &in[size], &aux[0]);
-  copy(&in[0], &in[size], &out[0]);
   int32_t chord_size = min(kStringSynthVoices / polyphony_, kMaxChordSize);
+  voices_.set_num_voices(polyphony_ * chord_size);
   for (int32_t group = 0; group < polyphony_; ++group) {
     ChordNote notes[kMaxChordSize];
     float harmonics[kNumHarmonics * 2];
@@ -377,58 +408,107 @@ void StringSynthPart::Process(
       }
 
       float frequency = SemitonesToRatio(note - 69.0f) * a3;
-      voice_[group * chord_size + chord_note].Render(
+      voices_.Configure(
+          group * chord_size + chord_note,
           frequency,
           amplitudes,
           num_harmonics,
-          (group + chord_note) & 1 ? out : aux,
-          size);
+          !((group + chord_note) & 1));
+    }
+  }
+  STMLIB_PROFILE_SCOPE("rings/string_synth/voices");
+  voices_.Render(out, aux, size, ramp_size);
+}
+
+void StringSynthPart::Process(
+    const PerformanceState& performance_state,
+    const Patch& patch,
+    const float* in,
+    float* out,
+    float* aux,
+    size_t size) {
+  STMLIB_PROFILE_SCOPE("rings/string_synth");
+  ScopedFlushDenormals flush_denormals;
+  copy(&in[0], &in[size], &aux[0]);
+  copy(&in[0], &in[size], &out[0]);
+  
+  // The voices are rendered by control blocks, which run across calls as in
+  // Part::Process(), the effects and limiter over the whole block.
+  strum_pending_ = strum_pending_ || performance_state.strum;
+  size_t start = 0;
+  while (start < size) {
+    bool control_update = !control_countdown_;
+    if (control_update) {
+      control_state_ = performance_state;
+      control_state_.strum = strum_pending_;
+      control_patch_ = patch;
+      control_countdown_ = control_block_size_;
+      strum_pending_ = false;
     }
+    size_t block_size = min(control_countdown_, size - start);
+    RenderVoices(
+        control_state_, control_patch_, control_update,
+        out + start, aux + start,
+        block_size, control_countdown_);
+    control_countdown_ -= block_size;
+    start += block_size;
   }
   
   if (clear_fx_) {
-    reverb_.Clear();
+    if (reverb_bus_) {
+      ensemble_.Clear();
+    } else {
+      reverb_.Clear();
+    }
     clear_fx_ = false;
   }
   
-  switch (fx_type_) {
-    case FX_FORMANT:
-    case FX_FORMANT_2:
-      ProcessFormantFilter(
-          patch.position,
-          fx_type_ == FX_FORMANT ? 1.0f : 1.1f,
-          fx_type_ == FX_FORMANT ? 25.0f : 10.0f,
-          out,
-          aux,
-          size);
-      break;
+  float reverb_amount = patch.position * 0.5f;
+  {
+    STMLIB_PROFILE_SCOPE("rings/string_synth/fx");
+    switch (fx_type_) {
+      case FX_FORMANT:
+      case FX_FORMANT_2:
+        ProcessFormantFilter(
+            patch.position,
+            fx_type_ == FX_FORMANT ? 1.0f : 1.1f,
+            fx_type_ == FX_FORMANT ? 25.0f : 10.0f,
+            out,
+            aux,
+            size);
+        break;
 
-    case FX_CHORUS:
-      chorus_.set_amount(patch.position);
-      chorus_.set_depth(0.15f + 0.5f * patch.position);
-      chorus_.Process(out, aux, size);
-      break;
+      case FX_CHORUS:
+        chorus_.set_amount(patch.position);
+        chorus_.set_depth(0.15f + 0.5f * patch.position);
+        chorus_.Process(out, aux, size);
+        break;
     
-    case FX_ENSEMBLE:
-      ensemble_.set_amount(patch.position * (2.0f - patch.position));
-      ensemble_.set_depth(0.2f + 0.8f * patch.position * patch.position);
-      ensemble_.Process(out, aux, size);
-      break;
+      case FX_ENSEMBLE:
+        ensemble_.set_amount(patch.position * (2.0f - patch.position));
+        ensemble_.set_depth(0.2f + 0.8f * patch.position * patch.position);
+        ensemble_.Process(out, aux, size);
+        break;
   
-    case FX_REVERB:
-    case FX_REVERB_2:
-      reverb_.set_amount(patch.position * 0.5f);
-      reverb_.set_diffusion(0.625f);
-      reverb_.set_time(fx_type_ == FX_REVERB
-        ? (0.5f + 0.49f * patch.position)
-        : (0.3f + 0.6f * patch.position));
-      reverb_.set_input_gain(0.2f);
-      reverb_.set_lp(fx_type_ == FX_REVERB ? 0.3f : 0.6f);
-      reverb_.Process(out, aux, size);
-      break;
+      case FX_REVERB:
+      case FX_REVERB_2:
+        if (reverb_bus_) {
+          // Sent after the limiter.
+          break;
+        }
+        reverb_.set_amount(reverb_amount);
+        reverb_.set_diffusion(0.625f);
+        reverb_.set_time(fx_type_ == FX_REVERB
+          ? (0.5f + 0.49f * patch.position)
+          : (0.3f + 0.6f * patch.position));
+        reverb_.set_input_gain(0.2f);
+        reverb_.set_lp(fx_type_ == FX_REVERB ? 0.3f : 0.6f);
+        reverb_.Process(out, aux, size);
+        break;
     
-    default:
-      break;
+      default:
+        break;
+    }
   }
 
   // Prevent main signal cancellation when EVEN gets summed with ODD through
@@ -436,7 +516,48 @@ void StringSynthPart::Process(
   for (size_t i = 0; i < size; ++i) {
     aux[i] = -aux[i];
   }
-  limiter_.Process(out, aux, size, 1.0f);
+  {
+    STMLIB_PROFILE_SCOPE("rings/string_synth/limiter");
+    limiter_.Process(out, aux, size, 1.0f);
+  }
+  
+  // As in Part::Process(), the send to a shared reverb follows the limiter.
+  bool reverb = fx_type_ == FX_REVERB || fx_type_ == FX_REVERB_2;
+  if (reverb && reverb_bus_) {
+    reverb_bus_->Send(out, aux, reverb_amount, size);
+    for (size_t i = 0; i < size; ++i) {
+      out[i] *= 1.0f - reverb_amount;
+      aux[i] *= 1.0f - reverb_amount;
+    }
+  }
+}
+
+void StringSynthPart::Process(
+    const PerformanceState& performance_state,
+    const Patch& patch,
+    const PartEvent* events,
+    size_t num_events,
+    const float* in,
+    float* out,
+    float* aux,
+    size_t size) {
+  PerformanceState state = performance_state;
+  Patch p = patch;
+  
+  size_t start = 0;
+  while (start < size) {
+    for (; num_events && events->time <= start; ++events, --num_events) {
+      ApplyPartEvent(*events, &state, &p);
+    }
+    
+    size_t end = min(start + kMaxBlockSize, size);
+    if (num_events && events->time < end) {
+      end = events->time;
+    }
+    Process(state, p, in + start, out + start, aux + start, end - start);
+    state.strum = false;
+    start = end;
+  }
 }
 
 }  // namespace rings
\ No newline at end of file
@@ -37,12 +37,14 @@
 #include "rings/dsp/fx/chorus.h"
 #include "rings/dsp/fx/ensemble.h"
 #include "rings/dsp/fx/reverb.h"
+#include "rings/dsp/fx/reverb_bus.h"
 #include "rings/dsp/limiter.h"
 #include "rings/dsp/note_filter.h"
+#include "rings/dsp/part_event.h"
 #include "rings/dsp/patch.h"
 #include "rings/dsp/performance_state.h"
 #include "rings/dsp/string_synth_envelope.h"
-#include "rings/dsp/string_synth_voice.h"
+#include "rings/dsp/string_synth_oscillator_bank.h"
 
 namespace rings {
 
@@ -74,8 +76,15 @@ class StringSynthPart {
   StringSynthPart() { }
   ~StringSynthPart() { }
   
-  void Init(uint16_t* reverb_buffer);
+  // The buffer is shared by the reverb, chorus and ensemble. When a reverb
+  // bus is given, FX_REVERB and FX_REVERB_2 send their wet signal to the bus
+  // instead of running the part's own reverb, and the buffer only needs to
+  // hold the ensemble delay lines (4096 words).
+  void Init(uint16_t* reverb_buffer, ReverbBus* reverb_bus = NULL);
   
+  // Processes a block of up to kMaxBlockSize samples. As in Part, the control
+  // updates run on a grid which spans calls, and a strum is applied at the
+  // next one.
   void Process(
       const PerformanceState& performance_state,
       const Patch& patch,
@@ -83,6 +92,24 @@ class StringSynthPart {
       float* out,
       float* aux,
       size_t size);
+  
+  // Processes a block of any size, applying the events (sorted by time) as
+  // Part::Process() does.
+  void Process(
+      const PerformanceState& performance_state,
+      const Patch& patch,
+      const PartEvent* events,
+      size_t num_events,
+      const float* in,
+      float* out,
+      float* aux,
+      size_t size);
+
+  inline size_t control_block_size() const { return control_block_size_; }
+  
+  // Number of samples between two updates of the envelopes and voices, up to
+  // kMaxControlBlockSize. Resets the note filter.
+  void set_control_block_size(size_t control_block_size);
 
   inline void set_polyphony(int32_t polyphony) {
     int32_t old_polyphony = polyphony_;
@@ -103,18 +130,29 @@ class StringSynthPart {
   }
   
  private:
+  // Renders size samples of the current control block, of which ramp_size
+  // samples remain. control_update is set for the first chunk of the block.
+  void RenderVoices(
+      const PerformanceState& performance_state,
+      const Patch& patch,
+      bool control_update,
+      float* out,
+      float* aux,
+      size_t size,
+      size_t ramp_size);
   void ProcessEnvelopes(float shape, uint8_t* flags, float* values);
   void ComputeRegistration(float gain, float registration, float* amplitudes);
 
   void ProcessFormantFilter(float vowel, float shift, float resonance,
                             float* out, float* aux, size_t size);
   
-  StringSynthVoice<kNumHarmonics> voice_[kStringSynthVoices];
+  StringSynthOscillatorBank<kStringSynthVoices, kNumHarmonics> voices_;
   VoiceGroup group_[kMaxStringSynthPolyphony];
   
   stmlib::Svf formant_filter_[kNumFormants];
   Ensemble ensemble_;
   Reverb reverb_;
+  ReverbBus* reverb_bus_;
   Chorus chorus_;
   Limiter limiter_;
 
@@ -123,13 +161,21 @@ class StringSynthPart {
   uint32_t step_counter_;
   int32_t polyphony_;
   int32_t acquisition_delay_;
+  size_t control_block_size_;
+  
+  // Samples left before the next control update, and the performance state
+  // and patch sampled at the last one.
+  size_t control_countdown_;
+  bool strum_pending_;
+  PerformanceState control_state_;
+  Patch control_patch_;
   
   FxType fx_type_;
   
   NoteFilter note_filter_;
   
-  float filter_in_buffer_[kMaxBlockSize];
-  float filter_out_buffer_[kMaxBlockSize];
+  float filter_in_buffer_[kMaxControlBlockSize];
+  float filter_out_buffer_[kMaxControlBlockSize];
   
   bool clear_fx_;
   
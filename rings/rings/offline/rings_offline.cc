@@ -0,0 +1,326 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Offline renderer: processes WAV files through Rings, several files at a
+// time.
+//
+// rings_offline [-o dir] [-j jobs] [-s 16|32] [-v voice]... file.wav...
+//
+// -s selects the sample format of the output: 16-bit integers, or 32-bit
+// floats (the default).
+//
+// Each -v adds a voice to the layer, described by comma-separated key=value
+// pairs: model (modal, sympathetic, string, fm, quantized, string_reverb),
+// fx (formant, chorus, reverb, formant_2, ensemble, reverb_2 - selects the
+// string synth), polyphony, note, chord, structure, brightness, damping,
+// position and gain. The results are written as stereo WAV files with the
+// same name, in the directory given by -o (by default, next to the input
+// with a .rings.wav extension).
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rings/offline/stem_processor.h"
+#include "rings/offline/wav_file.h"
+
+using namespace rings;
+using namespace std;
+
+const char* const kModelNames[] = {
+  "modal",
+  "sympathetic",
+  "string",
+  "fm",
+  "quantized",
+  "string_reverb"
+};
+
+const char* const kFxNames[] = {
+  "formant",
+  "chorus",
+  "reverb",
+  "formant_2",
+  "ensemble",
+  "reverb_2"
+};
+
+struct Options {
+  string output_directory;
+  size_t num_jobs;
+  WavSampleFormat format;
+  vector<StemVoiceSettings> voices;
+  vector<string> files;
+};
+
+struct Statistics {
+  mutex lock;
+  double audio_seconds;
+  size_t num_errors;
+};
+
+static int LookUp(const char* const* names, int num_names, const char* name) {
+  for (int i = 0; i < num_names; ++i) {
+    if (!strcmp(names[i], name)) {
+      return i;
+    }
+  }
+  char* end;
+  long index = strtol(name, &end, 10);
+  return (*end || index < 0 || index >= num_names) ? -1 : index;
+}
+
+static void DefaultVoice(StemVoiceSettings* voice) {
+  voice->string_synth = false;
+  voice->model = RESONATOR_MODEL_MODAL;
+  voice->fx = FX_FORMANT;
+  voice->polyphony = 1;
+  voice->note = 36.0f;
+  voice->chord = 0;
+  voice->patch.structure = 0.5f;
+  voice->patch.brightness = 0.5f;
+  voice->patch.damping = 0.5f;
+  voice->patch.position = 0.5f;
+  voice->gain = 1.0f;
+}
+
+static bool ParseVoice(const char* description, StemVoiceSettings* voice) {
+  DefaultVoice(voice);
+  
+  string pairs(description);
+  size_t start = 0;
+  while (start < pairs.size()) {
+    size_t end = pairs.find(',', start);
+    if (end == string::npos) {
+      end = pairs.size();
+    }
+    string pair = pairs.substr(start, end - start);
+    start = end + 1;
+    
+    size_t equal = pair.find('=');
+    if (equal == string::npos) {
+      return false;
+    }
+    string key = pair.substr(0, equal);
+    const char* value = pair.c_str() + equal + 1;
+    float number = strtof(value, NULL);
+    if (key == "model") {
+      int model = LookUp(kModelNames, RESONATOR_MODEL_LAST, value);
+      if (model < 0) {
+        return false;
+      }
+      voice->model = static_cast<ResonatorModel>(model);
+    } else if (key == "fx") {
+      int fx = LookUp(kFxNames, FX_LAST, value);
+      if (fx < 0) {
+        return false;
+      }
+      voice->string_synth = true;
+      voice->fx = static_cast<FxType>(fx);
+    } else if (key == "polyphony") {
+      voice->polyphony = max(atoi(value), 1);
+    } else if (key == "note") {
+      voice->note = number;
+    } else if (key == "chord") {
+      voice->chord = min(max(atoi(value), 0), kNumChords - 1);
+    } else if (key == "structure") {
+      voice->patch.structure = number;
+    } else if (key == "brightness") {
+      voice->patch.brightness = number;
+    } else if (key == "damping") {
+      voice->patch.damping = number;
+    } else if (key == "position") {
+      voice->patch.position = number;
+    } else if (key == "gain") {
+      voice->gain = number;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+static string OutputPath(const Options& options, const string& input) {
+  size_t slash = input.rfind('/');
+  string name = slash == string::npos ? input : input.substr(slash + 1);
+  if (options.output_directory.empty()) {
+    size_t dot = input.rfind('.');
+    string stem = (dot == string::npos || (slash != string::npos && dot < slash))
+        ? input
+        : input.substr(0, dot);
+    return stem + ".rings.wav";
+  }
+  return options.output_directory + "/" + name;
+}
+
+static void ProcessFiles(
+    const Options& options,
+    atomic<size_t>* next_file,
+    Statistics* statistics) {
+  // One processor per worker, reused from one file to the next.
+  unique_ptr<StemProcessor> processor(new StemProcessor());
+  WavReader reader;
+  WavWriter writer;
+  
+  while (true) {
+    size_t index = next_file->fetch_add(1);
+    if (index >= options.files.size()) {
+      break;
+    }
+    const string& input = options.files[index];
+    string output = OutputPath(options, input);
+    
+    auto start = chrono::steady_clock::now();
+    bool success = reader.Open(input.c_str());
+    if (success) {
+      success = writer.Open(output.c_str(), reader.sample_rate(), options.format);
+      if (success) {
+        processor->Init(&options.voices[0], options.voices.size());
+        success = processor->Process(&reader, &writer);
+        success = writer.Close() && success;
+      }
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    
+    lock_guard<mutex> lock(statistics->lock);
+    if (!success) {
+      fprintf(stderr, "%s: cannot process\n", input.c_str());
+      ++statistics->num_errors;
+    } else {
+      double seconds = static_cast<double>(reader.num_frames()) / \
+          reader.sample_rate();
+      statistics->audio_seconds += seconds;
+      printf("%s -> %s: %.1f s in %.2f s (%.1fx realtime)%s\n",
+          input.c_str(),
+          output.c_str(),
+          seconds,
+          elapsed.count(),
+          seconds / elapsed.count(),
+          reader.sample_rate() == kSampleRate
+              ? ""
+              : ", not at 48kHz: pitches are shifted");
+    }
+    reader.Close();
+  }
+}
+
+static void PrintUsage(const char* program) {
+  fprintf(stderr,
+      "Usage: %s [-o dir] [-j jobs] [-s 16|32] [-v voice]... file.wav...\n",
+      program);
+}
+
+int main(int argc, char** argv) {
+  Options options;
+  options.num_jobs = max(thread::hardware_concurrency(), 1u);
+  options.format = WAV_SAMPLE_FORMAT_FLOAT;
+  
+  int option;
+  while ((option = getopt(argc, argv, "o:j:v:s:")) != -1) {
+    switch (option) {
+      case 'o':
+        options.output_directory = optarg;
+        break;
+      
+      case 'j':
+        options.num_jobs = max(atoi(optarg), 1);
+        break;
+      
+      case 'v':
+        {
+          StemVoiceSettings voice;
+          if (!ParseVoice(optarg, &voice)) {
+            fprintf(stderr, "Invalid voice: %s\n", optarg);
+            return 1;
+          }
+          if (options.voices.size() == StemProcessor::kMaxVoices) {
+            fprintf(stderr, "Too many voices\n");
+            return 1;
+          }
+          options.voices.push_back(voice);
+        }
+        break;
+      
+      case 's':
+        if (!strcmp(optarg, "16")) {
+          options.format = WAV_SAMPLE_FORMAT_INT16;
+        } else if (!strcmp(optarg, "32")) {
+          options.format = WAV_SAMPLE_FORMAT_FLOAT;
+        } else {
+          fprintf(stderr, "Invalid sample size: %s\n", optarg);
+          PrintUsage(argv[0]);
+          return 1;
+        }
+        break;
+      
+      default:
+        PrintUsage(argv[0]);
+        return 1;
+    }
+  }
+  for (int i = optind; i < argc; ++i) {
+    options.files.push_back(argv[i]);
+  }
+  if (options.files.empty()) {
+    return 0;
+  }
+  if (options.voices.empty()) {
+    options.voices.resize(1);
+    DefaultVoice(&options.voices[0]);
+  }
+  
+  Statistics statistics;
+  statistics.audio_seconds = 0.0;
+  statistics.num_errors = 0;
+  atomic<size_t> next_file(0);
+  
+  auto start = chrono::steady_clock::now();
+  vector<thread> workers;
+  size_t num_jobs = min(options.num_jobs, options.files.size());
+  for (size_t i = 0; i < num_jobs; ++i) {
+    workers.push_back(thread(ProcessFiles, cref(options), &next_file, &statistics));
+  }
+  for (size_t i = 0; i < workers.size(); ++i) {
+    workers[i].join();
+  }
+  chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+  
+  printf("%zu files, %.1f s in %.2f s with %zu jobs (%.1fx realtime)\n",
+      options.files.size() - statistics.num_errors,
+      statistics.audio_seconds,
+      elapsed.count(),
+      num_jobs,
+      statistics.audio_seconds / elapsed.count());
+  return statistics.num_errors ? 1 : 0;
+}
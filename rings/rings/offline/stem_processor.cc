@@ -0,0 +1,132 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Streams a file through one or more Rings parts.
+
+#include "rings/offline/stem_processor.h"
+
+#include <algorithm>
+
+#include "stmlib/dsp/kernels.h"
+
+namespace rings {
+
+using namespace std;
+using namespace stmlib;
+
+void StemProcessor::Init(const StemVoiceSettings* settings, size_t num_voices) {
+  num_voices_ = min(num_voices, kMaxVoices);
+  voices_.reset(new Voice[num_voices_]);
+  
+  for (size_t i = 0; i < num_voices_; ++i) {
+    Voice* voice = &voices_[i];
+    voice->settings = settings[i];
+    voice->reverb_buffer.assign(Reverb::kBufferSize, 0);
+    if (voice->settings.string_synth) {
+      voice->string_synth_part.Init(&voice->reverb_buffer[0]);
+      voice->string_synth_part.set_polyphony(voice->settings.polyphony);
+      voice->string_synth_part.set_fx(voice->settings.fx);
+    } else {
+      voice->part.Init(&voice->reverb_buffer[0]);
+      voice->part.set_polyphony(voice->settings.polyphony);
+      voice->part.set_model(voice->settings.model);
+    }
+    
+    // Onsets are detected once per block of the module.
+    voice->strummer.Init(0.01f, kSampleRate / kDefaultControlBlockSize);
+    
+    PerformanceState* performance_state = &voice->performance_state;
+    performance_state->strum = false;
+    performance_state->internal_exciter = false;
+    performance_state->internal_strum = true;
+    performance_state->internal_note = true;
+    performance_state->tonic = voice->settings.note;
+    performance_state->note = 0.0f;
+    performance_state->fm = 0.0f;
+    performance_state->chord = voice->settings.chord;
+  }
+}
+
+void StemProcessor::RenderVoice(Voice* voice, const float* in, size_t size) {
+  // The strummer runs on blocks of the size used by the module, and the
+  // part renders the samples between two onsets in one call.
+  PerformanceState performance_state = voice->performance_state;
+  performance_state.strum = false;
+  
+  size_t start = 0;
+  for (size_t i = 0; i <= size; i += kDefaultControlBlockSize) {
+    bool strum = false;
+    if (i < size) {
+      size_t n = min(kDefaultControlBlockSize, size - i);
+      voice->strummer.Process(in + i, n, &voice->performance_state);
+      strum = voice->performance_state.strum;
+    }
+    if ((strum || i >= size) && i != start) {
+      size_t end = min(i, size);
+      if (voice->settings.string_synth) {
+        voice->string_synth_part.Process(
+            performance_state,
+            voice->settings.patch,
+            in + start,
+            out_ + start,
+            aux_ + start,
+            end - start);
+      } else {
+        voice->part.Process(
+            performance_state,
+            voice->settings.patch,
+            in + start,
+            out_ + start,
+            aux_ + start,
+            end - start);
+      }
+      start = end;
+      performance_state.strum = false;
+    }
+    performance_state.strum = performance_state.strum || strum;
+  }
+}
+
+bool StemProcessor::Process(WavReader* reader, WavWriter* writer) {
+  while (true) {
+    size_t size = reader->Read(in_, kMaxBlockSize);
+    if (!size) {
+      break;
+    }
+    fill(&left_[0], &left_[size], 0.0f);
+    fill(&right_[0], &right_[size], 0.0f);
+    for (size_t i = 0; i < num_voices_; ++i) {
+      RenderVoice(&voices_[i], in_, size);
+      float gain = voices_[i].settings.gain;
+      kernels().mix(out_, gain, left_, size);
+      kernels().mix(aux_, gain, right_, size);
+    }
+    if (!writer->Write(left_, right_, size)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace rings
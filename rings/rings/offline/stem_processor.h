@@ -0,0 +1,103 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Streams a file through one or more Rings parts, layered on top of each
+// other. The file is used as the exciter of every part, and its onsets strum
+// them, as when the input of the module is patched and nothing else is.
+
+#ifndef RINGS_OFFLINE_STEM_PROCESSOR_H_
+#define RINGS_OFFLINE_STEM_PROCESSOR_H_
+
+#include "stmlib/stmlib.h"
+
+#include <memory>
+#include <vector>
+
+#include "rings/dsp/dsp.h"
+#include "rings/dsp/part.h"
+#include "rings/dsp/patch.h"
+#include "rings/dsp/performance_state.h"
+#include "rings/dsp/string_synth_part.h"
+#include "rings/dsp/strummer.h"
+#include "rings/offline/wav_file.h"
+
+namespace rings {
+
+struct StemVoiceSettings {
+  // Use a StringSynthPart with the fx below, instead of a Part with the
+  // resonator model below.
+  bool string_synth;
+  ResonatorModel model;
+  FxType fx;
+  
+  int32_t polyphony;
+  float note;
+  int32_t chord;
+  Patch patch;
+  
+  // Level of the voice in the mix.
+  float gain;
+};
+
+class StemProcessor {
+ public:
+  static constexpr size_t kMaxVoices = 4;
+  
+  StemProcessor() : num_voices_(0) { }
+  ~StemProcessor() { }
+  
+  void Init(const StemVoiceSettings* settings, size_t num_voices);
+  
+  // Processes the whole file, from its current position. Returns false when
+  // the output cannot be written.
+  bool Process(WavReader* reader, WavWriter* writer);
+
+ private:
+  struct Voice {
+    StemVoiceSettings settings;
+    PerformanceState performance_state;
+    Strummer strummer;
+    Part part;
+    StringSynthPart string_synth_part;
+    std::vector<uint16_t> reverb_buffer;
+  };
+  
+  void RenderVoice(Voice* voice, const float* in, size_t size);
+  
+  // The parts are too large for the stack of worker threads.
+  std::unique_ptr<Voice[]> voices_;
+  size_t num_voices_;
+  
+  float in_[kMaxBlockSize];
+  float out_[kMaxBlockSize];
+  float aux_[kMaxBlockSize];
+  float left_[kMaxBlockSize];
+  float right_[kMaxBlockSize];
+  
+  DISALLOW_COPY_AND_ASSIGN(StemProcessor);
+};
+
+}  // namespace rings
+
+#endif  // RINGS_OFFLINE_STEM_PROCESSOR_H_
@@ -0,0 +1,372 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Streaming WAV file reader and writer for offline processing.
+
+#include "rings/offline/wav_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "stmlib/dsp/kernels.h"
+
+namespace rings {
+
+using namespace std;
+using namespace stmlib;
+
+// The kernel is asked to read this much ahead of the current position, and
+// the pages more than this much behind it are released.
+const size_t kPrefetchSize = 1 << 20;
+
+const size_t kWavHeaderSize = 44;
+const uint16_t kWavFormatPcm = 1;
+const uint16_t kWavFormatFloat = 3;
+const uint16_t kWavFormatExtensible = 0xfffe;
+
+static inline uint16_t Load16(const uint8_t* p) {
+  return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t Load32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24);
+}
+
+static inline void Store16(uint8_t* p, uint16_t value) {
+  p[0] = value;
+  p[1] = value >> 8;
+}
+
+static inline void Store32(uint8_t* p, uint32_t value) {
+  Store16(p, value);
+  Store16(p + 2, value >> 16);
+}
+
+/* WavReader */
+
+bool WavReader::Open(const char* path) {
+  Close();
+  
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < off_t(kWavHeaderSize)) {
+    close(fd);
+    return false;
+  }
+  size_t size = size_t(st.st_size);
+  void* mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  mapping_ = mapping;
+  mapping_size_ = size;
+  madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+  
+  if (!ParseHeader()) {
+    Close();
+    return false;
+  }
+  
+  position_ = 0;
+  prefetched_ = 0;
+  released_ = 0;
+  Prefetch(data_ - static_cast<const uint8_t*>(mapping_));
+  int16_buffer_.resize(kMaxReadSize * num_channels_);
+  float_buffer_.resize(kMaxReadSize * num_channels_);
+  return true;
+}
+
+void WavReader::Close() {
+  if (mapping_) {
+    munmap(mapping_, mapping_size_);
+  }
+  mapping_ = NULL;
+  mapping_size_ = 0;
+}
+
+bool WavReader::ParseHeader() {
+  const uint8_t* p = static_cast<const uint8_t*>(mapping_);
+  const uint8_t* end = p + mapping_size_;
+  if (memcmp(p, "RIFF", 4) || memcmp(p + 8, "WAVE", 4)) {
+    return false;
+  }
+  
+  bool has_format = false;
+  uint16_t format = 0;
+  uint16_t bits = 0;
+  p += 12;
+  while (end - p >= 8) {
+    const uint8_t* chunk = p + 8;
+    size_t chunk_size = Load32(p + 4);
+    size_t available = end - chunk;
+    if (!memcmp(p, "fmt ", 4)) {
+      if (chunk_size < 16 || available < 16) {
+        return false;
+      }
+      format = Load16(chunk);
+      num_channels_ = Load16(chunk + 2);
+      sample_rate_ = Load32(chunk + 4);
+      bits = Load16(chunk + 14);
+      if (format == kWavFormatExtensible) {
+        if (chunk_size < 26 || available < 26) {
+          return false;
+        }
+        // First two bytes of the sub-format GUID.
+        format = Load16(chunk + 24);
+      }
+      has_format = true;
+    } else if (!memcmp(p, "data", 4)) {
+      if (!has_format || !num_channels_) {
+        return false;
+      }
+      if (format == kWavFormatPcm && bits == 16) {
+        format_ = WAV_SAMPLE_FORMAT_INT16;
+      } else if (format == kWavFormatFloat && bits == 32) {
+        format_ = WAV_SAMPLE_FORMAT_FLOAT;
+      } else {
+        return false;
+      }
+      frame_size_ = num_channels_ * bits / 8;
+      data_ = chunk;
+      // Files being written, or truncated, are read up to their end.
+      num_frames_ = min(chunk_size, available) / frame_size_;
+      return true;
+    }
+    p = chunk + chunk_size + (chunk_size & 1);
+    if (p < chunk) {
+      return false;
+    }
+  }
+  return false;
+}
+
+void WavReader::Prefetch(size_t end) {
+  uint8_t* base = static_cast<uint8_t*>(mapping_);
+  size_t target = min(end + kPrefetchSize, mapping_size_);
+  while (prefetched_ < target) {
+    size_t size = min(kPrefetchSize, mapping_size_ - prefetched_);
+    madvise(base + prefetched_, size, MADV_WILLNEED);
+    prefetched_ += size;
+  }
+  while (released_ + 2 * kPrefetchSize <= end) {
+    madvise(base + released_, kPrefetchSize, MADV_DONTNEED);
+    released_ += kPrefetchSize;
+  }
+}
+
+size_t WavReader::Read(float* out, size_t size) {
+  size = min(min(size, kMaxReadSize), num_frames_ - position_);
+  if (!size) {
+    return 0;
+  }
+  const uint8_t* source = data_ + position_ * frame_size_;
+  Prefetch(source + size * frame_size_ - static_cast<uint8_t*>(mapping_));
+  
+  // The samples are copied first: the data chunk is not necessarily aligned.
+  size_t num_samples = size * num_channels_;
+  float* samples = num_channels_ == 1 ? out : &float_buffer_[0];
+  if (format_ == WAV_SAMPLE_FORMAT_INT16) {
+    memcpy(&int16_buffer_[0], source, num_samples * sizeof(int16_t));
+    kernels().int16_to_float(&int16_buffer_[0], samples, num_samples);
+  } else {
+    memcpy(samples, source, num_samples * sizeof(float));
+  }
+  
+  if (num_channels_ != 1) {
+    float scale = 1.0f / static_cast<float>(num_channels_);
+    for (size_t i = 0; i < size; ++i) {
+      float sum = 0.0f;
+      for (size_t j = 0; j < num_channels_; ++j) {
+        sum += samples[i * num_channels_ + j];
+      }
+      out[i] = sum * scale;
+    }
+  }
+  position_ += size;
+  return size;
+}
+
+/* WavWriter */
+
+bool WavWriter::Open(
+    const char* path,
+    uint32_t sample_rate,
+    WavSampleFormat format) {
+  Close();
+  
+  fd_ = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd_ < 0) {
+    return false;
+  }
+  sample_rate_ = sample_rate;
+  format_ = format;
+  frame_size_ = 2 * (format == WAV_SAMPLE_FORMAT_INT16 ? 2 : 4);
+  data_size_ = 0;
+  
+  buffer_[0].resize(kBufferSize);
+  buffer_[1].resize(kBufferSize);
+  fill_ = 0;
+  active_ = 0;
+  pending_ = -1;
+  done_ = false;
+  error_ = false;
+  
+  // Placeholder, rewritten with the actual sizes by Close(). pwrite() does
+  // not move the file offset, and the writer thread appends the audio data
+  // from it.
+  WriteHeader(0);
+  if (lseek(fd_, kWavHeaderSize, SEEK_SET) != off_t(kWavHeaderSize)) {
+    error_ = true;
+  }
+  thread_ = thread(&WavWriter::WriterThread, this);
+  return !error_;
+}
+
+void WavWriter::WriteHeader(size_t data_size) {
+  uint8_t header[kWavHeaderSize];
+  bool is_float = format_ == WAV_SAMPLE_FORMAT_FLOAT;
+  uint32_t size = min(data_size, size_t(0xffffffff - 36));
+  memcpy(header, "RIFF", 4);
+  Store32(header + 4, 36 + size);
+  memcpy(header + 8, "WAVEfmt ", 8);
+  Store32(header + 16, 16);
+  Store16(header + 20, is_float ? kWavFormatFloat : kWavFormatPcm);
+  Store16(header + 22, 2);
+  Store32(header + 24, sample_rate_);
+  Store32(header + 28, sample_rate_ * frame_size_);
+  Store16(header + 32, frame_size_);
+  Store16(header + 34, frame_size_ * 4);
+  memcpy(header + 36, "data", 4);
+  Store32(header + 40, size);
+  if (pwrite(fd_, header, kWavHeaderSize, 0) != ssize_t(kWavHeaderSize)) {
+    error_ = true;
+  }
+}
+
+bool WavWriter::Write(const float* left, const float* right, size_t size) {
+  while (size) {
+    size_t n = min(size, (kBufferSize - fill_) / frame_size_);
+    uint8_t* destination = &buffer_[active_][fill_];
+    if (format_ == WAV_SAMPLE_FORMAT_FLOAT) {
+      float* d = reinterpret_cast<float*>(destination);
+      for (size_t i = 0; i < n; ++i) {
+        d[2 * i] = left[i];
+        d[2 * i + 1] = right[i];
+      }
+    } else {
+      int16_t* d = reinterpret_cast<int16_t*>(destination);
+      for (size_t i = 0; i < n; i += WavReader::kMaxReadSize) {
+        size_t m = min(n - i, WavReader::kMaxReadSize);
+        int16_t l[WavReader::kMaxReadSize];
+        int16_t r[WavReader::kMaxReadSize];
+        kernels().float_to_int16(left + i, l, m);
+        kernels().float_to_int16(right + i, r, m);
+        for (size_t j = 0; j < m; ++j) {
+          d[2 * (i + j)] = l[j];
+          d[2 * (i + j) + 1] = r[j];
+        }
+      }
+    }
+    fill_ += n * frame_size_;
+    data_size_ += n * frame_size_;
+    left += n;
+    right += n;
+    size -= n;
+    if (fill_ == kBufferSize) {
+      Flush();
+    }
+  }
+  return !error_;
+}
+
+void WavWriter::Flush() {
+  unique_lock<mutex> lock(mutex_);
+  condition_.wait(lock, [this] { return pending_ < 0; });
+  pending_ = active_;
+  pending_size_ = fill_;
+  condition_.notify_all();
+  active_ ^= 1;
+  fill_ = 0;
+}
+
+void WavWriter::WriterThread() {
+  unique_lock<mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this] { return pending_ >= 0 || done_; });
+    if (pending_ < 0) {
+      break;
+    }
+    const uint8_t* data = &buffer_[pending_][0];
+    size_t size = pending_size_;
+    lock.unlock();
+    
+    while (size) {
+      ssize_t written = write(fd_, data, size);
+      if (written <= 0) {
+        error_ = true;
+        break;
+      }
+      data += written;
+      size -= written;
+    }
+    
+    lock.lock();
+    pending_ = -1;
+    condition_.notify_all();
+  }
+}
+
+bool WavWriter::Close() {
+  if (fd_ < 0) {
+    return true;
+  }
+  if (fill_) {
+    Flush();
+  }
+  {
+    lock_guard<mutex> lock(mutex_);
+    done_ = true;
+    condition_.notify_all();
+  }
+  thread_.join();
+  WriteHeader(data_size_);
+  if (close(fd_) != 0) {
+    error_ = true;
+  }
+  fd_ = -1;
+  buffer_[0].clear();
+  buffer_[1].clear();
+  return !error_;
+}
+
+}  // namespace rings
@@ -0,0 +1,154 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Streaming WAV file reader and writer for offline processing.
+//
+// WavReader maps the input file and converts it block by block. It asks the
+// kernel to read ahead of the current position, and releases the pages it
+// has gone past, so that the memory used does not depend on the length of
+// the file.
+//
+// WavWriter fills one of two buffers while a thread writes the other one to
+// the file. The header is completed when the file is closed.
+//
+// Only 16-bit PCM and 32-bit float files are supported.
+
+#ifndef RINGS_OFFLINE_WAV_FILE_H_
+#define RINGS_OFFLINE_WAV_FILE_H_
+
+#include "stmlib/stmlib.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rings {
+
+enum WavSampleFormat {
+  WAV_SAMPLE_FORMAT_INT16,
+  WAV_SAMPLE_FORMAT_FLOAT
+};
+
+class WavReader {
+ public:
+  // Largest number of frames read by a call to Read().
+  static constexpr size_t kMaxReadSize = 512;
+  
+  WavReader() : mapping_(NULL), mapping_size_(0) { }
+  ~WavReader() { Close(); }
+  
+  // Returns false if the file cannot be mapped, or is not a supported WAV
+  // file.
+  bool Open(const char* path);
+  void Close();
+  
+  // Reads up to size frames, averaged over the channels. Returns the number
+  // of frames read, 0 at the end of the file.
+  size_t Read(float* out, size_t size);
+  
+  inline size_t num_frames() const { return num_frames_; }
+  inline size_t num_channels() const { return num_channels_; }
+  inline uint32_t sample_rate() const { return sample_rate_; }
+  inline size_t position() const { return position_; }
+
+ private:
+  bool ParseHeader();
+  void Prefetch(size_t end);
+  
+  void* mapping_;
+  size_t mapping_size_;
+  
+  const uint8_t* data_;
+  size_t num_frames_;
+  size_t num_channels_;
+  size_t frame_size_;
+  uint32_t sample_rate_;
+  WavSampleFormat format_;
+  
+  size_t position_;
+  
+  // Offsets in the mapping of the end of the range the kernel was asked to
+  // read ahead, and of the end of the range released.
+  size_t prefetched_;
+  size_t released_;
+  
+  std::vector<int16_t> int16_buffer_;
+  std::vector<float> float_buffer_;
+  
+  DISALLOW_COPY_AND_ASSIGN(WavReader);
+};
+
+class WavWriter {
+ public:
+  // Size of each of the two buffers.
+  static constexpr size_t kBufferSize = 256 * 1024;
+  
+  WavWriter() : fd_(-1) { }
+  ~WavWriter() { Close(); }
+  
+  bool Open(
+      const char* path,
+      uint32_t sample_rate,
+      WavSampleFormat format);
+  
+  // Appends size stereo frames. Returns false when a write has failed.
+  bool Write(const float* left, const float* right, size_t size);
+  
+  // Writes the last buffer and the header. Returns false when a write has
+  // failed.
+  bool Close();
+
+ private:
+  void WriteHeader(size_t data_size);
+  void Flush();
+  void WriterThread();
+  
+  int fd_;
+  uint32_t sample_rate_;
+  WavSampleFormat format_;
+  size_t frame_size_;
+  size_t data_size_;
+  
+  std::vector<uint8_t> buffer_[2];
+  size_t fill_;
+  int active_;
+  
+  // The buffer handed over to the writer thread, with its size; -1 when the
+  // writer thread is idle.
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  int pending_;
+  size_t pending_size_;
+  bool done_;
+  std::atomic<bool> error_;
+  std::thread thread_;
+  
+  DISALLOW_COPY_AND_ASSIGN(WavWriter);
+};
+
+}  // namespace rings
+
+#endif  // RINGS_OFFLINE_WAV_FILE_H_
@@ -46,1534 +46,5 @@ const uint32_t* lookup_table_uint32_table[] = {
 	0
 };
 
-const float lut_sine[] = {
-   0.000000000e+00,  1.533980186e-03,  3.067956763e-03,  4.601926120e-03,
-   6.135884649e-03,  7.669828740e-03,  9.203754782e-03,  1.073765917e-02,
-   1.227153829e-02,  1.380538853e-02,  1.533920628e-02,  1.687298795e-02,
-   1.840672991e-02,  1.994042855e-02,  2.147408028e-02,  2.300768147e-02,
-   2.454122852e-02,  2.607471783e-02,  2.760814578e-02,  2.914150876e-02,
-   3.067480318e-02,  3.220802541e-02,  3.374117185e-02,  3.527423890e-02,
-   3.680722294e-02,  3.834012037e-02,  3.987292759e-02,  4.140564098e-02,
-   4.293825693e-02,  4.447077185e-02,  4.600318213e-02,  4.753548416e-02,
-   4.906767433e-02,  5.059974904e-02,  5.213170468e-02,  5.366353765e-02,
-   5.519524435e-02,  5.672682117e-02,  5.825826450e-02,  5.978957075e-02,
-   6.132073630e-02,  6.285175756e-02,  6.438263093e-02,  6.591335280e-02,
-   6.744391956e-02,  6.897432763e-02,  7.050457339e-02,  7.203465325e-02,
-   7.356456360e-02,  7.509430085e-02,  7.662386139e-02,  7.815324163e-02,
-   7.968243797e-02,  8.121144681e-02,  8.274026455e-02,  8.426888759e-02,
-   8.579731234e-02,  8.732553521e-02,  8.885355258e-02,  9.038136088e-02,
-   9.190895650e-02,  9.343633585e-02,  9.496349533e-02,  9.649043136e-02,
-   9.801714033e-02,  9.954361866e-02,  1.010698628e-01,  1.025958690e-01,
-   1.041216339e-01,  1.056471537e-01,  1.071724250e-01,  1.086974440e-01,
-   1.102222073e-01,  1.117467112e-01,  1.132709522e-01,  1.147949266e-01,
-   1.163186309e-01,  1.178420615e-01,  1.193652148e-01,  1.208880872e-01,
-   1.224106752e-01,  1.239329751e-01,  1.254549834e-01,  1.269766965e-01,
-   1.284981108e-01,  1.300192227e-01,  1.315400287e-01,  1.330605252e-01,
-   1.345807085e-01,  1.361005752e-01,  1.376201216e-01,  1.391393442e-01,
-   1.406582393e-01,  1.421768035e-01,  1.436950332e-01,  1.452129247e-01,
-   1.467304745e-01,  1.482476790e-01,  1.497645347e-01,  1.512810380e-01,
-   1.527971853e-01,  1.543129730e-01,  1.558283977e-01,  1.573434556e-01,
-   1.588581433e-01,  1.603724572e-01,  1.618863938e-01,  1.633999494e-01,
-   1.649131205e-01,  1.664259035e-01,  1.679382950e-01,  1.694502912e-01,
-   1.709618888e-01,  1.724730840e-01,  1.739838734e-01,  1.754942534e-01,
-   1.770042204e-01,  1.785137709e-01,  1.800229014e-01,  1.815316083e-01,
-   1.830398880e-01,  1.845477369e-01,  1.860551517e-01,  1.875621286e-01,
-   1.890686641e-01,  1.905747548e-01,  1.920803970e-01,  1.935855873e-01,
-   1.950903220e-01,  1.965945977e-01,  1.980984107e-01,  1.996017576e-01,
-   2.011046348e-01,  2.026070388e-01,  2.041089661e-01,  2.056104131e-01,
-   2.071113762e-01,  2.086118520e-01,  2.101118369e-01,  2.116113274e-01,
-   2.131103199e-01,  2.146088110e-01,  2.161067971e-01,  2.176042746e-01,
-   2.191012402e-01,  2.205976901e-01,  2.220936210e-01,  2.235890292e-01,
-   2.250839114e-01,  2.265782638e-01,  2.280720832e-01,  2.295653658e-01,
-   2.310581083e-01,  2.325503070e-01,  2.340419586e-01,  2.355330594e-01,
-   2.370236060e-01,  2.385135948e-01,  2.400030224e-01,  2.414918853e-01,
-   2.429801799e-01,  2.444679027e-01,  2.459550503e-01,  2.474416192e-01,
-   2.489276057e-01,  2.504130066e-01,  2.518978182e-01,  2.533820370e-01,
-   2.548656596e-01,  2.563486825e-01,  2.578311022e-01,  2.593129151e-01,
-   2.607941179e-01,  2.622747070e-01,  2.637546790e-01,  2.652340303e-01,
-   2.667127575e-01,  2.681908571e-01,  2.696683256e-01,  2.711451595e-01,
-   2.726213554e-01,  2.740969099e-01,  2.755718193e-01,  2.770460803e-01,
-   2.785196894e-01,  2.799926431e-01,  2.814649379e-01,  2.829365705e-01,
-   2.844075372e-01,  2.858778347e-01,  2.873474595e-01,  2.888164082e-01,
-   2.902846773e-01,  2.917522632e-01,  2.932191627e-01,  2.946853722e-01,
-   2.961508882e-01,  2.976157074e-01,  2.990798263e-01,  3.005432414e-01,
-   3.020059493e-01,  3.034679466e-01,  3.049292297e-01,  3.063897954e-01,
-   3.078496400e-01,  3.093087603e-01,  3.107671527e-01,  3.122248139e-01,
-   3.136817404e-01,  3.151379288e-01,  3.165933756e-01,  3.180480774e-01,
-   3.195020308e-01,  3.209552324e-01,  3.224076788e-01,  3.238593665e-01,
-   3.253102922e-01,  3.267604523e-01,  3.282098436e-01,  3.296584625e-01,
-   3.311063058e-01,  3.325533699e-01,  3.339996514e-01,  3.354451471e-01,
-   3.368898534e-01,  3.383337670e-01,  3.397768844e-01,  3.412192023e-01,
-   3.426607173e-01,  3.441014260e-01,  3.455413250e-01,  3.469804108e-01,
-   3.484186802e-01,  3.498561298e-01,  3.512927561e-01,  3.527285558e-01,
-   3.541635254e-01,  3.555976617e-01,  3.570309612e-01,  3.584634206e-01,
-   3.598950365e-01,  3.613258056e-01,  3.627557244e-01,  3.641847896e-01,
-   3.656129978e-01,  3.670403457e-01,  3.684668300e-01,  3.698924471e-01,
-   3.713171940e-01,  3.727410670e-01,  3.741640630e-01,  3.755861785e-01,
-   3.770074102e-01,  3.784277548e-01,  3.798472089e-01,  3.812657692e-01,
-   3.826834324e-01,  3.841001950e-01,  3.855160538e-01,  3.869310055e-01,
-   3.883450467e-01,  3.897581741e-01,  3.911703843e-01,  3.925816741e-01,
-   3.939920401e-01,  3.954014789e-01,  3.968099874e-01,  3.982175622e-01,
-   3.996241998e-01,  4.010298972e-01,  4.024346509e-01,  4.038384576e-01,
-   4.052413140e-01,  4.066432169e-01,  4.080441629e-01,  4.094441487e-01,
-   4.108431711e-01,  4.122412267e-01,  4.136383122e-01,  4.150344245e-01,
-   4.164295601e-01,  4.178237158e-01,  4.192168884e-01,  4.206090744e-01,
-   4.220002708e-01,  4.233904741e-01,  4.247796812e-01,  4.261678887e-01,
-   4.275550934e-01,  4.289412921e-01,  4.303264813e-01,  4.317106580e-01,
-   4.330938189e-01,  4.344759606e-01,  4.358570799e-01,  4.372371737e-01,
-   4.386162385e-01,  4.399942713e-01,  4.413712687e-01,  4.427472276e-01,
-   4.441221446e-01,  4.454960165e-01,  4.468688402e-01,  4.482406123e-01,
-   4.496113297e-01,  4.509809890e-01,  4.523495872e-01,  4.537171210e-01,
-   4.550835871e-01,  4.564489824e-01,  4.578133036e-01,  4.591765475e-01,
-   4.605387110e-01,  4.618997907e-01,  4.632597836e-01,  4.646186863e-01,
-   4.659764958e-01,  4.673332087e-01,  4.686888220e-01,  4.700433325e-01,
-   4.713967368e-01,  4.727490320e-01,  4.741002147e-01,  4.754502817e-01,
-   4.767992301e-01,  4.781470564e-01,  4.794937577e-01,  4.808393306e-01,
-   4.821837721e-01,  4.835270789e-01,  4.848692480e-01,  4.862102761e-01,
-   4.875501601e-01,  4.888888969e-01,  4.902264833e-01,  4.915629161e-01,
-   4.928981922e-01,  4.942323085e-01,  4.955652618e-01,  4.968970490e-01,
-   4.982276670e-01,  4.995571125e-01,  5.008853826e-01,  5.022124740e-01,
-   5.035383837e-01,  5.048631085e-01,  5.061866453e-01,  5.075089911e-01,
-   5.088301425e-01,  5.101500967e-01,  5.114688504e-01,  5.127864006e-01,
-   5.141027442e-01,  5.154178780e-01,  5.167317990e-01,  5.180445041e-01,
-   5.193559902e-01,  5.206662541e-01,  5.219752929e-01,  5.232831035e-01,
-   5.245896827e-01,  5.258950275e-01,  5.271991348e-01,  5.285020015e-01,
-   5.298036247e-01,  5.311040012e-01,  5.324031279e-01,  5.337010018e-01,
-   5.349976199e-01,  5.362929791e-01,  5.375870763e-01,  5.388799085e-01,
-   5.401714727e-01,  5.414617659e-01,  5.427507849e-01,  5.440385267e-01,
-   5.453249884e-01,  5.466101669e-01,  5.478940592e-01,  5.491766622e-01,
-   5.504579729e-01,  5.517379884e-01,  5.530167056e-01,  5.542941215e-01,
-   5.555702330e-01,  5.568450373e-01,  5.581185312e-01,  5.593907119e-01,
-   5.606615762e-01,  5.619311212e-01,  5.631993440e-01,  5.644662415e-01,
-   5.657318108e-01,  5.669960488e-01,  5.682589527e-01,  5.695205193e-01,
-   5.707807459e-01,  5.720396293e-01,  5.732971667e-01,  5.745533550e-01,
-   5.758081914e-01,  5.770616729e-01,  5.783137964e-01,  5.795645591e-01,
-   5.808139581e-01,  5.820619903e-01,  5.833086529e-01,  5.845539430e-01,
-   5.857978575e-01,  5.870403935e-01,  5.882815482e-01,  5.895213186e-01,
-   5.907597019e-01,  5.919966950e-01,  5.932322950e-01,  5.944664992e-01,
-   5.956993045e-01,  5.969307081e-01,  5.981607070e-01,  5.993892984e-01,
-   6.006164794e-01,  6.018422471e-01,  6.030665985e-01,  6.042895309e-01,
-   6.055110414e-01,  6.067311270e-01,  6.079497850e-01,  6.091670123e-01,
-   6.103828063e-01,  6.115971639e-01,  6.128100824e-01,  6.140215589e-01,
-   6.152315906e-01,  6.164401745e-01,  6.176473079e-01,  6.188529880e-01,
-   6.200572118e-01,  6.212599765e-01,  6.224612794e-01,  6.236611175e-01,
-   6.248594881e-01,  6.260563884e-01,  6.272518155e-01,  6.284457666e-01,
-   6.296382389e-01,  6.308292296e-01,  6.320187359e-01,  6.332067551e-01,
-   6.343932842e-01,  6.355783205e-01,  6.367618612e-01,  6.379439036e-01,
-   6.391244449e-01,  6.403034822e-01,  6.414810128e-01,  6.426570340e-01,
-   6.438315429e-01,  6.450045368e-01,  6.461760130e-01,  6.473459686e-01,
-   6.485144010e-01,  6.496813074e-01,  6.508466850e-01,  6.520105311e-01,
-   6.531728430e-01,  6.543336178e-01,  6.554928530e-01,  6.566505457e-01,
-   6.578066933e-01,  6.589612930e-01,  6.601143421e-01,  6.612658378e-01,
-   6.624157776e-01,  6.635641586e-01,  6.647109782e-01,  6.658562337e-01,
-   6.669999223e-01,  6.681420414e-01,  6.692825883e-01,  6.704215604e-01,
-   6.715589548e-01,  6.726947691e-01,  6.738290004e-01,  6.749616461e-01,
-   6.760927036e-01,  6.772221701e-01,  6.783500431e-01,  6.794763199e-01,
-   6.806009978e-01,  6.817240742e-01,  6.828455464e-01,  6.839654118e-01,
-   6.850836678e-01,  6.862003117e-01,  6.873153409e-01,  6.884287528e-01,
-   6.895405447e-01,  6.906507141e-01,  6.917592584e-01,  6.928661748e-01,
-   6.939714609e-01,  6.950751140e-01,  6.961771315e-01,  6.972775108e-01,
-   6.983762494e-01,  6.994733446e-01,  7.005687939e-01,  7.016625947e-01,
-   7.027547445e-01,  7.038452405e-01,  7.049340804e-01,  7.060212614e-01,
-   7.071067812e-01,  7.081906370e-01,  7.092728264e-01,  7.103533469e-01,
-   7.114321957e-01,  7.125093706e-01,  7.135848688e-01,  7.146586879e-01,
-   7.157308253e-01,  7.168012785e-01,  7.178700451e-01,  7.189371224e-01,
-   7.200025080e-01,  7.210661993e-01,  7.221281939e-01,  7.231884893e-01,
-   7.242470830e-01,  7.253039724e-01,  7.263591551e-01,  7.274126286e-01,
-   7.284643904e-01,  7.295144381e-01,  7.305627692e-01,  7.316093812e-01,
-   7.326542717e-01,  7.336974381e-01,  7.347388781e-01,  7.357785892e-01,
-   7.368165689e-01,  7.378528148e-01,  7.388873245e-01,  7.399200955e-01,
-   7.409511254e-01,  7.419804117e-01,  7.430079521e-01,  7.440337442e-01,
-   7.450577854e-01,  7.460800735e-01,  7.471006060e-01,  7.481193805e-01,
-   7.491363945e-01,  7.501516458e-01,  7.511651319e-01,  7.521768504e-01,
-   7.531867990e-01,  7.541949753e-01,  7.552013769e-01,  7.562060014e-01,
-   7.572088465e-01,  7.582099098e-01,  7.592091890e-01,  7.602066817e-01,
-   7.612023855e-01,  7.621962981e-01,  7.631884173e-01,  7.641787405e-01,
-   7.651672656e-01,  7.661539902e-01,  7.671389119e-01,  7.681220285e-01,
-   7.691033376e-01,  7.700828370e-01,  7.710605243e-01,  7.720363972e-01,
-   7.730104534e-01,  7.739826906e-01,  7.749531066e-01,  7.759216990e-01,
-   7.768884657e-01,  7.778534042e-01,  7.788165124e-01,  7.797777879e-01,
-   7.807372286e-01,  7.816948321e-01,  7.826505962e-01,  7.836045186e-01,
-   7.845565972e-01,  7.855068296e-01,  7.864552136e-01,  7.874017470e-01,
-   7.883464276e-01,  7.892892532e-01,  7.902302214e-01,  7.911693302e-01,
-   7.921065773e-01,  7.930419605e-01,  7.939754776e-01,  7.949071263e-01,
-   7.958369046e-01,  7.967648102e-01,  7.976908409e-01,  7.986149946e-01,
-   7.995372691e-01,  8.004576622e-01,  8.013761717e-01,  8.022927955e-01,
-   8.032075315e-01,  8.041203774e-01,  8.050313311e-01,  8.059403906e-01,
-   8.068475535e-01,  8.077528179e-01,  8.086561816e-01,  8.095576424e-01,
-   8.104571983e-01,  8.113548470e-01,  8.122505866e-01,  8.131444148e-01,
-   8.140363297e-01,  8.149263291e-01,  8.158144108e-01,  8.167005729e-01,
-   8.175848132e-01,  8.184671296e-01,  8.193475201e-01,  8.202259826e-01,
-   8.211025150e-01,  8.219771153e-01,  8.228497814e-01,  8.237205112e-01,
-   8.245893028e-01,  8.254561540e-01,  8.263210628e-01,  8.271840273e-01,
-   8.280450453e-01,  8.289041148e-01,  8.297612338e-01,  8.306164003e-01,
-   8.314696123e-01,  8.323208678e-01,  8.331701647e-01,  8.340175011e-01,
-   8.348628750e-01,  8.357062844e-01,  8.365477272e-01,  8.373872016e-01,
-   8.382247056e-01,  8.390602371e-01,  8.398937942e-01,  8.407253750e-01,
-   8.415549774e-01,  8.423825996e-01,  8.432082396e-01,  8.440318955e-01,
-   8.448535652e-01,  8.456732470e-01,  8.464909388e-01,  8.473066387e-01,
-   8.481203448e-01,  8.489320552e-01,  8.497417680e-01,  8.505494813e-01,
-   8.513551931e-01,  8.521589016e-01,  8.529606049e-01,  8.537603011e-01,
-   8.545579884e-01,  8.553536647e-01,  8.561473284e-01,  8.569389774e-01,
-   8.577286100e-01,  8.585162243e-01,  8.593018184e-01,  8.600853904e-01,
-   8.608669386e-01,  8.616464611e-01,  8.624239561e-01,  8.631994217e-01,
-   8.639728561e-01,  8.647442575e-01,  8.655136241e-01,  8.662809540e-01,
-   8.670462455e-01,  8.678094968e-01,  8.685707060e-01,  8.693298713e-01,
-   8.700869911e-01,  8.708420635e-01,  8.715950867e-01,  8.723460589e-01,
-   8.730949784e-01,  8.738418435e-01,  8.745866523e-01,  8.753294031e-01,
-   8.760700942e-01,  8.768087238e-01,  8.775452902e-01,  8.782797917e-01,
-   8.790122264e-01,  8.797425928e-01,  8.804708891e-01,  8.811971135e-01,
-   8.819212643e-01,  8.826433400e-01,  8.833633387e-01,  8.840812587e-01,
-   8.847970984e-01,  8.855108561e-01,  8.862225301e-01,  8.869321188e-01,
-   8.876396204e-01,  8.883450333e-01,  8.890483559e-01,  8.897495864e-01,
-   8.904487232e-01,  8.911457648e-01,  8.918407094e-01,  8.925335554e-01,
-   8.932243012e-01,  8.939129451e-01,  8.945994856e-01,  8.952839210e-01,
-   8.959662498e-01,  8.966464702e-01,  8.973245807e-01,  8.980005797e-01,
-   8.986744657e-01,  8.993462370e-01,  9.000158920e-01,  9.006834292e-01,
-   9.013488470e-01,  9.020121439e-01,  9.026733182e-01,  9.033323685e-01,
-   9.039892931e-01,  9.046440906e-01,  9.052967593e-01,  9.059472978e-01,
-   9.065957045e-01,  9.072419779e-01,  9.078861165e-01,  9.085281187e-01,
-   9.091679831e-01,  9.098057081e-01,  9.104412923e-01,  9.110747341e-01,
-   9.117060320e-01,  9.123351846e-01,  9.129621904e-01,  9.135870479e-01,
-   9.142097557e-01,  9.148303122e-01,  9.154487161e-01,  9.160649658e-01,
-   9.166790599e-01,  9.172909970e-01,  9.179007756e-01,  9.185083943e-01,
-   9.191138517e-01,  9.197171463e-01,  9.203182767e-01,  9.209172415e-01,
-   9.215140393e-01,  9.221086687e-01,  9.227011283e-01,  9.232914167e-01,
-   9.238795325e-01,  9.244654743e-01,  9.250492408e-01,  9.256308305e-01,
-   9.262102421e-01,  9.267874743e-01,  9.273625257e-01,  9.279353948e-01,
-   9.285060805e-01,  9.290745813e-01,  9.296408958e-01,  9.302050229e-01,
-   9.307669611e-01,  9.313267091e-01,  9.318842656e-01,  9.324396293e-01,
-   9.329927988e-01,  9.335437730e-01,  9.340925504e-01,  9.346391298e-01,
-   9.351835099e-01,  9.357256895e-01,  9.362656672e-01,  9.368034417e-01,
-   9.373390119e-01,  9.378723764e-01,  9.384035341e-01,  9.389324835e-01,
-   9.394592236e-01,  9.399837530e-01,  9.405060706e-01,  9.410261751e-01,
-   9.415440652e-01,  9.420597398e-01,  9.425731976e-01,  9.430844375e-01,
-   9.435934582e-01,  9.441002585e-01,  9.446048373e-01,  9.451071933e-01,
-   9.456073254e-01,  9.461052324e-01,  9.466009131e-01,  9.470943664e-01,
-   9.475855910e-01,  9.480745859e-01,  9.485613499e-01,  9.490458819e-01,
-   9.495281806e-01,  9.500082450e-01,  9.504860739e-01,  9.509616663e-01,
-   9.514350210e-01,  9.519061368e-01,  9.523750127e-01,  9.528416476e-01,
-   9.533060404e-01,  9.537681899e-01,  9.542280951e-01,  9.546857549e-01,
-   9.551411683e-01,  9.555943341e-01,  9.560452513e-01,  9.564939189e-01,
-   9.569403357e-01,  9.573845008e-01,  9.578264130e-01,  9.582660714e-01,
-   9.587034749e-01,  9.591386225e-01,  9.595715131e-01,  9.600021457e-01,
-   9.604305194e-01,  9.608566331e-01,  9.612804858e-01,  9.617020765e-01,
-   9.621214043e-01,  9.625384680e-01,  9.629532669e-01,  9.633657998e-01,
-   9.637760658e-01,  9.641840640e-01,  9.645897933e-01,  9.649932529e-01,
-   9.653944417e-01,  9.657933589e-01,  9.661900034e-01,  9.665843745e-01,
-   9.669764710e-01,  9.673662922e-01,  9.677538371e-01,  9.681391047e-01,
-   9.685220943e-01,  9.689028048e-01,  9.692812354e-01,  9.696573851e-01,
-   9.700312532e-01,  9.704028387e-01,  9.707721407e-01,  9.711391584e-01,
-   9.715038910e-01,  9.718663375e-01,  9.722264971e-01,  9.725843689e-01,
-   9.729399522e-01,  9.732932461e-01,  9.736442497e-01,  9.739929622e-01,
-   9.743393828e-01,  9.746835107e-01,  9.750253451e-01,  9.753648851e-01,
-   9.757021300e-01,  9.760370790e-01,  9.763697313e-01,  9.767000861e-01,
-   9.770281427e-01,  9.773539001e-01,  9.776773578e-01,  9.779985149e-01,
-   9.783173707e-01,  9.786339244e-01,  9.789481753e-01,  9.792601226e-01,
-   9.795697657e-01,  9.798771037e-01,  9.801821360e-01,  9.804848618e-01,
-   9.807852804e-01,  9.810833912e-01,  9.813791933e-01,  9.816726862e-01,
-   9.819638691e-01,  9.822527414e-01,  9.825393023e-01,  9.828235512e-01,
-   9.831054874e-01,  9.833851103e-01,  9.836624192e-01,  9.839374134e-01,
-   9.842100924e-01,  9.844804554e-01,  9.847485018e-01,  9.850142310e-01,
-   9.852776424e-01,  9.855387353e-01,  9.857975092e-01,  9.860539633e-01,
-   9.863080972e-01,  9.865599103e-01,  9.868094018e-01,  9.870565713e-01,
-   9.873014182e-01,  9.875439418e-01,  9.877841416e-01,  9.880220171e-01,
-   9.882575677e-01,  9.884907929e-01,  9.887216920e-01,  9.889502645e-01,
-   9.891765100e-01,  9.894004278e-01,  9.896220175e-01,  9.898412785e-01,
-   9.900582103e-01,  9.902728124e-01,  9.904850843e-01,  9.906950254e-01,
-   9.909026354e-01,  9.911079137e-01,  9.913108598e-01,  9.915114733e-01,
-   9.917097537e-01,  9.919057004e-01,  9.920993131e-01,  9.922905913e-01,
-   9.924795346e-01,  9.926661424e-01,  9.928504145e-01,  9.930323502e-01,
-   9.932119492e-01,  9.933892111e-01,  9.935641355e-01,  9.937367219e-01,
-   9.939069700e-01,  9.940748793e-01,  9.942404495e-01,  9.944036801e-01,
-   9.945645707e-01,  9.947231211e-01,  9.948793308e-01,  9.950331994e-01,
-   9.951847267e-01,  9.953339121e-01,  9.954807555e-01,  9.956252564e-01,
-   9.957674145e-01,  9.959072294e-01,  9.960447009e-01,  9.961798286e-01,
-   9.963126122e-01,  9.964430514e-01,  9.965711458e-01,  9.966968952e-01,
-   9.968202993e-01,  9.969413578e-01,  9.970600703e-01,  9.971764367e-01,
-   9.972904567e-01,  9.974021299e-01,  9.975114561e-01,  9.976184351e-01,
-   9.977230666e-01,  9.978253504e-01,  9.979252862e-01,  9.980228738e-01,
-   9.981181129e-01,  9.982110034e-01,  9.983015449e-01,  9.983897374e-01,
-   9.984755806e-01,  9.985590742e-01,  9.986402182e-01,  9.987190122e-01,
-   9.987954562e-01,  9.988695499e-01,  9.989412932e-01,  9.990106859e-01,
-   9.990777278e-01,  9.991424187e-01,  9.992047586e-01,  9.992647473e-01,
-   9.993223846e-01,  9.993776704e-01,  9.994306046e-01,  9.994811870e-01,
-   9.995294175e-01,  9.995752960e-01,  9.996188225e-01,  9.996599967e-01,
-   9.996988187e-01,  9.997352883e-01,  9.997694054e-01,  9.998011699e-01,
-   9.998305818e-01,  9.998576410e-01,  9.998823475e-01,  9.999047011e-01,
-   9.999247018e-01,  9.999423497e-01,  9.999576446e-01,  9.999705864e-01,
-   9.999811753e-01,  9.999894111e-01,  9.999952938e-01,  9.999988235e-01,
-   1.000000000e+00,  9.999988235e-01,  9.999952938e-01,  9.999894111e-01,
-   9.999811753e-01,  9.999705864e-01,  9.999576446e-01,  9.999423497e-01,
-   9.999247018e-01,  9.999047011e-01,  9.998823475e-01,  9.998576410e-01,
-   9.998305818e-01,  9.998011699e-01,  9.997694054e-01,  9.997352883e-01,
-   9.996988187e-01,  9.996599967e-01,  9.996188225e-01,  9.995752960e-01,
-   9.995294175e-01,  9.994811870e-01,  9.994306046e-01,  9.993776704e-01,
-   9.993223846e-01,  9.992647473e-01,  9.992047586e-01,  9.991424187e-01,
-   9.990777278e-01,  9.990106859e-01,  9.989412932e-01,  9.988695499e-01,
-   9.987954562e-01,  9.987190122e-01,  9.986402182e-01,  9.985590742e-01,
-   9.984755806e-01,  9.983897374e-01,  9.983015449e-01,  9.982110034e-01,
-   9.981181129e-01,  9.980228738e-01,  9.979252862e-01,  9.978253504e-01,
-   9.977230666e-01,  9.976184351e-01,  9.975114561e-01,  9.974021299e-01,
-   9.972904567e-01,  9.971764367e-01,  9.970600703e-01,  9.969413578e-01,
-   9.968202993e-01,  9.966968952e-01,  9.965711458e-01,  9.964430514e-01,
-   9.963126122e-01,  9.961798286e-01,  9.960447009e-01,  9.959072294e-01,
-   9.957674145e-01,  9.956252564e-01,  9.954807555e-01,  9.953339121e-01,
-   9.951847267e-01,  9.950331994e-01,  9.948793308e-01,  9.947231211e-01,
-   9.945645707e-01,  9.944036801e-01,  9.942404495e-01,  9.940748793e-01,
-   9.939069700e-01,  9.937367219e-01,  9.935641355e-01,  9.933892111e-01,
-   9.932119492e-01,  9.930323502e-01,  9.928504145e-01,  9.926661424e-01,
-   9.924795346e-01,  9.922905913e-01,  9.920993131e-01,  9.919057004e-01,
-   9.917097537e-01,  9.915114733e-01,  9.913108598e-01,  9.911079137e-01,
-   9.909026354e-01,  9.906950254e-01,  9.904850843e-01,  9.902728124e-01,
-   9.900582103e-01,  9.898412785e-01,  9.896220175e-01,  9.894004278e-01,
-   9.891765100e-01,  9.889502645e-01,  9.887216920e-01,  9.884907929e-01,
-   9.882575677e-01,  9.880220171e-01,  9.877841416e-01,  9.875439418e-01,
-   9.873014182e-01,  9.870565713e-01,  9.868094018e-01,  9.865599103e-01,
-   9.863080972e-01,  9.860539633e-01,  9.857975092e-01,  9.855387353e-01,
-   9.852776424e-01,  9.850142310e-01,  9.847485018e-01,  9.844804554e-01,
-   9.842100924e-01,  9.839374134e-01,  9.836624192e-01,  9.833851103e-01,
-   9.831054874e-01,  9.828235512e-01,  9.825393023e-01,  9.822527414e-01,
-   9.819638691e-01,  9.816726862e-01,  9.813791933e-01,  9.810833912e-01,
-   9.807852804e-01,  9.804848618e-01,  9.801821360e-01,  9.798771037e-01,
-   9.795697657e-01,  9.792601226e-01,  9.789481753e-01,  9.786339244e-01,
-   9.783173707e-01,  9.779985149e-01,  9.776773578e-01,  9.773539001e-01,
-   9.770281427e-01,  9.767000861e-01,  9.763697313e-01,  9.760370790e-01,
-   9.757021300e-01,  9.753648851e-01,  9.750253451e-01,  9.746835107e-01,
-   9.743393828e-01,  9.739929622e-01,  9.736442497e-01,  9.732932461e-01,
-   9.729399522e-01,  9.725843689e-01,  9.722264971e-01,  9.718663375e-01,
-   9.715038910e-01,  9.711391584e-01,  9.707721407e-01,  9.704028387e-01,
-   9.700312532e-01,  9.696573851e-01,  9.692812354e-01,  9.689028048e-01,
-   9.685220943e-01,  9.681391047e-01,  9.677538371e-01,  9.673662922e-01,
-   9.669764710e-01,  9.665843745e-01,  9.661900034e-01,  9.657933589e-01,
-   9.653944417e-01,  9.649932529e-01,  9.645897933e-01,  9.641840640e-01,
-   9.637760658e-01,  9.633657998e-01,  9.629532669e-01,  9.625384680e-01,
-   9.621214043e-01,  9.617020765e-01,  9.612804858e-01,  9.608566331e-01,
-   9.604305194e-01,  9.600021457e-01,  9.595715131e-01,  9.591386225e-01,
-   9.587034749e-01,  9.582660714e-01,  9.578264130e-01,  9.573845008e-01,
-   9.569403357e-01,  9.564939189e-01,  9.560452513e-01,  9.555943341e-01,
-   9.551411683e-01,  9.546857549e-01,  9.542280951e-01,  9.537681899e-01,
-   9.533060404e-01,  9.528416476e-01,  9.523750127e-01,  9.519061368e-01,
-   9.514350210e-01,  9.509616663e-01,  9.504860739e-01,  9.500082450e-01,
-   9.495281806e-01,  9.490458819e-01,  9.485613499e-01,  9.480745859e-01,
-   9.475855910e-01,  9.470943664e-01,  9.466009131e-01,  9.461052324e-01,
-   9.456073254e-01,  9.451071933e-01,  9.446048373e-01,  9.441002585e-01,
-   9.435934582e-01,  9.430844375e-01,  9.425731976e-01,  9.420597398e-01,
-   9.415440652e-01,  9.410261751e-01,  9.405060706e-01,  9.399837530e-01,
-   9.394592236e-01,  9.389324835e-01,  9.384035341e-01,  9.378723764e-01,
-   9.373390119e-01,  9.368034417e-01,  9.362656672e-01,  9.357256895e-01,
-   9.351835099e-01,  9.346391298e-01,  9.340925504e-01,  9.335437730e-01,
-   9.329927988e-01,  9.324396293e-01,  9.318842656e-01,  9.313267091e-01,
-   9.307669611e-01,  9.302050229e-01,  9.296408958e-01,  9.290745813e-01,
-   9.285060805e-01,  9.279353948e-01,  9.273625257e-01,  9.267874743e-01,
-   9.262102421e-01,  9.256308305e-01,  9.250492408e-01,  9.244654743e-01,
-   9.238795325e-01,  9.232914167e-01,  9.227011283e-01,  9.221086687e-01,
-   9.215140393e-01,  9.209172415e-01,  9.203182767e-01,  9.197171463e-01,
-   9.191138517e-01,  9.185083943e-01,  9.179007756e-01,  9.172909970e-01,
-   9.166790599e-01,  9.160649658e-01,  9.154487161e-01,  9.148303122e-01,
-   9.142097557e-01,  9.135870479e-01,  9.129621904e-01,  9.123351846e-01,
-   9.117060320e-01,  9.110747341e-01,  9.104412923e-01,  9.098057081e-01,
-   9.091679831e-01,  9.085281187e-01,  9.078861165e-01,  9.072419779e-01,
-   9.065957045e-01,  9.059472978e-01,  9.052967593e-01,  9.046440906e-01,
-   9.039892931e-01,  9.033323685e-01,  9.026733182e-01,  9.020121439e-01,
-   9.013488470e-01,  9.006834292e-01,  9.000158920e-01,  8.993462370e-01,
-   8.986744657e-01,  8.980005797e-01,  8.973245807e-01,  8.966464702e-01,
-   8.959662498e-01,  8.952839210e-01,  8.945994856e-01,  8.939129451e-01,
-   8.932243012e-01,  8.925335554e-01,  8.918407094e-01,  8.911457648e-01,
-   8.904487232e-01,  8.897495864e-01,  8.890483559e-01,  8.883450333e-01,
-   8.876396204e-01,  8.869321188e-01,  8.862225301e-01,  8.855108561e-01,
-   8.847970984e-01,  8.840812587e-01,  8.833633387e-01,  8.826433400e-01,
-   8.819212643e-01,  8.811971135e-01,  8.804708891e-01,  8.797425928e-01,
-   8.790122264e-01,  8.782797917e-01,  8.775452902e-01,  8.768087238e-01,
-   8.760700942e-01,  8.753294031e-01,  8.745866523e-01,  8.738418435e-01,
-   8.730949784e-01,  8.723460589e-01,  8.715950867e-01,  8.708420635e-01,
-   8.700869911e-01,  8.693298713e-01,  8.685707060e-01,  8.678094968e-01,
-   8.670462455e-01,  8.662809540e-01,  8.655136241e-01,  8.647442575e-01,
-   8.639728561e-01,  8.631994217e-01,  8.624239561e-01,  8.616464611e-01,
-   8.608669386e-01,  8.600853904e-01,  8.593018184e-01,  8.585162243e-01,
-   8.577286100e-01,  8.569389774e-01,  8.561473284e-01,  8.553536647e-01,
-   8.545579884e-01,  8.537603011e-01,  8.529606049e-01,  8.521589016e-01,
-   8.513551931e-01,  8.505494813e-01,  8.497417680e-01,  8.489320552e-01,
-   8.481203448e-01,  8.473066387e-01,  8.464909388e-01,  8.456732470e-01,
-   8.448535652e-01,  8.440318955e-01,  8.432082396e-01,  8.423825996e-01,
-   8.415549774e-01,  8.407253750e-01,  8.398937942e-01,  8.390602371e-01,
-   8.382247056e-01,  8.373872016e-01,  8.365477272e-01,  8.357062844e-01,
-   8.348628750e-01,  8.340175011e-01,  8.331701647e-01,  8.323208678e-01,
-   8.314696123e-01,  8.306164003e-01,  8.297612338e-01,  8.289041148e-01,
-   8.280450453e-01,  8.271840273e-01,  8.263210628e-01,  8.254561540e-01,
-   8.245893028e-01,  8.237205112e-01,  8.228497814e-01,  8.219771153e-01,
-   8.211025150e-01,  8.202259826e-01,  8.193475201e-01,  8.184671296e-01,
-   8.175848132e-01,  8.167005729e-01,  8.158144108e-01,  8.149263291e-01,
-   8.140363297e-01,  8.131444148e-01,  8.122505866e-01,  8.113548470e-01,
-   8.104571983e-01,  8.095576424e-01,  8.086561816e-01,  8.077528179e-01,
-   8.068475535e-01,  8.059403906e-01,  8.050313311e-01,  8.041203774e-01,
-   8.032075315e-01,  8.022927955e-01,  8.013761717e-01,  8.004576622e-01,
-   7.995372691e-01,  7.986149946e-01,  7.976908409e-01,  7.967648102e-01,
-   7.958369046e-01,  7.949071263e-01,  7.939754776e-01,  7.930419605e-01,
-   7.921065773e-01,  7.911693302e-01,  7.902302214e-01,  7.892892532e-01,
-   7.883464276e-01,  7.874017470e-01,  7.864552136e-01,  7.855068296e-01,
-   7.845565972e-01,  7.836045186e-01,  7.826505962e-01,  7.816948321e-01,
-   7.807372286e-01,  7.797777879e-01,  7.788165124e-01,  7.778534042e-01,
-   7.768884657e-01,  7.759216990e-01,  7.749531066e-01,  7.739826906e-01,
-   7.730104534e-01,  7.720363972e-01,  7.710605243e-01,  7.700828370e-01,
-   7.691033376e-01,  7.681220285e-01,  7.671389119e-01,  7.661539902e-01,
-   7.651672656e-01,  7.641787405e-01,  7.631884173e-01,  7.621962981e-01,
-   7.612023855e-01,  7.602066817e-01,  7.592091890e-01,  7.582099098e-01,
-   7.572088465e-01,  7.562060014e-01,  7.552013769e-01,  7.541949753e-01,
-   7.531867990e-01,  7.521768504e-01,  7.511651319e-01,  7.501516458e-01,
-   7.491363945e-01,  7.481193805e-01,  7.471006060e-01,  7.460800735e-01,
-   7.450577854e-01,  7.440337442e-01,  7.430079521e-01,  7.419804117e-01,
-   7.409511254e-01,  7.399200955e-01,  7.388873245e-01,  7.378528148e-01,
-   7.368165689e-01,  7.357785892e-01,  7.347388781e-01,  7.336974381e-01,
-   7.326542717e-01,  7.316093812e-01,  7.305627692e-01,  7.295144381e-01,
-   7.284643904e-01,  7.274126286e-01,  7.263591551e-01,  7.253039724e-01,
-   7.242470830e-01,  7.231884893e-01,  7.221281939e-01,  7.210661993e-01,
-   7.200025080e-01,  7.189371224e-01,  7.178700451e-01,  7.168012785e-01,
-   7.157308253e-01,  7.146586879e-01,  7.135848688e-01,  7.125093706e-01,
-   7.114321957e-01,  7.103533469e-01,  7.092728264e-01,  7.081906370e-01,
-   7.071067812e-01,  7.060212614e-01,  7.049340804e-01,  7.038452405e-01,
-   7.027547445e-01,  7.016625947e-01,  7.005687939e-01,  6.994733446e-01,
-   6.983762494e-01,  6.972775108e-01,  6.961771315e-01,  6.950751140e-01,
-   6.939714609e-01,  6.928661748e-01,  6.917592584e-01,  6.906507141e-01,
-   6.895405447e-01,  6.884287528e-01,  6.873153409e-01,  6.862003117e-01,
-   6.850836678e-01,  6.839654118e-01,  6.828455464e-01,  6.817240742e-01,
-   6.806009978e-01,  6.794763199e-01,  6.783500431e-01,  6.772221701e-01,
-   6.760927036e-01,  6.749616461e-01,  6.738290004e-01,  6.726947691e-01,
-   6.715589548e-01,  6.704215604e-01,  6.692825883e-01,  6.681420414e-01,
-   6.669999223e-01,  6.658562337e-01,  6.647109782e-01,  6.635641586e-01,
-   6.624157776e-01,  6.612658378e-01,  6.601143421e-01,  6.589612930e-01,
-   6.578066933e-01,  6.566505457e-01,  6.554928530e-01,  6.543336178e-01,
-   6.531728430e-01,  6.520105311e-01,  6.508466850e-01,  6.496813074e-01,
-   6.485144010e-01,  6.473459686e-01,  6.461760130e-01,  6.450045368e-01,
-   6.438315429e-01,  6.426570340e-01,  6.414810128e-01,  6.403034822e-01,
-   6.391244449e-01,  6.379439036e-01,  6.367618612e-01,  6.355783205e-01,
-   6.343932842e-01,  6.332067551e-01,  6.320187359e-01,  6.308292296e-01,
-   6.296382389e-01,  6.284457666e-01,  6.272518155e-01,  6.260563884e-01,
-   6.248594881e-01,  6.236611175e-01,  6.224612794e-01,  6.212599765e-01,
-   6.200572118e-01,  6.188529880e-01,  6.176473079e-01,  6.164401745e-01,
-   6.152315906e-01,  6.140215589e-01,  6.128100824e-01,  6.115971639e-01,
-   6.103828063e-01,  6.091670123e-01,  6.079497850e-01,  6.067311270e-01,
-   6.055110414e-01,  6.042895309e-01,  6.030665985e-01,  6.018422471e-01,
-   6.006164794e-01,  5.993892984e-01,  5.981607070e-01,  5.969307081e-01,
-   5.956993045e-01,  5.944664992e-01,  5.932322950e-01,  5.919966950e-01,
-   5.907597019e-01,  5.895213186e-01,  5.882815482e-01,  5.870403935e-01,
-   5.857978575e-01,  5.845539430e-01,  5.833086529e-01,  5.820619903e-01,
-   5.808139581e-01,  5.795645591e-01,  5.783137964e-01,  5.770616729e-01,
-   5.758081914e-01,  5.745533550e-01,  5.732971667e-01,  5.720396293e-01,
-   5.707807459e-01,  5.695205193e-01,  5.682589527e-01,  5.669960488e-01,
-   5.657318108e-01,  5.644662415e-01,  5.631993440e-01,  5.619311212e-01,
-   5.606615762e-01,  5.593907119e-01,  5.581185312e-01,  5.568450373e-01,
-   5.555702330e-01,  5.542941215e-01,  5.530167056e-01,  5.517379884e-01,
-   5.504579729e-01,  5.491766622e-01,  5.478940592e-01,  5.466101669e-01,
-   5.453249884e-01,  5.440385267e-01,  5.427507849e-01,  5.414617659e-01,
-   5.401714727e-01,  5.388799085e-01,  5.375870763e-01,  5.362929791e-01,
-   5.349976199e-01,  5.337010018e-01,  5.324031279e-01,  5.311040012e-01,
-   5.298036247e-01,  5.285020015e-01,  5.271991348e-01,  5.258950275e-01,
-   5.245896827e-01,  5.232831035e-01,  5.219752929e-01,  5.206662541e-01,
-   5.193559902e-01,  5.180445041e-01,  5.167317990e-01,  5.154178780e-01,
-   5.141027442e-01,  5.127864006e-01,  5.114688504e-01,  5.101500967e-01,
-   5.088301425e-01,  5.075089911e-01,  5.061866453e-01,  5.048631085e-01,
-   5.035383837e-01,  5.022124740e-01,  5.008853826e-01,  4.995571125e-01,
-   4.982276670e-01,  4.968970490e-01,  4.955652618e-01,  4.942323085e-01,
-   4.928981922e-01,  4.915629161e-01,  4.902264833e-01,  4.888888969e-01,
-   4.875501601e-01,  4.862102761e-01,  4.848692480e-01,  4.835270789e-01,
-   4.821837721e-01,  4.808393306e-01,  4.794937577e-01,  4.781470564e-01,
-   4.767992301e-01,  4.754502817e-01,  4.741002147e-01,  4.727490320e-01,
-   4.713967368e-01,  4.700433325e-01,  4.686888220e-01,  4.673332087e-01,
-   4.659764958e-01,  4.646186863e-01,  4.632597836e-01,  4.618997907e-01,
-   4.605387110e-01,  4.591765475e-01,  4.578133036e-01,  4.564489824e-01,
-   4.550835871e-01,  4.537171210e-01,  4.523495872e-01,  4.509809890e-01,
-   4.496113297e-01,  4.482406123e-01,  4.468688402e-01,  4.454960165e-01,
-   4.441221446e-01,  4.427472276e-01,  4.413712687e-01,  4.399942713e-01,
-   4.386162385e-01,  4.372371737e-01,  4.358570799e-01,  4.344759606e-01,
-   4.330938189e-01,  4.317106580e-01,  4.303264813e-01,  4.289412921e-01,
-   4.275550934e-01,  4.261678887e-01,  4.247796812e-01,  4.233904741e-01,
-   4.220002708e-01,  4.206090744e-01,  4.192168884e-01,  4.178237158e-01,
-   4.164295601e-01,  4.150344245e-01,  4.136383122e-01,  4.122412267e-01,
-   4.108431711e-01,  4.094441487e-01,  4.080441629e-01,  4.066432169e-01,
-   4.052413140e-01,  4.038384576e-01,  4.024346509e-01,  4.010298972e-01,
-   3.996241998e-01,  3.982175622e-01,  3.968099874e-01,  3.954014789e-01,
-   3.939920401e-01,  3.925816741e-01,  3.911703843e-01,  3.897581741e-01,
-   3.883450467e-01,  3.869310055e-01,  3.855160538e-01,  3.841001950e-01,
-   3.826834324e-01,  3.812657692e-01,  3.798472089e-01,  3.784277548e-01,
-   3.770074102e-01,  3.755861785e-01,  3.741640630e-01,  3.727410670e-01,
-   3.713171940e-01,  3.698924471e-01,  3.684668300e-01,  3.670403457e-01,
-   3.656129978e-01,  3.641847896e-01,  3.627557244e-01,  3.613258056e-01,
-   3.598950365e-01,  3.584634206e-01,  3.570309612e-01,  3.555976617e-01,
-   3.541635254e-01,  3.527285558e-01,  3.512927561e-01,  3.498561298e-01,
-   3.484186802e-01,  3.469804108e-01,  3.455413250e-01,  3.441014260e-01,
-   3.426607173e-01,  3.412192023e-01,  3.397768844e-01,  3.383337670e-01,
-   3.368898534e-01,  3.354451471e-01,  3.339996514e-01,  3.325533699e-01,
-   3.311063058e-01,  3.296584625e-01,  3.282098436e-01,  3.267604523e-01,
-   3.253102922e-01,  3.238593665e-01,  3.224076788e-01,  3.209552324e-01,
-   3.195020308e-01,  3.180480774e-01,  3.165933756e-01,  3.151379288e-01,
-   3.136817404e-01,  3.122248139e-01,  3.107671527e-01,  3.093087603e-01,
-   3.078496400e-01,  3.063897954e-01,  3.049292297e-01,  3.034679466e-01,
-   3.020059493e-01,  3.005432414e-01,  2.990798263e-01,  2.976157074e-01,
-   2.961508882e-01,  2.946853722e-01,  2.932191627e-01,  2.917522632e-01,
-   2.902846773e-01,  2.888164082e-01,  2.873474595e-01,  2.858778347e-01,
-   2.844075372e-01,  2.829365705e-01,  2.814649379e-01,  2.799926431e-01,
-   2.785196894e-01,  2.770460803e-01,  2.755718193e-01,  2.740969099e-01,
-   2.726213554e-01,  2.711451595e-01,  2.696683256e-01,  2.681908571e-01,
-   2.667127575e-01,  2.652340303e-01,  2.637546790e-01,  2.622747070e-01,
-   2.607941179e-01,  2.593129151e-01,  2.578311022e-01,  2.563486825e-01,
-   2.548656596e-01,  2.533820370e-01,  2.518978182e-01,  2.504130066e-01,
-   2.489276057e-01,  2.474416192e-01,  2.459550503e-01,  2.444679027e-01,
-   2.429801799e-01,  2.414918853e-01,  2.400030224e-01,  2.385135948e-01,
-   2.370236060e-01,  2.355330594e-01,  2.340419586e-01,  2.325503070e-01,
-   2.310581083e-01,  2.295653658e-01,  2.280720832e-01,  2.265782638e-01,
-   2.250839114e-01,  2.235890292e-01,  2.220936210e-01,  2.205976901e-01,
-   2.191012402e-01,  2.176042746e-01,  2.161067971e-01,  2.146088110e-01,
-   2.131103199e-01,  2.116113274e-01,  2.101118369e-01,  2.086118520e-01,
-   2.071113762e-01,  2.056104131e-01,  2.041089661e-01,  2.026070388e-01,
-   2.011046348e-01,  1.996017576e-01,  1.980984107e-01,  1.965945977e-01,
-   1.950903220e-01,  1.935855873e-01,  1.920803970e-01,  1.905747548e-01,
-   1.890686641e-01,  1.875621286e-01,  1.860551517e-01,  1.845477369e-01,
-   1.830398880e-01,  1.815316083e-01,  1.800229014e-01,  1.785137709e-01,
-   1.770042204e-01,  1.754942534e-01,  1.739838734e-01,  1.724730840e-01,
-   1.709618888e-01,  1.694502912e-01,  1.679382950e-01,  1.664259035e-01,
-   1.649131205e-01,  1.633999494e-01,  1.618863938e-01,  1.603724572e-01,
-   1.588581433e-01,  1.573434556e-01,  1.558283977e-01,  1.543129730e-01,
-   1.527971853e-01,  1.512810380e-01,  1.497645347e-01,  1.482476790e-01,
-   1.467304745e-01,  1.452129247e-01,  1.436950332e-01,  1.421768035e-01,
-   1.406582393e-01,  1.391393442e-01,  1.376201216e-01,  1.361005752e-01,
-   1.345807085e-01,  1.330605252e-01,  1.315400287e-01,  1.300192227e-01,
-   1.284981108e-01,  1.269766965e-01,  1.254549834e-01,  1.239329751e-01,
-   1.224106752e-01,  1.208880872e-01,  1.193652148e-01,  1.178420615e-01,
-   1.163186309e-01,  1.147949266e-01,  1.132709522e-01,  1.117467112e-01,
-   1.102222073e-01,  1.086974440e-01,  1.071724250e-01,  1.056471537e-01,
-   1.041216339e-01,  1.025958690e-01,  1.010698628e-01,  9.954361866e-02,
-   9.801714033e-02,  9.649043136e-02,  9.496349533e-02,  9.343633585e-02,
-   9.190895650e-02,  9.038136088e-02,  8.885355258e-02,  8.732553521e-02,
-   8.579731234e-02,  8.426888759e-02,  8.274026455e-02,  8.121144681e-02,
-   7.968243797e-02,  7.815324163e-02,  7.662386139e-02,  7.509430085e-02,
-   7.356456360e-02,  7.203465325e-02,  7.050457339e-02,  6.897432763e-02,
-   6.744391956e-02,  6.591335280e-02,  6.438263093e-02,  6.285175756e-02,
-   6.132073630e-02,  5.978957075e-02,  5.825826450e-02,  5.672682117e-02,
-   5.519524435e-02,  5.366353765e-02,  5.213170468e-02,  5.059974904e-02,
-   4.906767433e-02,  4.753548416e-02,  4.600318213e-02,  4.447077185e-02,
-   4.293825693e-02,  4.140564098e-02,  3.987292759e-02,  3.834012037e-02,
-   3.680722294e-02,  3.527423890e-02,  3.374117185e-02,  3.220802541e-02,
-   3.067480318e-02,  2.914150876e-02,  2.760814578e-02,  2.607471783e-02,
-   2.454122852e-02,  2.300768147e-02,  2.147408028e-02,  1.994042855e-02,
-   1.840672991e-02,  1.687298795e-02,  1.533920628e-02,  1.380538853e-02,
-   1.227153829e-02,  1.073765917e-02,  9.203754782e-03,  7.669828740e-03,
-   6.135884649e-03,  4.601926120e-03,  3.067956763e-03,  1.533980186e-03,
-   1.224646799e-16, -1.533980186e-03, -3.067956763e-03, -4.601926120e-03,
-  -6.135884649e-03, -7.669828740e-03, -9.203754782e-03, -1.073765917e-02,
-  -1.227153829e-02, -1.380538853e-02, -1.533920628e-02, -1.687298795e-02,
-  -1.840672991e-02, -1.994042855e-02, -2.147408028e-02, -2.300768147e-02,
-  -2.454122852e-02, -2.607471783e-02, -2.760814578e-02, -2.914150876e-02,
-  -3.067480318e-02, -3.220802541e-02, -3.374117185e-02, -3.527423890e-02,
-  -3.680722294e-02, -3.834012037e-02, -3.987292759e-02, -4.140564098e-02,
-  -4.293825693e-02, -4.447077185e-02, -4.600318213e-02, -4.753548416e-02,
-  -4.906767433e-02, -5.059974904e-02, -5.213170468e-02, -5.366353765e-02,
-  -5.519524435e-02, -5.672682117e-02, -5.825826450e-02, -5.978957075e-02,
-  -6.132073630e-02, -6.285175756e-02, -6.438263093e-02, -6.591335280e-02,
-  -6.744391956e-02, -6.897432763e-02, -7.050457339e-02, -7.203465325e-02,
-  -7.356456360e-02, -7.509430085e-02, -7.662386139e-02, -7.815324163e-02,
-  -7.968243797e-02, -8.121144681e-02, -8.274026455e-02, -8.426888759e-02,
-  -8.579731234e-02, -8.732553521e-02, -8.885355258e-02, -9.038136088e-02,
-  -9.190895650e-02, -9.343633585e-02, -9.496349533e-02, -9.649043136e-02,
-  -9.801714033e-02, -9.954361866e-02, -1.010698628e-01, -1.025958690e-01,
-  -1.041216339e-01, -1.056471537e-01, -1.071724250e-01, -1.086974440e-01,
-  -1.102222073e-01, -1.117467112e-01, -1.132709522e-01, -1.147949266e-01,
-  -1.163186309e-01, -1.178420615e-01, -1.193652148e-01, -1.208880872e-01,
-  -1.224106752e-01, -1.239329751e-01, -1.254549834e-01, -1.269766965e-01,
-  -1.284981108e-01, -1.300192227e-01, -1.315400287e-01, -1.330605252e-01,
-  -1.345807085e-01, -1.361005752e-01, -1.376201216e-01, -1.391393442e-01,
-  -1.406582393e-01, -1.421768035e-01, -1.436950332e-01, -1.452129247e-01,
-  -1.467304745e-01, -1.482476790e-01, -1.497645347e-01, -1.512810380e-01,
-  -1.527971853e-01, -1.543129730e-01, -1.558283977e-01, -1.573434556e-01,
-  -1.588581433e-01, -1.603724572e-01, -1.618863938e-01, -1.633999494e-01,
-  -1.649131205e-01, -1.664259035e-01, -1.679382950e-01, -1.694502912e-01,
-  -1.709618888e-01, -1.724730840e-01, -1.739838734e-01, -1.754942534e-01,
-  -1.770042204e-01, -1.785137709e-01, -1.800229014e-01, -1.815316083e-01,
-  -1.830398880e-01, -1.845477369e-01, -1.860551517e-01, -1.875621286e-01,
-  -1.890686641e-01, -1.905747548e-01, -1.920803970e-01, -1.935855873e-01,
-  -1.950903220e-01, -1.965945977e-01, -1.980984107e-01, -1.996017576e-01,
-  -2.011046348e-01, -2.026070388e-01, -2.041089661e-01, -2.056104131e-01,
-  -2.071113762e-01, -2.086118520e-01, -2.101118369e-01, -2.116113274e-01,
-  -2.131103199e-01, -2.146088110e-01, -2.161067971e-01, -2.176042746e-01,
-  -2.191012402e-01, -2.205976901e-01, -2.220936210e-01, -2.235890292e-01,
-  -2.250839114e-01, -2.265782638e-01, -2.280720832e-01, -2.295653658e-01,
-  -2.310581083e-01, -2.325503070e-01, -2.340419586e-01, -2.355330594e-01,
-  -2.370236060e-01, -2.385135948e-01, -2.400030224e-01, -2.414918853e-01,
-  -2.429801799e-01, -2.444679027e-01, -2.459550503e-01, -2.474416192e-01,
-  -2.489276057e-01, -2.504130066e-01, -2.518978182e-01, -2.533820370e-01,
-  -2.548656596e-01, -2.563486825e-01, -2.578311022e-01, -2.593129151e-01,
-  -2.607941179e-01, -2.622747070e-01, -2.637546790e-01, -2.652340303e-01,
-  -2.667127575e-01, -2.681908571e-01, -2.696683256e-01, -2.711451595e-01,
-  -2.726213554e-01, -2.740969099e-01, -2.755718193e-01, -2.770460803e-01,
-  -2.785196894e-01, -2.799926431e-01, -2.814649379e-01, -2.829365705e-01,
-  -2.844075372e-01, -2.858778347e-01, -2.873474595e-01, -2.888164082e-01,
-  -2.902846773e-01, -2.917522632e-01, -2.932191627e-01, -2.946853722e-01,
-  -2.961508882e-01, -2.976157074e-01, -2.990798263e-01, -3.005432414e-01,
-  -3.020059493e-01, -3.034679466e-01, -3.049292297e-01, -3.063897954e-01,
-  -3.078496400e-01, -3.093087603e-01, -3.107671527e-01, -3.122248139e-01,
-  -3.136817404e-01, -3.151379288e-01, -3.165933756e-01, -3.180480774e-01,
-  -3.195020308e-01, -3.209552324e-01, -3.224076788e-01, -3.238593665e-01,
-  -3.253102922e-01, -3.267604523e-01, -3.282098436e-01, -3.296584625e-01,
-  -3.311063058e-01, -3.325533699e-01, -3.339996514e-01, -3.354451471e-01,
-  -3.368898534e-01, -3.383337670e-01, -3.397768844e-01, -3.412192023e-01,
-  -3.426607173e-01, -3.441014260e-01, -3.455413250e-01, -3.469804108e-01,
-  -3.484186802e-01, -3.498561298e-01, -3.512927561e-01, -3.527285558e-01,
-  -3.541635254e-01, -3.555976617e-01, -3.570309612e-01, -3.584634206e-01,
-  -3.598950365e-01, -3.613258056e-01, -3.627557244e-01, -3.641847896e-01,
-  -3.656129978e-01, -3.670403457e-01, -3.684668300e-01, -3.698924471e-01,
-  -3.713171940e-01, -3.727410670e-01, -3.741640630e-01, -3.755861785e-01,
-  -3.770074102e-01, -3.784277548e-01, -3.798472089e-01, -3.812657692e-01,
-  -3.826834324e-01, -3.841001950e-01, -3.855160538e-01, -3.869310055e-01,
-  -3.883450467e-01, -3.897581741e-01, -3.911703843e-01, -3.925816741e-01,
-  -3.939920401e-01, -3.954014789e-01, -3.968099874e-01, -3.982175622e-01,
-  -3.996241998e-01, -4.010298972e-01, -4.024346509e-01, -4.038384576e-01,
-  -4.052413140e-01, -4.066432169e-01, -4.080441629e-01, -4.094441487e-01,
-  -4.108431711e-01, -4.122412267e-01, -4.136383122e-01, -4.150344245e-01,
-  -4.164295601e-01, -4.178237158e-01, -4.192168884e-01, -4.206090744e-01,
-  -4.220002708e-01, -4.233904741e-01, -4.247796812e-01, -4.261678887e-01,
-  -4.275550934e-01, -4.289412921e-01, -4.303264813e-01, -4.317106580e-01,
-  -4.330938189e-01, -4.344759606e-01, -4.358570799e-01, -4.372371737e-01,
-  -4.386162385e-01, -4.399942713e-01, -4.413712687e-01, -4.427472276e-01,
-  -4.441221446e-01, -4.454960165e-01, -4.468688402e-01, -4.482406123e-01,
-  -4.496113297e-01, -4.509809890e-01, -4.523495872e-01, -4.537171210e-01,
-  -4.550835871e-01, -4.564489824e-01, -4.578133036e-01, -4.591765475e-01,
-  -4.605387110e-01, -4.618997907e-01, -4.632597836e-01, -4.646186863e-01,
-  -4.659764958e-01, -4.673332087e-01, -4.686888220e-01, -4.700433325e-01,
-  -4.713967368e-01, -4.727490320e-01, -4.741002147e-01, -4.754502817e-01,
-  -4.767992301e-01, -4.781470564e-01, -4.794937577e-01, -4.808393306e-01,
-  -4.821837721e-01, -4.835270789e-01, -4.848692480e-01, -4.862102761e-01,
-  -4.875501601e-01, -4.888888969e-01, -4.902264833e-01, -4.915629161e-01,
-  -4.928981922e-01, -4.942323085e-01, -4.955652618e-01, -4.968970490e-01,
-  -4.982276670e-01, -4.995571125e-01, -5.008853826e-01, -5.022124740e-01,
-  -5.035383837e-01, -5.048631085e-01, -5.061866453e-01, -5.075089911e-01,
-  -5.088301425e-01, -5.101500967e-01, -5.114688504e-01, -5.127864006e-01,
-  -5.141027442e-01, -5.154178780e-01, -5.167317990e-01, -5.180445041e-01,
-  -5.193559902e-01, -5.206662541e-01, -5.219752929e-01, -5.232831035e-01,
-  -5.245896827e-01, -5.258950275e-01, -5.271991348e-01, -5.285020015e-01,
-  -5.298036247e-01, -5.311040012e-01, -5.324031279e-01, -5.337010018e-01,
-  -5.349976199e-01, -5.362929791e-01, -5.375870763e-01, -5.388799085e-01,
-  -5.401714727e-01, -5.414617659e-01, -5.427507849e-01, -5.440385267e-01,
-  -5.453249884e-01, -5.466101669e-01, -5.478940592e-01, -5.491766622e-01,
-  -5.504579729e-01, -5.517379884e-01, -5.530167056e-01, -5.542941215e-01,
-  -5.555702330e-01, -5.568450373e-01, -5.581185312e-01, -5.593907119e-01,
-  -5.606615762e-01, -5.619311212e-01, -5.631993440e-01, -5.644662415e-01,
-  -5.657318108e-01, -5.669960488e-01, -5.682589527e-01, -5.695205193e-01,
-  -5.707807459e-01, -5.720396293e-01, -5.732971667e-01, -5.745533550e-01,
-  -5.758081914e-01, -5.770616729e-01, -5.783137964e-01, -5.795645591e-01,
-  -5.808139581e-01, -5.820619903e-01, -5.833086529e-01, -5.845539430e-01,
-  -5.857978575e-01, -5.870403935e-01, -5.882815482e-01, -5.895213186e-01,
-  -5.907597019e-01, -5.919966950e-01, -5.932322950e-01, -5.944664992e-01,
-  -5.956993045e-01, -5.969307081e-01, -5.981607070e-01, -5.993892984e-01,
-  -6.006164794e-01, -6.018422471e-01, -6.030665985e-01, -6.042895309e-01,
-  -6.055110414e-01, -6.067311270e-01, -6.079497850e-01, -6.091670123e-01,
-  -6.103828063e-01, -6.115971639e-01, -6.128100824e-01, -6.140215589e-01,
-  -6.152315906e-01, -6.164401745e-01, -6.176473079e-01, -6.188529880e-01,
-  -6.200572118e-01, -6.212599765e-01, -6.224612794e-01, -6.236611175e-01,
-  -6.248594881e-01, -6.260563884e-01, -6.272518155e-01, -6.284457666e-01,
-  -6.296382389e-01, -6.308292296e-01, -6.320187359e-01, -6.332067551e-01,
-  -6.343932842e-01, -6.355783205e-01, -6.367618612e-01, -6.379439036e-01,
-  -6.391244449e-01, -6.403034822e-01, -6.414810128e-01, -6.426570340e-01,
-  -6.438315429e-01, -6.450045368e-01, -6.461760130e-01, -6.473459686e-01,
-  -6.485144010e-01, -6.496813074e-01, -6.508466850e-01, -6.520105311e-01,
-  -6.531728430e-01, -6.543336178e-01, -6.554928530e-01, -6.566505457e-01,
-  -6.578066933e-01, -6.589612930e-01, -6.601143421e-01, -6.612658378e-01,
-  -6.624157776e-01, -6.635641586e-01, -6.647109782e-01, -6.658562337e-01,
-  -6.669999223e-01, -6.681420414e-01, -6.692825883e-01, -6.704215604e-01,
-  -6.715589548e-01, -6.726947691e-01, -6.738290004e-01, -6.749616461e-01,
-  -6.760927036e-01, -6.772221701e-01, -6.783500431e-01, -6.794763199e-01,
-  -6.806009978e-01, -6.817240742e-01, -6.828455464e-01, -6.839654118e-01,
-  -6.850836678e-01, -6.862003117e-01, -6.873153409e-01, -6.884287528e-01,
-  -6.895405447e-01, -6.906507141e-01, -6.917592584e-01, -6.928661748e-01,
-  -6.939714609e-01, -6.950751140e-01, -6.961771315e-01, -6.972775108e-01,
-  -6.983762494e-01, -6.994733446e-01, -7.005687939e-01, -7.016625947e-01,
-  -7.027547445e-01, -7.038452405e-01, -7.049340804e-01, -7.060212614e-01,
-  -7.071067812e-01, -7.081906370e-01, -7.092728264e-01, -7.103533469e-01,
-  -7.114321957e-01, -7.125093706e-01, -7.135848688e-01, -7.146586879e-01,
-  -7.157308253e-01, -7.168012785e-01, -7.178700451e-01, -7.189371224e-01,
-  -7.200025080e-01, -7.210661993e-01, -7.221281939e-01, -7.231884893e-01,
-  -7.242470830e-01, -7.253039724e-01, -7.263591551e-01, -7.274126286e-01,
-  -7.284643904e-01, -7.295144381e-01, -7.305627692e-01, -7.316093812e-01,
-  -7.326542717e-01, -7.336974381e-01, -7.347388781e-01, -7.357785892e-01,
-  -7.368165689e-01, -7.378528148e-01, -7.388873245e-01, -7.399200955e-01,
-  -7.409511254e-01, -7.419804117e-01, -7.430079521e-01, -7.440337442e-01,
-  -7.450577854e-01, -7.460800735e-01, -7.471006060e-01, -7.481193805e-01,
-  -7.491363945e-01, -7.501516458e-01, -7.511651319e-01, -7.521768504e-01,
-  -7.531867990e-01, -7.541949753e-01, -7.552013769e-01, -7.562060014e-01,
-  -7.572088465e-01, -7.582099098e-01, -7.592091890e-01, -7.602066817e-01,
-  -7.612023855e-01, -7.621962981e-01, -7.631884173e-01, -7.641787405e-01,
-  -7.651672656e-01, -7.661539902e-01, -7.671389119e-01, -7.681220285e-01,
-  -7.691033376e-01, -7.700828370e-01, -7.710605243e-01, -7.720363972e-01,
-  -7.730104534e-01, -7.739826906e-01, -7.749531066e-01, -7.759216990e-01,
-  -7.768884657e-01, -7.778534042e-01, -7.788165124e-01, -7.797777879e-01,
-  -7.807372286e-01, -7.816948321e-01, -7.826505962e-01, -7.836045186e-01,
-  -7.845565972e-01, -7.855068296e-01, -7.864552136e-01, -7.874017470e-01,
-  -7.883464276e-01, -7.892892532e-01, -7.902302214e-01, -7.911693302e-01,
-  -7.921065773e-01, -7.930419605e-01, -7.939754776e-01, -7.949071263e-01,
-  -7.958369046e-01, -7.967648102e-01, -7.976908409e-01, -7.986149946e-01,
-  -7.995372691e-01, -8.004576622e-01, -8.013761717e-01, -8.022927955e-01,
-  -8.032075315e-01, -8.041203774e-01, -8.050313311e-01, -8.059403906e-01,
-  -8.068475535e-01, -8.077528179e-01, -8.086561816e-01, -8.095576424e-01,
-  -8.104571983e-01, -8.113548470e-01, -8.122505866e-01, -8.131444148e-01,
-  -8.140363297e-01, -8.149263291e-01, -8.158144108e-01, -8.167005729e-01,
-  -8.175848132e-01, -8.184671296e-01, -8.193475201e-01, -8.202259826e-01,
-  -8.211025150e-01, -8.219771153e-01, -8.228497814e-01, -8.237205112e-01,
-  -8.245893028e-01, -8.254561540e-01, -8.263210628e-01, -8.271840273e-01,
-  -8.280450453e-01, -8.289041148e-01, -8.297612338e-01, -8.306164003e-01,
-  -8.314696123e-01, -8.323208678e-01, -8.331701647e-01, -8.340175011e-01,
-  -8.348628750e-01, -8.357062844e-01, -8.365477272e-01, -8.373872016e-01,
-  -8.382247056e-01, -8.390602371e-01, -8.398937942e-01, -8.407253750e-01,
-  -8.415549774e-01, -8.423825996e-01, -8.432082396e-01, -8.440318955e-01,
-  -8.448535652e-01, -8.456732470e-01, -8.464909388e-01, -8.473066387e-01,
-  -8.481203448e-01, -8.489320552e-01, -8.497417680e-01, -8.505494813e-01,
-  -8.513551931e-01, -8.521589016e-01, -8.529606049e-01, -8.537603011e-01,
-  -8.545579884e-01, -8.553536647e-01, -8.561473284e-01, -8.569389774e-01,
-  -8.577286100e-01, -8.585162243e-01, -8.593018184e-01, -8.600853904e-01,
-  -8.608669386e-01, -8.616464611e-01, -8.624239561e-01, -8.631994217e-01,
-  -8.639728561e-01, -8.647442575e-01, -8.655136241e-01, -8.662809540e-01,
-  -8.670462455e-01, -8.678094968e-01, -8.685707060e-01, -8.693298713e-01,
-  -8.700869911e-01, -8.708420635e-01, -8.715950867e-01, -8.723460589e-01,
-  -8.730949784e-01, -8.738418435e-01, -8.745866523e-01, -8.753294031e-01,
-  -8.760700942e-01, -8.768087238e-01, -8.775452902e-01, -8.782797917e-01,
-  -8.790122264e-01, -8.797425928e-01, -8.804708891e-01, -8.811971135e-01,
-  -8.819212643e-01, -8.826433400e-01, -8.833633387e-01, -8.840812587e-01,
-  -8.847970984e-01, -8.855108561e-01, -8.862225301e-01, -8.869321188e-01,
-  -8.876396204e-01, -8.883450333e-01, -8.890483559e-01, -8.897495864e-01,
-  -8.904487232e-01, -8.911457648e-01, -8.918407094e-01, -8.925335554e-01,
-  -8.932243012e-01, -8.939129451e-01, -8.945994856e-01, -8.952839210e-01,
-  -8.959662498e-01, -8.966464702e-01, -8.973245807e-01, -8.980005797e-01,
-  -8.986744657e-01, -8.993462370e-01, -9.000158920e-01, -9.006834292e-01,
-  -9.013488470e-01, -9.020121439e-01, -9.026733182e-01, -9.033323685e-01,
-  -9.039892931e-01, -9.046440906e-01, -9.052967593e-01, -9.059472978e-01,
-  -9.065957045e-01, -9.072419779e-01, -9.078861165e-01, -9.085281187e-01,
-  -9.091679831e-01, -9.098057081e-01, -9.104412923e-01, -9.110747341e-01,
-  -9.117060320e-01, -9.123351846e-01, -9.129621904e-01, -9.135870479e-01,
-  -9.142097557e-01, -9.148303122e-01, -9.154487161e-01, -9.160649658e-01,
-  -9.166790599e-01, -9.172909970e-01, -9.179007756e-01, -9.185083943e-01,
-  -9.191138517e-01, -9.197171463e-01, -9.203182767e-01, -9.209172415e-01,
-  -9.215140393e-01, -9.221086687e-01, -9.227011283e-01, -9.232914167e-01,
-  -9.238795325e-01, -9.244654743e-01, -9.250492408e-01, -9.256308305e-01,
-  -9.262102421e-01, -9.267874743e-01, -9.273625257e-01, -9.279353948e-01,
-  -9.285060805e-01, -9.290745813e-01, -9.296408958e-01, -9.302050229e-01,
-  -9.307669611e-01, -9.313267091e-01, -9.318842656e-01, -9.324396293e-01,
-  -9.329927988e-01, -9.335437730e-01, -9.340925504e-01, -9.346391298e-01,
-  -9.351835099e-01, -9.357256895e-01, -9.362656672e-01, -9.368034417e-01,
-  -9.373390119e-01, -9.378723764e-01, -9.384035341e-01, -9.389324835e-01,
-  -9.394592236e-01, -9.399837530e-01, -9.405060706e-01, -9.410261751e-01,
-  -9.415440652e-01, -9.420597398e-01, -9.425731976e-01, -9.430844375e-01,
-  -9.435934582e-01, -9.441002585e-01, -9.446048373e-01, -9.451071933e-01,
-  -9.456073254e-01, -9.461052324e-01, -9.466009131e-01, -9.470943664e-01,
-  -9.475855910e-01, -9.480745859e-01, -9.485613499e-01, -9.490458819e-01,
-  -9.495281806e-01, -9.500082450e-01, -9.504860739e-01, -9.509616663e-01,
-  -9.514350210e-01, -9.519061368e-01, -9.523750127e-01, -9.528416476e-01,
-  -9.533060404e-01, -9.537681899e-01, -9.542280951e-01, -9.546857549e-01,
-  -9.551411683e-01, -9.555943341e-01, -9.560452513e-01, -9.564939189e-01,
-  -9.569403357e-01, -9.573845008e-01, -9.578264130e-01, -9.582660714e-01,
-  -9.587034749e-01, -9.591386225e-01, -9.595715131e-01, -9.600021457e-01,
-  -9.604305194e-01, -9.608566331e-01, -9.612804858e-01, -9.617020765e-01,
-  -9.621214043e-01, -9.625384680e-01, -9.629532669e-01, -9.633657998e-01,
-  -9.637760658e-01, -9.641840640e-01, -9.645897933e-01, -9.649932529e-01,
-  -9.653944417e-01, -9.657933589e-01, -9.661900034e-01, -9.665843745e-01,
-  -9.669764710e-01, -9.673662922e-01, -9.677538371e-01, -9.681391047e-01,
-  -9.685220943e-01, -9.689028048e-01, -9.692812354e-01, -9.696573851e-01,
-  -9.700312532e-01, -9.704028387e-01, -9.707721407e-01, -9.711391584e-01,
-  -9.715038910e-01, -9.718663375e-01, -9.722264971e-01, -9.725843689e-01,
-  -9.729399522e-01, -9.732932461e-01, -9.736442497e-01, -9.739929622e-01,
-  -9.743393828e-01, -9.746835107e-01, -9.750253451e-01, -9.753648851e-01,
-  -9.757021300e-01, -9.760370790e-01, -9.763697313e-01, -9.767000861e-01,
-  -9.770281427e-01, -9.773539001e-01, -9.776773578e-01, -9.779985149e-01,
-  -9.783173707e-01, -9.786339244e-01, -9.789481753e-01, -9.792601226e-01,
-  -9.795697657e-01, -9.798771037e-01, -9.801821360e-01, -9.804848618e-01,
-  -9.807852804e-01, -9.810833912e-01, -9.813791933e-01, -9.816726862e-01,
-  -9.819638691e-01, -9.822527414e-01, -9.825393023e-01, -9.828235512e-01,
-  -9.831054874e-01, -9.833851103e-01, -9.836624192e-01, -9.839374134e-01,
-  -9.842100924e-01, -9.844804554e-01, -9.847485018e-01, -9.850142310e-01,
-  -9.852776424e-01, -9.855387353e-01, -9.857975092e-01, -9.860539633e-01,
-  -9.863080972e-01, -9.865599103e-01, -9.868094018e-01, -9.870565713e-01,
-  -9.873014182e-01, -9.875439418e-01, -9.877841416e-01, -9.880220171e-01,
-  -9.882575677e-01, -9.884907929e-01, -9.887216920e-01, -9.889502645e-01,
-  -9.891765100e-01, -9.894004278e-01, -9.896220175e-01, -9.898412785e-01,
-  -9.900582103e-01, -9.902728124e-01, -9.904850843e-01, -9.906950254e-01,
-  -9.909026354e-01, -9.911079137e-01, -9.913108598e-01, -9.915114733e-01,
-  -9.917097537e-01, -9.919057004e-01, -9.920993131e-01, -9.922905913e-01,
-  -9.924795346e-01, -9.926661424e-01, -9.928504145e-01, -9.930323502e-01,
-  -9.932119492e-01, -9.933892111e-01, -9.935641355e-01, -9.937367219e-01,
-  -9.939069700e-01, -9.940748793e-01, -9.942404495e-01, -9.944036801e-01,
-  -9.945645707e-01, -9.947231211e-01, -9.948793308e-01, -9.950331994e-01,
-  -9.951847267e-01, -9.953339121e-01, -9.954807555e-01, -9.956252564e-01,
-  -9.957674145e-01, -9.959072294e-01, -9.960447009e-01, -9.961798286e-01,
-  -9.963126122e-01, -9.964430514e-01, -9.965711458e-01, -9.966968952e-01,
-  -9.968202993e-01, -9.969413578e-01, -9.970600703e-01, -9.971764367e-01,
-  -9.972904567e-01, -9.974021299e-01, -9.975114561e-01, -9.976184351e-01,
-  -9.977230666e-01, -9.978253504e-01, -9.979252862e-01, -9.980228738e-01,
-  -9.981181129e-01, -9.982110034e-01, -9.983015449e-01, -9.983897374e-01,
-  -9.984755806e-01, -9.985590742e-01, -9.986402182e-01, -9.987190122e-01,
-  -9.987954562e-01, -9.988695499e-01, -9.989412932e-01, -9.990106859e-01,
-  -9.990777278e-01, -9.991424187e-01, -9.992047586e-01, -9.992647473e-01,
-  -9.993223846e-01, -9.993776704e-01, -9.994306046e-01, -9.994811870e-01,
-  -9.995294175e-01, -9.995752960e-01, -9.996188225e-01, -9.996599967e-01,
-  -9.996988187e-01, -9.997352883e-01, -9.997694054e-01, -9.998011699e-01,
-  -9.998305818e-01, -9.998576410e-01, -9.998823475e-01, -9.999047011e-01,
-  -9.999247018e-01, -9.999423497e-01, -9.999576446e-01, -9.999705864e-01,
-  -9.999811753e-01, -9.999894111e-01, -9.999952938e-01, -9.999988235e-01,
-  -1.000000000e+00, -9.999988235e-01, -9.999952938e-01, -9.999894111e-01,
-  -9.999811753e-01, -9.999705864e-01, -9.999576446e-01, -9.999423497e-01,
-  -9.999247018e-01, -9.999047011e-01, -9.998823475e-01, -9.998576410e-01,
-  -9.998305818e-01, -9.998011699e-01, -9.997694054e-01, -9.997352883e-01,
-  -9.996988187e-01, -9.996599967e-01, -9.996188225e-01, -9.995752960e-01,
-  -9.995294175e-01, -9.994811870e-01, -9.994306046e-01, -9.993776704e-01,
-  -9.993223846e-01, -9.992647473e-01, -9.992047586e-01, -9.991424187e-01,
-  -9.990777278e-01, -9.990106859e-01, -9.989412932e-01, -9.988695499e-01,
-  -9.987954562e-01, -9.987190122e-01, -9.986402182e-01, -9.985590742e-01,
-  -9.984755806e-01, -9.983897374e-01, -9.983015449e-01, -9.982110034e-01,
-  -9.981181129e-01, -9.980228738e-01, -9.979252862e-01, -9.978253504e-01,
-  -9.977230666e-01, -9.976184351e-01, -9.975114561e-01, -9.974021299e-01,
-  -9.972904567e-01, -9.971764367e-01, -9.970600703e-01, -9.969413578e-01,
-  -9.968202993e-01, -9.966968952e-01, -9.965711458e-01, -9.964430514e-01,
-  -9.963126122e-01, -9.961798286e-01, -9.960447009e-01, -9.959072294e-01,
-  -9.957674145e-01, -9.956252564e-01, -9.954807555e-01, -9.953339121e-01,
-  -9.951847267e-01, -9.950331994e-01, -9.948793308e-01, -9.947231211e-01,
-  -9.945645707e-01, -9.944036801e-01, -9.942404495e-01, -9.940748793e-01,
-  -9.939069700e-01, -9.937367219e-01, -9.935641355e-01, -9.933892111e-01,
-  -9.932119492e-01, -9.930323502e-01, -9.928504145e-01, -9.926661424e-01,
-  -9.924795346e-01, -9.922905913e-01, -9.920993131e-01, -9.919057004e-01,
-  -9.917097537e-01, -9.915114733e-01, -9.913108598e-01, -9.911079137e-01,
-  -9.909026354e-01, -9.906950254e-01, -9.904850843e-01, -9.902728124e-01,
-  -9.900582103e-01, -9.898412785e-01, -9.896220175e-01, -9.894004278e-01,
-  -9.891765100e-01, -9.889502645e-01, -9.887216920e-01, -9.884907929e-01,
-  -9.882575677e-01, -9.880220171e-01, -9.877841416e-01, -9.875439418e-01,
-  -9.873014182e-01, -9.870565713e-01, -9.868094018e-01, -9.865599103e-01,
-  -9.863080972e-01, -9.860539633e-01, -9.857975092e-01, -9.855387353e-01,
-  -9.852776424e-01, -9.850142310e-01, -9.847485018e-01, -9.844804554e-01,
-  -9.842100924e-01, -9.839374134e-01, -9.836624192e-01, -9.833851103e-01,
-  -9.831054874e-01, -9.828235512e-01, -9.825393023e-01, -9.822527414e-01,
-  -9.819638691e-01, -9.816726862e-01, -9.813791933e-01, -9.810833912e-01,
-  -9.807852804e-01, -9.804848618e-01, -9.801821360e-01, -9.798771037e-01,
-  -9.795697657e-01, -9.792601226e-01, -9.789481753e-01, -9.786339244e-01,
-  -9.783173707e-01, -9.779985149e-01, -9.776773578e-01, -9.773539001e-01,
-  -9.770281427e-01, -9.767000861e-01, -9.763697313e-01, -9.760370790e-01,
-  -9.757021300e-01, -9.753648851e-01, -9.750253451e-01, -9.746835107e-01,
-  -9.743393828e-01, -9.739929622e-01, -9.736442497e-01, -9.732932461e-01,
-  -9.729399522e-01, -9.725843689e-01, -9.722264971e-01, -9.718663375e-01,
-  -9.715038910e-01, -9.711391584e-01, -9.707721407e-01, -9.704028387e-01,
-  -9.700312532e-01, -9.696573851e-01, -9.692812354e-01, -9.689028048e-01,
-  -9.685220943e-01, -9.681391047e-01, -9.677538371e-01, -9.673662922e-01,
-  -9.669764710e-01, -9.665843745e-01, -9.661900034e-01, -9.657933589e-01,
-  -9.653944417e-01, -9.649932529e-01, -9.645897933e-01, -9.641840640e-01,
-  -9.637760658e-01, -9.633657998e-01, -9.629532669e-01, -9.625384680e-01,
-  -9.621214043e-01, -9.617020765e-01, -9.612804858e-01, -9.608566331e-01,
-  -9.604305194e-01, -9.600021457e-01, -9.595715131e-01, -9.591386225e-01,
-  -9.587034749e-01, -9.582660714e-01, -9.578264130e-01, -9.573845008e-01,
-  -9.569403357e-01, -9.564939189e-01, -9.560452513e-01, -9.555943341e-01,
-  -9.551411683e-01, -9.546857549e-01, -9.542280951e-01, -9.537681899e-01,
-  -9.533060404e-01, -9.528416476e-01, -9.523750127e-01, -9.519061368e-01,
-  -9.514350210e-01, -9.509616663e-01, -9.504860739e-01, -9.500082450e-01,
-  -9.495281806e-01, -9.490458819e-01, -9.485613499e-01, -9.480745859e-01,
-  -9.475855910e-01, -9.470943664e-01, -9.466009131e-01, -9.461052324e-01,
-  -9.456073254e-01, -9.451071933e-01, -9.446048373e-01, -9.441002585e-01,
-  -9.435934582e-01, -9.430844375e-01, -9.425731976e-01, -9.420597398e-01,
-  -9.415440652e-01, -9.410261751e-01, -9.405060706e-01, -9.399837530e-01,
-  -9.394592236e-01, -9.389324835e-01, -9.384035341e-01, -9.378723764e-01,
-  -9.373390119e-01, -9.368034417e-01, -9.362656672e-01, -9.357256895e-01,
-  -9.351835099e-01, -9.346391298e-01, -9.340925504e-01, -9.335437730e-01,
-  -9.329927988e-01, -9.324396293e-01, -9.318842656e-01, -9.313267091e-01,
-  -9.307669611e-01, -9.302050229e-01, -9.296408958e-01, -9.290745813e-01,
-  -9.285060805e-01, -9.279353948e-01, -9.273625257e-01, -9.267874743e-01,
-  -9.262102421e-01, -9.256308305e-01, -9.250492408e-01, -9.244654743e-01,
-  -9.238795325e-01, -9.232914167e-01, -9.227011283e-01, -9.221086687e-01,
-  -9.215140393e-01, -9.209172415e-01, -9.203182767e-01, -9.197171463e-01,
-  -9.191138517e-01, -9.185083943e-01, -9.179007756e-01, -9.172909970e-01,
-  -9.166790599e-01, -9.160649658e-01, -9.154487161e-01, -9.148303122e-01,
-  -9.142097557e-01, -9.135870479e-01, -9.129621904e-01, -9.123351846e-01,
-  -9.117060320e-01, -9.110747341e-01, -9.104412923e-01, -9.098057081e-01,
-  -9.091679831e-01, -9.085281187e-01, -9.078861165e-01, -9.072419779e-01,
-  -9.065957045e-01, -9.059472978e-01, -9.052967593e-01, -9.046440906e-01,
-  -9.039892931e-01, -9.033323685e-01, -9.026733182e-01, -9.020121439e-01,
-  -9.013488470e-01, -9.006834292e-01, -9.000158920e-01, -8.993462370e-01,
-  -8.986744657e-01, -8.980005797e-01, -8.973245807e-01, -8.966464702e-01,
-  -8.959662498e-01, -8.952839210e-01, -8.945994856e-01, -8.939129451e-01,
-  -8.932243012e-01, -8.925335554e-01, -8.918407094e-01, -8.911457648e-01,
-  -8.904487232e-01, -8.897495864e-01, -8.890483559e-01, -8.883450333e-01,
-  -8.876396204e-01, -8.869321188e-01, -8.862225301e-01, -8.855108561e-01,
-  -8.847970984e-01, -8.840812587e-01, -8.833633387e-01, -8.826433400e-01,
-  -8.819212643e-01, -8.811971135e-01, -8.804708891e-01, -8.797425928e-01,
-  -8.790122264e-01, -8.782797917e-01, -8.775452902e-01, -8.768087238e-01,
-  -8.760700942e-01, -8.753294031e-01, -8.745866523e-01, -8.738418435e-01,
-  -8.730949784e-01, -8.723460589e-01, -8.715950867e-01, -8.708420635e-01,
-  -8.700869911e-01, -8.693298713e-01, -8.685707060e-01, -8.678094968e-01,
-  -8.670462455e-01, -8.662809540e-01, -8.655136241e-01, -8.647442575e-01,
-  -8.639728561e-01, -8.631994217e-01, -8.624239561e-01, -8.616464611e-01,
-  -8.608669386e-01, -8.600853904e-01, -8.593018184e-01, -8.585162243e-01,
-  -8.577286100e-01, -8.569389774e-01, -8.561473284e-01, -8.553536647e-01,
-  -8.545579884e-01, -8.537603011e-01, -8.529606049e-01, -8.521589016e-01,
-  -8.513551931e-01, -8.505494813e-01, -8.497417680e-01, -8.489320552e-01,
-  -8.481203448e-01, -8.473066387e-01, -8.464909388e-01, -8.456732470e-01,
-  -8.448535652e-01, -8.440318955e-01, -8.432082396e-01, -8.423825996e-01,
-  -8.415549774e-01, -8.407253750e-01, -8.398937942e-01, -8.390602371e-01,
-  -8.382247056e-01, -8.373872016e-01, -8.365477272e-01, -8.357062844e-01,
-  -8.348628750e-01, -8.340175011e-01, -8.331701647e-01, -8.323208678e-01,
-  -8.314696123e-01, -8.306164003e-01, -8.297612338e-01, -8.289041148e-01,
-  -8.280450453e-01, -8.271840273e-01, -8.263210628e-01, -8.254561540e-01,
-  -8.245893028e-01, -8.237205112e-01, -8.228497814e-01, -8.219771153e-01,
-  -8.211025150e-01, -8.202259826e-01, -8.193475201e-01, -8.184671296e-01,
-  -8.175848132e-01, -8.167005729e-01, -8.158144108e-01, -8.149263291e-01,
-  -8.140363297e-01, -8.131444148e-01, -8.122505866e-01, -8.113548470e-01,
-  -8.104571983e-01, -8.095576424e-01, -8.086561816e-01, -8.077528179e-01,
-  -8.068475535e-01, -8.059403906e-01, -8.050313311e-01, -8.041203774e-01,
-  -8.032075315e-01, -8.022927955e-01, -8.013761717e-01, -8.004576622e-01,
-  -7.995372691e-01, -7.986149946e-01, -7.976908409e-01, -7.967648102e-01,
-  -7.958369046e-01, -7.949071263e-01, -7.939754776e-01, -7.930419605e-01,
-  -7.921065773e-01, -7.911693302e-01, -7.902302214e-01, -7.892892532e-01,
-  -7.883464276e-01, -7.874017470e-01, -7.864552136e-01, -7.855068296e-01,
-  -7.845565972e-01, -7.836045186e-01, -7.826505962e-01, -7.816948321e-01,
-  -7.807372286e-01, -7.797777879e-01, -7.788165124e-01, -7.778534042e-01,
-  -7.768884657e-01, -7.759216990e-01, -7.749531066e-01, -7.739826906e-01,
-  -7.730104534e-01, -7.720363972e-01, -7.710605243e-01, -7.700828370e-01,
-  -7.691033376e-01, -7.681220285e-01, -7.671389119e-01, -7.661539902e-01,
-  -7.651672656e-01, -7.641787405e-01, -7.631884173e-01, -7.621962981e-01,
-  -7.612023855e-01, -7.602066817e-01, -7.592091890e-01, -7.582099098e-01,
-  -7.572088465e-01, -7.562060014e-01, -7.552013769e-01, -7.541949753e-01,
-  -7.531867990e-01, -7.521768504e-01, -7.511651319e-01, -7.501516458e-01,
-  -7.491363945e-01, -7.481193805e-01, -7.471006060e-01, -7.460800735e-01,
-  -7.450577854e-01, -7.440337442e-01, -7.430079521e-01, -7.419804117e-01,
-  -7.409511254e-01, -7.399200955e-01, -7.388873245e-01, -7.378528148e-01,
-  -7.368165689e-01, -7.357785892e-01, -7.347388781e-01, -7.336974381e-01,
-  -7.326542717e-01, -7.316093812e-01, -7.305627692e-01, -7.295144381e-01,
-  -7.284643904e-01, -7.274126286e-01, -7.263591551e-01, -7.253039724e-01,
-  -7.242470830e-01, -7.231884893e-01, -7.221281939e-01, -7.210661993e-01,
-  -7.200025080e-01, -7.189371224e-01, -7.178700451e-01, -7.168012785e-01,
-  -7.157308253e-01, -7.146586879e-01, -7.135848688e-01, -7.125093706e-01,
-  -7.114321957e-01, -7.103533469e-01, -7.092728264e-01, -7.081906370e-01,
-  -7.071067812e-01, -7.060212614e-01, -7.049340804e-01, -7.038452405e-01,
-  -7.027547445e-01, -7.016625947e-01, -7.005687939e-01, -6.994733446e-01,
-  -6.983762494e-01, -6.972775108e-01, -6.961771315e-01, -6.950751140e-01,
-  -6.939714609e-01, -6.928661748e-01, -6.917592584e-01, -6.906507141e-01,
-  -6.895405447e-01, -6.884287528e-01, -6.873153409e-01, -6.862003117e-01,
-  -6.850836678e-01, -6.839654118e-01, -6.828455464e-01, -6.817240742e-01,
-  -6.806009978e-01, -6.794763199e-01, -6.783500431e-01, -6.772221701e-01,
-  -6.760927036e-01, -6.749616461e-01, -6.738290004e-01, -6.726947691e-01,
-  -6.715589548e-01, -6.704215604e-01, -6.692825883e-01, -6.681420414e-01,
-  -6.669999223e-01, -6.658562337e-01, -6.647109782e-01, -6.635641586e-01,
-  -6.624157776e-01, -6.612658378e-01, -6.601143421e-01, -6.589612930e-01,
-  -6.578066933e-01, -6.566505457e-01, -6.554928530e-01, -6.543336178e-01,
-  -6.531728430e-01, -6.520105311e-01, -6.508466850e-01, -6.496813074e-01,
-  -6.485144010e-01, -6.473459686e-01, -6.461760130e-01, -6.450045368e-01,
-  -6.438315429e-01, -6.426570340e-01, -6.414810128e-01, -6.403034822e-01,
-  -6.391244449e-01, -6.379439036e-01, -6.367618612e-01, -6.355783205e-01,
-  -6.343932842e-01, -6.332067551e-01, -6.320187359e-01, -6.308292296e-01,
-  -6.296382389e-01, -6.284457666e-01, -6.272518155e-01, -6.260563884e-01,
-  -6.248594881e-01, -6.236611175e-01, -6.224612794e-01, -6.212599765e-01,
-  -6.200572118e-01, -6.188529880e-01, -6.176473079e-01, -6.164401745e-01,
-  -6.152315906e-01, -6.140215589e-01, -6.128100824e-01, -6.115971639e-01,
-  -6.103828063e-01, -6.091670123e-01, -6.079497850e-01, -6.067311270e-01,
-  -6.055110414e-01, -6.042895309e-01, -6.030665985e-01, -6.018422471e-01,
-  -6.006164794e-01, -5.993892984e-01, -5.981607070e-01, -5.969307081e-01,
-  -5.956993045e-01, -5.944664992e-01, -5.932322950e-01, -5.919966950e-01,
-  -5.907597019e-01, -5.895213186e-01, -5.882815482e-01, -5.870403935e-01,
-  -5.857978575e-01, -5.845539430e-01, -5.833086529e-01, -5.820619903e-01,
-  -5.808139581e-01, -5.795645591e-01, -5.783137964e-01, -5.770616729e-01,
-  -5.758081914e-01, -5.745533550e-01, -5.732971667e-01, -5.720396293e-01,
-  -5.707807459e-01, -5.695205193e-01, -5.682589527e-01, -5.669960488e-01,
-  -5.657318108e-01, -5.644662415e-01, -5.631993440e-01, -5.619311212e-01,
-  -5.606615762e-01, -5.593907119e-01, -5.581185312e-01, -5.568450373e-01,
-  -5.555702330e-01, -5.542941215e-01, -5.530167056e-01, -5.517379884e-01,
-  -5.504579729e-01, -5.491766622e-01, -5.478940592e-01, -5.466101669e-01,
-  -5.453249884e-01, -5.440385267e-01, -5.427507849e-01, -5.414617659e-01,
-  -5.401714727e-01, -5.388799085e-01, -5.375870763e-01, -5.362929791e-01,
-  -5.349976199e-01, -5.337010018e-01, -5.324031279e-01, -5.311040012e-01,
-  -5.298036247e-01, -5.285020015e-01, -5.271991348e-01, -5.258950275e-01,
-  -5.245896827e-01, -5.232831035e-01, -5.219752929e-01, -5.206662541e-01,
-  -5.193559902e-01, -5.180445041e-01, -5.167317990e-01, -5.154178780e-01,
-  -5.141027442e-01, -5.127864006e-01, -5.114688504e-01, -5.101500967e-01,
-  -5.088301425e-01, -5.075089911e-01, -5.061866453e-01, -5.048631085e-01,
-  -5.035383837e-01, -5.022124740e-01, -5.008853826e-01, -4.995571125e-01,
-  -4.982276670e-01, -4.968970490e-01, -4.955652618e-01, -4.942323085e-01,
-  -4.928981922e-01, -4.915629161e-01, -4.902264833e-01, -4.888888969e-01,
-  -4.875501601e-01, -4.862102761e-01, -4.848692480e-01, -4.835270789e-01,
-  -4.821837721e-01, -4.808393306e-01, -4.794937577e-01, -4.781470564e-01,
-  -4.767992301e-01, -4.754502817e-01, -4.741002147e-01, -4.727490320e-01,
-  -4.713967368e-01, -4.700433325e-01, -4.686888220e-01, -4.673332087e-01,
-  -4.659764958e-01, -4.646186863e-01, -4.632597836e-01, -4.618997907e-01,
-  -4.605387110e-01, -4.591765475e-01, -4.578133036e-01, -4.564489824e-01,
-  -4.550835871e-01, -4.537171210e-01, -4.523495872e-01, -4.509809890e-01,
-  -4.496113297e-01, -4.482406123e-01, -4.468688402e-01, -4.454960165e-01,
-  -4.441221446e-01, -4.427472276e-01, -4.413712687e-01, -4.399942713e-01,
-  -4.386162385e-01, -4.372371737e-01, -4.358570799e-01, -4.344759606e-01,
-  -4.330938189e-01, -4.317106580e-01, -4.303264813e-01, -4.289412921e-01,
-  -4.275550934e-01, -4.261678887e-01, -4.247796812e-01, -4.233904741e-01,
-  -4.220002708e-01, -4.206090744e-01, -4.192168884e-01, -4.178237158e-01,
-  -4.164295601e-01, -4.150344245e-01, -4.136383122e-01, -4.122412267e-01,
-  -4.108431711e-01, -4.094441487e-01, -4.080441629e-01, -4.066432169e-01,
-  -4.052413140e-01, -4.038384576e-01, -4.024346509e-01, -4.010298972e-01,
-  -3.996241998e-01, -3.982175622e-01, -3.968099874e-01, -3.954014789e-01,
-  -3.939920401e-01, -3.925816741e-01, -3.911703843e-01, -3.897581741e-01,
-  -3.883450467e-01, -3.869310055e-01, -3.855160538e-01, -3.841001950e-01,
-  -3.826834324e-01, -3.812657692e-01, -3.798472089e-01, -3.784277548e-01,
-  -3.770074102e-01, -3.755861785e-01, -3.741640630e-01, -3.727410670e-01,
-  -3.713171940e-01, -3.698924471e-01, -3.684668300e-01, -3.670403457e-01,
-  -3.656129978e-01, -3.641847896e-01, -3.627557244e-01, -3.613258056e-01,
-  -3.598950365e-01, -3.584634206e-01, -3.570309612e-01, -3.555976617e-01,
-  -3.541635254e-01, -3.527285558e-01, -3.512927561e-01, -3.498561298e-01,
-  -3.484186802e-01, -3.469804108e-01, -3.455413250e-01, -3.441014260e-01,
-  -3.426607173e-01, -3.412192023e-01, -3.397768844e-01, -3.383337670e-01,
-  -3.368898534e-01, -3.354451471e-01, -3.339996514e-01, -3.325533699e-01,
-  -3.311063058e-01, -3.296584625e-01, -3.282098436e-01, -3.267604523e-01,
-  -3.253102922e-01, -3.238593665e-01, -3.224076788e-01, -3.209552324e-01,
-  -3.195020308e-01, -3.180480774e-01, -3.165933756e-01, -3.151379288e-01,
-  -3.136817404e-01, -3.122248139e-01, -3.107671527e-01, -3.093087603e-01,
-  -3.078496400e-01, -3.063897954e-01, -3.049292297e-01, -3.034679466e-01,
-  -3.020059493e-01, -3.005432414e-01, -2.990798263e-01, -2.976157074e-01,
-  -2.961508882e-01, -2.946853722e-01, -2.932191627e-01, -2.917522632e-01,
-  -2.902846773e-01, -2.888164082e-01, -2.873474595e-01, -2.858778347e-01,
-  -2.844075372e-01, -2.829365705e-01, -2.814649379e-01, -2.799926431e-01,
-  -2.785196894e-01, -2.770460803e-01, -2.755718193e-01, -2.740969099e-01,
-  -2.726213554e-01, -2.711451595e-01, -2.696683256e-01, -2.681908571e-01,
-  -2.667127575e-01, -2.652340303e-01, -2.637546790e-01, -2.622747070e-01,
-  -2.607941179e-01, -2.593129151e-01, -2.578311022e-01, -2.563486825e-01,
-  -2.548656596e-01, -2.533820370e-01, -2.518978182e-01, -2.504130066e-01,
-  -2.489276057e-01, -2.474416192e-01, -2.459550503e-01, -2.444679027e-01,
-  -2.429801799e-01, -2.414918853e-01, -2.400030224e-01, -2.385135948e-01,
-  -2.370236060e-01, -2.355330594e-01, -2.340419586e-01, -2.325503070e-01,
-  -2.310581083e-01, -2.295653658e-01, -2.280720832e-01, -2.265782638e-01,
-  -2.250839114e-01, -2.235890292e-01, -2.220936210e-01, -2.205976901e-01,
-  -2.191012402e-01, -2.176042746e-01, -2.161067971e-01, -2.146088110e-01,
-  -2.131103199e-01, -2.116113274e-01, -2.101118369e-01, -2.086118520e-01,
-  -2.071113762e-01, -2.056104131e-01, -2.041089661e-01, -2.026070388e-01,
-  -2.011046348e-01, -1.996017576e-01, -1.980984107e-01, -1.965945977e-01,
-  -1.950903220e-01, -1.935855873e-01, -1.920803970e-01, -1.905747548e-01,
-  -1.890686641e-01, -1.875621286e-01, -1.860551517e-01, -1.845477369e-01,
-  -1.830398880e-01, -1.815316083e-01, -1.800229014e-01, -1.785137709e-01,
-  -1.770042204e-01, -1.754942534e-01, -1.739838734e-01, -1.724730840e-01,
-  -1.709618888e-01, -1.694502912e-01, -1.679382950e-01, -1.664259035e-01,
-  -1.649131205e-01, -1.633999494e-01, -1.618863938e-01, -1.603724572e-01,
-  -1.588581433e-01, -1.573434556e-01, -1.558283977e-01, -1.543129730e-01,
-  -1.527971853e-01, -1.512810380e-01, -1.497645347e-01, -1.482476790e-01,
-  -1.467304745e-01, -1.452129247e-01, -1.436950332e-01, -1.421768035e-01,
-  -1.406582393e-01, -1.391393442e-01, -1.376201216e-01, -1.361005752e-01,
-  -1.345807085e-01, -1.330605252e-01, -1.315400287e-01, -1.300192227e-01,
-  -1.284981108e-01, -1.269766965e-01, -1.254549834e-01, -1.239329751e-01,
-  -1.224106752e-01, -1.208880872e-01, -1.193652148e-01, -1.178420615e-01,
-  -1.163186309e-01, -1.147949266e-01, -1.132709522e-01, -1.117467112e-01,
-  -1.102222073e-01, -1.086974440e-01, -1.071724250e-01, -1.056471537e-01,
-  -1.041216339e-01, -1.025958690e-01, -1.010698628e-01, -9.954361866e-02,
-  -9.801714033e-02, -9.649043136e-02, -9.496349533e-02, -9.343633585e-02,
-  -9.190895650e-02, -9.038136088e-02, -8.885355258e-02, -8.732553521e-02,
-  -8.579731234e-02, -8.426888759e-02, -8.274026455e-02, -8.121144681e-02,
-  -7.968243797e-02, -7.815324163e-02, -7.662386139e-02, -7.509430085e-02,
-  -7.356456360e-02, -7.203465325e-02, -7.050457339e-02, -6.897432763e-02,
-  -6.744391956e-02, -6.591335280e-02, -6.438263093e-02, -6.285175756e-02,
-  -6.132073630e-02, -5.978957075e-02, -5.825826450e-02, -5.672682117e-02,
-  -5.519524435e-02, -5.366353765e-02, -5.213170468e-02, -5.059974904e-02,
-  -4.906767433e-02, -4.753548416e-02, -4.600318213e-02, -4.447077185e-02,
-  -4.293825693e-02, -4.140564098e-02, -3.987292759e-02, -3.834012037e-02,
-  -3.680722294e-02, -3.527423890e-02, -3.374117185e-02, -3.220802541e-02,
-  -3.067480318e-02, -2.914150876e-02, -2.760814578e-02, -2.607471783e-02,
-  -2.454122852e-02, -2.300768147e-02, -2.147408028e-02, -1.994042855e-02,
-  -1.840672991e-02, -1.687298795e-02, -1.533920628e-02, -1.380538853e-02,
-  -1.227153829e-02, -1.073765917e-02, -9.203754782e-03, -7.669828740e-03,
-  -6.135884649e-03, -4.601926120e-03, -3.067956763e-03, -1.533980186e-03,
-  -2.449293598e-16,  1.533980186e-03,  3.067956763e-03,  4.601926120e-03,
-   6.135884649e-03,  7.669828740e-03,  9.203754782e-03,  1.073765917e-02,
-   1.227153829e-02,  1.380538853e-02,  1.533920628e-02,  1.687298795e-02,
-   1.840672991e-02,  1.994042855e-02,  2.147408028e-02,  2.300768147e-02,
-   2.454122852e-02,  2.607471783e-02,  2.760814578e-02,  2.914150876e-02,
-   3.067480318e-02,  3.220802541e-02,  3.374117185e-02,  3.527423890e-02,
-   3.680722294e-02,  3.834012037e-02,  3.987292759e-02,  4.140564098e-02,
-   4.293825693e-02,  4.447077185e-02,  4.600318213e-02,  4.753548416e-02,
-   4.906767433e-02,  5.059974904e-02,  5.213170468e-02,  5.366353765e-02,
-   5.519524435e-02,  5.672682117e-02,  5.825826450e-02,  5.978957075e-02,
-   6.132073630e-02,  6.285175756e-02,  6.438263093e-02,  6.591335280e-02,
-   6.744391956e-02,  6.897432763e-02,  7.050457339e-02,  7.203465325e-02,
-   7.356456360e-02,  7.509430085e-02,  7.662386139e-02,  7.815324163e-02,
-   7.968243797e-02,  8.121144681e-02,  8.274026455e-02,  8.426888759e-02,
-   8.579731234e-02,  8.732553521e-02,  8.885355258e-02,  9.038136088e-02,
-   9.190895650e-02,  9.343633585e-02,  9.496349533e-02,  9.649043136e-02,
-   9.801714033e-02,  9.954361866e-02,  1.010698628e-01,  1.025958690e-01,
-   1.041216339e-01,  1.056471537e-01,  1.071724250e-01,  1.086974440e-01,
-   1.102222073e-01,  1.117467112e-01,  1.132709522e-01,  1.147949266e-01,
-   1.163186309e-01,  1.178420615e-01,  1.193652148e-01,  1.208880872e-01,
-   1.224106752e-01,  1.239329751e-01,  1.254549834e-01,  1.269766965e-01,
-   1.284981108e-01,  1.300192227e-01,  1.315400287e-01,  1.330605252e-01,
-   1.345807085e-01,  1.361005752e-01,  1.376201216e-01,  1.391393442e-01,
-   1.406582393e-01,  1.421768035e-01,  1.436950332e-01,  1.452129247e-01,
-   1.467304745e-01,  1.482476790e-01,  1.497645347e-01,  1.512810380e-01,
-   1.527971853e-01,  1.543129730e-01,  1.558283977e-01,  1.573434556e-01,
-   1.588581433e-01,  1.603724572e-01,  1.618863938e-01,  1.633999494e-01,
-   1.649131205e-01,  1.664259035e-01,  1.679382950e-01,  1.694502912e-01,
-   1.709618888e-01,  1.724730840e-01,  1.739838734e-01,  1.754942534e-01,
-   1.770042204e-01,  1.785137709e-01,  1.800229014e-01,  1.815316083e-01,
-   1.830398880e-01,  1.845477369e-01,  1.860551517e-01,  1.875621286e-01,
-   1.890686641e-01,  1.905747548e-01,  1.920803970e-01,  1.935855873e-01,
-   1.950903220e-01,  1.965945977e-01,  1.980984107e-01,  1.996017576e-01,
-   2.011046348e-01,  2.026070388e-01,  2.041089661e-01,  2.056104131e-01,
-   2.071113762e-01,  2.086118520e-01,  2.101118369e-01,  2.116113274e-01,
-   2.131103199e-01,  2.146088110e-01,  2.161067971e-01,  2.176042746e-01,
-   2.191012402e-01,  2.205976901e-01,  2.220936210e-01,  2.235890292e-01,
-   2.250839114e-01,  2.265782638e-01,  2.280720832e-01,  2.295653658e-01,
-   2.310581083e-01,  2.325503070e-01,  2.340419586e-01,  2.355330594e-01,
-   2.370236060e-01,  2.385135948e-01,  2.400030224e-01,  2.414918853e-01,
-   2.429801799e-01,  2.444679027e-01,  2.459550503e-01,  2.474416192e-01,
-   2.489276057e-01,  2.504130066e-01,  2.518978182e-01,  2.533820370e-01,
-   2.548656596e-01,  2.563486825e-01,  2.578311022e-01,  2.593129151e-01,
-   2.607941179e-01,  2.622747070e-01,  2.637546790e-01,  2.652340303e-01,
-   2.667127575e-01,  2.681908571e-01,  2.696683256e-01,  2.711451595e-01,
-   2.726213554e-01,  2.740969099e-01,  2.755718193e-01,  2.770460803e-01,
-   2.785196894e-01,  2.799926431e-01,  2.814649379e-01,  2.829365705e-01,
-   2.844075372e-01,  2.858778347e-01,  2.873474595e-01,  2.888164082e-01,
-   2.902846773e-01,  2.917522632e-01,  2.932191627e-01,  2.946853722e-01,
-   2.961508882e-01,  2.976157074e-01,  2.990798263e-01,  3.005432414e-01,
-   3.020059493e-01,  3.034679466e-01,  3.049292297e-01,  3.063897954e-01,
-   3.078496400e-01,  3.093087603e-01,  3.107671527e-01,  3.122248139e-01,
-   3.136817404e-01,  3.151379288e-01,  3.165933756e-01,  3.180480774e-01,
-   3.195020308e-01,  3.209552324e-01,  3.224076788e-01,  3.238593665e-01,
-   3.253102922e-01,  3.267604523e-01,  3.282098436e-01,  3.296584625e-01,
-   3.311063058e-01,  3.325533699e-01,  3.339996514e-01,  3.354451471e-01,
-   3.368898534e-01,  3.383337670e-01,  3.397768844e-01,  3.412192023e-01,
-   3.426607173e-01,  3.441014260e-01,  3.455413250e-01,  3.469804108e-01,
-   3.484186802e-01,  3.498561298e-01,  3.512927561e-01,  3.527285558e-01,
-   3.541635254e-01,  3.555976617e-01,  3.570309612e-01,  3.584634206e-01,
-   3.598950365e-01,  3.613258056e-01,  3.627557244e-01,  3.641847896e-01,
-   3.656129978e-01,  3.670403457e-01,  3.684668300e-01,  3.698924471e-01,
-   3.713171940e-01,  3.727410670e-01,  3.741640630e-01,  3.755861785e-01,
-   3.770074102e-01,  3.784277548e-01,  3.798472089e-01,  3.812657692e-01,
-   3.826834324e-01,  3.841001950e-01,  3.855160538e-01,  3.869310055e-01,
-   3.883450467e-01,  3.897581741e-01,  3.911703843e-01,  3.925816741e-01,
-   3.939920401e-01,  3.954014789e-01,  3.968099874e-01,  3.982175622e-01,
-   3.996241998e-01,  4.010298972e-01,  4.024346509e-01,  4.038384576e-01,
-   4.052413140e-01,  4.066432169e-01,  4.080441629e-01,  4.094441487e-01,
-   4.108431711e-01,  4.122412267e-01,  4.136383122e-01,  4.150344245e-01,
-   4.164295601e-01,  4.178237158e-01,  4.192168884e-01,  4.206090744e-01,
-   4.220002708e-01,  4.233904741e-01,  4.247796812e-01,  4.261678887e-01,
-   4.275550934e-01,  4.289412921e-01,  4.303264813e-01,  4.317106580e-01,
-   4.330938189e-01,  4.344759606e-01,  4.358570799e-01,  4.372371737e-01,
-   4.386162385e-01,  4.399942713e-01,  4.413712687e-01,  4.427472276e-01,
-   4.441221446e-01,  4.454960165e-01,  4.468688402e-01,  4.482406123e-01,
-   4.496113297e-01,  4.509809890e-01,  4.523495872e-01,  4.537171210e-01,
-   4.550835871e-01,  4.564489824e-01,  4.578133036e-01,  4.591765475e-01,
-   4.605387110e-01,  4.618997907e-01,  4.632597836e-01,  4.646186863e-01,
-   4.659764958e-01,  4.673332087e-01,  4.686888220e-01,  4.700433325e-01,
-   4.713967368e-01,  4.727490320e-01,  4.741002147e-01,  4.754502817e-01,
-   4.767992301e-01,  4.781470564e-01,  4.794937577e-01,  4.808393306e-01,
-   4.821837721e-01,  4.835270789e-01,  4.848692480e-01,  4.862102761e-01,
-   4.875501601e-01,  4.888888969e-01,  4.902264833e-01,  4.915629161e-01,
-   4.928981922e-01,  4.942323085e-01,  4.955652618e-01,  4.968970490e-01,
-   4.982276670e-01,  4.995571125e-01,  5.008853826e-01,  5.022124740e-01,
-   5.035383837e-01,  5.048631085e-01,  5.061866453e-01,  5.075089911e-01,
-   5.088301425e-01,  5.101500967e-01,  5.114688504e-01,  5.127864006e-01,
-   5.141027442e-01,  5.154178780e-01,  5.167317990e-01,  5.180445041e-01,
-   5.193559902e-01,  5.206662541e-01,  5.219752929e-01,  5.232831035e-01,
-   5.245896827e-01,  5.258950275e-01,  5.271991348e-01,  5.285020015e-01,
-   5.298036247e-01,  5.311040012e-01,  5.324031279e-01,  5.337010018e-01,
-   5.349976199e-01,  5.362929791e-01,  5.375870763e-01,  5.388799085e-01,
-   5.401714727e-01,  5.414617659e-01,  5.427507849e-01,  5.440385267e-01,
-   5.453249884e-01,  5.466101669e-01,  5.478940592e-01,  5.491766622e-01,
-   5.504579729e-01,  5.517379884e-01,  5.530167056e-01,  5.542941215e-01,
-   5.555702330e-01,  5.568450373e-01,  5.581185312e-01,  5.593907119e-01,
-   5.606615762e-01,  5.619311212e-01,  5.631993440e-01,  5.644662415e-01,
-   5.657318108e-01,  5.669960488e-01,  5.682589527e-01,  5.695205193e-01,
-   5.707807459e-01,  5.720396293e-01,  5.732971667e-01,  5.745533550e-01,
-   5.758081914e-01,  5.770616729e-01,  5.783137964e-01,  5.795645591e-01,
-   5.808139581e-01,  5.820619903e-01,  5.833086529e-01,  5.845539430e-01,
-   5.857978575e-01,  5.870403935e-01,  5.882815482e-01,  5.895213186e-01,
-   5.907597019e-01,  5.919966950e-01,  5.932322950e-01,  5.944664992e-01,
-   5.956993045e-01,  5.969307081e-01,  5.981607070e-01,  5.993892984e-01,
-   6.006164794e-01,  6.018422471e-01,  6.030665985e-01,  6.042895309e-01,
-   6.055110414e-01,  6.067311270e-01,  6.079497850e-01,  6.091670123e-01,
-   6.103828063e-01,  6.115971639e-01,  6.128100824e-01,  6.140215589e-01,
-   6.152315906e-01,  6.164401745e-01,  6.176473079e-01,  6.188529880e-01,
-   6.200572118e-01,  6.212599765e-01,  6.224612794e-01,  6.236611175e-01,
-   6.248594881e-01,  6.260563884e-01,  6.272518155e-01,  6.284457666e-01,
-   6.296382389e-01,  6.308292296e-01,  6.320187359e-01,  6.332067551e-01,
-   6.343932842e-01,  6.355783205e-01,  6.367618612e-01,  6.379439036e-01,
-   6.391244449e-01,  6.403034822e-01,  6.414810128e-01,  6.426570340e-01,
-   6.438315429e-01,  6.450045368e-01,  6.461760130e-01,  6.473459686e-01,
-   6.485144010e-01,  6.496813074e-01,  6.508466850e-01,  6.520105311e-01,
-   6.531728430e-01,  6.543336178e-01,  6.554928530e-01,  6.566505457e-01,
-   6.578066933e-01,  6.589612930e-01,  6.601143421e-01,  6.612658378e-01,
-   6.624157776e-01,  6.635641586e-01,  6.647109782e-01,  6.658562337e-01,
-   6.669999223e-01,  6.681420414e-01,  6.692825883e-01,  6.704215604e-01,
-   6.715589548e-01,  6.726947691e-01,  6.738290004e-01,  6.749616461e-01,
-   6.760927036e-01,  6.772221701e-01,  6.783500431e-01,  6.794763199e-01,
-   6.806009978e-01,  6.817240742e-01,  6.828455464e-01,  6.839654118e-01,
-   6.850836678e-01,  6.862003117e-01,  6.873153409e-01,  6.884287528e-01,
-   6.895405447e-01,  6.906507141e-01,  6.917592584e-01,  6.928661748e-01,
-   6.939714609e-01,  6.950751140e-01,  6.961771315e-01,  6.972775108e-01,
-   6.983762494e-01,  6.994733446e-01,  7.005687939e-01,  7.016625947e-01,
-   7.027547445e-01,  7.038452405e-01,  7.049340804e-01,  7.060212614e-01,
-   7.071067812e-01,  7.081906370e-01,  7.092728264e-01,  7.103533469e-01,
-   7.114321957e-01,  7.125093706e-01,  7.135848688e-01,  7.146586879e-01,
-   7.157308253e-01,  7.168012785e-01,  7.178700451e-01,  7.189371224e-01,
-   7.200025080e-01,  7.210661993e-01,  7.221281939e-01,  7.231884893e-01,
-   7.242470830e-01,  7.253039724e-01,  7.263591551e-01,  7.274126286e-01,
-   7.284643904e-01,  7.295144381e-01,  7.305627692e-01,  7.316093812e-01,
-   7.326542717e-01,  7.336974381e-01,  7.347388781e-01,  7.357785892e-01,
-   7.368165689e-01,  7.378528148e-01,  7.388873245e-01,  7.399200955e-01,
-   7.409511254e-01,  7.419804117e-01,  7.430079521e-01,  7.440337442e-01,
-   7.450577854e-01,  7.460800735e-01,  7.471006060e-01,  7.481193805e-01,
-   7.491363945e-01,  7.501516458e-01,  7.511651319e-01,  7.521768504e-01,
-   7.531867990e-01,  7.541949753e-01,  7.552013769e-01,  7.562060014e-01,
-   7.572088465e-01,  7.582099098e-01,  7.592091890e-01,  7.602066817e-01,
-   7.612023855e-01,  7.621962981e-01,  7.631884173e-01,  7.641787405e-01,
-   7.651672656e-01,  7.661539902e-01,  7.671389119e-01,  7.681220285e-01,
-   7.691033376e-01,  7.700828370e-01,  7.710605243e-01,  7.720363972e-01,
-   7.730104534e-01,  7.739826906e-01,  7.749531066e-01,  7.759216990e-01,
-   7.768884657e-01,  7.778534042e-01,  7.788165124e-01,  7.797777879e-01,
-   7.807372286e-01,  7.816948321e-01,  7.826505962e-01,  7.836045186e-01,
-   7.845565972e-01,  7.855068296e-01,  7.864552136e-01,  7.874017470e-01,
-   7.883464276e-01,  7.892892532e-01,  7.902302214e-01,  7.911693302e-01,
-   7.921065773e-01,  7.930419605e-01,  7.939754776e-01,  7.949071263e-01,
-   7.958369046e-01,  7.967648102e-01,  7.976908409e-01,  7.986149946e-01,
-   7.995372691e-01,  8.004576622e-01,  8.013761717e-01,  8.022927955e-01,
-   8.032075315e-01,  8.041203774e-01,  8.050313311e-01,  8.059403906e-01,
-   8.068475535e-01,  8.077528179e-01,  8.086561816e-01,  8.095576424e-01,
-   8.104571983e-01,  8.113548470e-01,  8.122505866e-01,  8.131444148e-01,
-   8.140363297e-01,  8.149263291e-01,  8.158144108e-01,  8.167005729e-01,
-   8.175848132e-01,  8.184671296e-01,  8.193475201e-01,  8.202259826e-01,
-   8.211025150e-01,  8.219771153e-01,  8.228497814e-01,  8.237205112e-01,
-   8.245893028e-01,  8.254561540e-01,  8.263210628e-01,  8.271840273e-01,
-   8.280450453e-01,  8.289041148e-01,  8.297612338e-01,  8.306164003e-01,
-   8.314696123e-01,  8.323208678e-01,  8.331701647e-01,  8.340175011e-01,
-   8.348628750e-01,  8.357062844e-01,  8.365477272e-01,  8.373872016e-01,
-   8.382247056e-01,  8.390602371e-01,  8.398937942e-01,  8.407253750e-01,
-   8.415549774e-01,  8.423825996e-01,  8.432082396e-01,  8.440318955e-01,
-   8.448535652e-01,  8.456732470e-01,  8.464909388e-01,  8.473066387e-01,
-   8.481203448e-01,  8.489320552e-01,  8.497417680e-01,  8.505494813e-01,
-   8.513551931e-01,  8.521589016e-01,  8.529606049e-01,  8.537603011e-01,
-   8.545579884e-01,  8.553536647e-01,  8.561473284e-01,  8.569389774e-01,
-   8.577286100e-01,  8.585162243e-01,  8.593018184e-01,  8.600853904e-01,
-   8.608669386e-01,  8.616464611e-01,  8.624239561e-01,  8.631994217e-01,
-   8.639728561e-01,  8.647442575e-01,  8.655136241e-01,  8.662809540e-01,
-   8.670462455e-01,  8.678094968e-01,  8.685707060e-01,  8.693298713e-01,
-   8.700869911e-01,  8.708420635e-01,  8.715950867e-01,  8.723460589e-01,
-   8.730949784e-01,  8.738418435e-01,  8.745866523e-01,  8.753294031e-01,
-   8.760700942e-01,  8.768087238e-01,  8.775452902e-01,  8.782797917e-01,
-   8.790122264e-01,  8.797425928e-01,  8.804708891e-01,  8.811971135e-01,
-   8.819212643e-01,  8.826433400e-01,  8.833633387e-01,  8.840812587e-01,
-   8.847970984e-01,  8.855108561e-01,  8.862225301e-01,  8.869321188e-01,
-   8.876396204e-01,  8.883450333e-01,  8.890483559e-01,  8.897495864e-01,
-   8.904487232e-01,  8.911457648e-01,  8.918407094e-01,  8.925335554e-01,
-   8.932243012e-01,  8.939129451e-01,  8.945994856e-01,  8.952839210e-01,
-   8.959662498e-01,  8.966464702e-01,  8.973245807e-01,  8.980005797e-01,
-   8.986744657e-01,  8.993462370e-01,  9.000158920e-01,  9.006834292e-01,
-   9.013488470e-01,  9.020121439e-01,  9.026733182e-01,  9.033323685e-01,
-   9.039892931e-01,  9.046440906e-01,  9.052967593e-01,  9.059472978e-01,
-   9.065957045e-01,  9.072419779e-01,  9.078861165e-01,  9.085281187e-01,
-   9.091679831e-01,  9.098057081e-01,  9.104412923e-01,  9.110747341e-01,
-   9.117060320e-01,  9.123351846e-01,  9.129621904e-01,  9.135870479e-01,
-   9.142097557e-01,  9.148303122e-01,  9.154487161e-01,  9.160649658e-01,
-   9.166790599e-01,  9.172909970e-01,  9.179007756e-01,  9.185083943e-01,
-   9.191138517e-01,  9.197171463e-01,  9.203182767e-01,  9.209172415e-01,
-   9.215140393e-01,  9.221086687e-01,  9.227011283e-01,  9.232914167e-01,
-   9.238795325e-01,  9.244654743e-01,  9.250492408e-01,  9.256308305e-01,
-   9.262102421e-01,  9.267874743e-01,  9.273625257e-01,  9.279353948e-01,
-   9.285060805e-01,  9.290745813e-01,  9.296408958e-01,  9.302050229e-01,
-   9.307669611e-01,  9.313267091e-01,  9.318842656e-01,  9.324396293e-01,
-   9.329927988e-01,  9.335437730e-01,  9.340925504e-01,  9.346391298e-01,
-   9.351835099e-01,  9.357256895e-01,  9.362656672e-01,  9.368034417e-01,
-   9.373390119e-01,  9.378723764e-01,  9.384035341e-01,  9.389324835e-01,
-   9.394592236e-01,  9.399837530e-01,  9.405060706e-01,  9.410261751e-01,
-   9.415440652e-01,  9.420597398e-01,  9.425731976e-01,  9.430844375e-01,
-   9.435934582e-01,  9.441002585e-01,  9.446048373e-01,  9.451071933e-01,
-   9.456073254e-01,  9.461052324e-01,  9.466009131e-01,  9.470943664e-01,
-   9.475855910e-01,  9.480745859e-01,  9.485613499e-01,  9.490458819e-01,
-   9.495281806e-01,  9.500082450e-01,  9.504860739e-01,  9.509616663e-01,
-   9.514350210e-01,  9.519061368e-01,  9.523750127e-01,  9.528416476e-01,
-   9.533060404e-01,  9.537681899e-01,  9.542280951e-01,  9.546857549e-01,
-   9.551411683e-01,  9.555943341e-01,  9.560452513e-01,  9.564939189e-01,
-   9.569403357e-01,  9.573845008e-01,  9.578264130e-01,  9.582660714e-01,
-   9.587034749e-01,  9.591386225e-01,  9.595715131e-01,  9.600021457e-01,
-   9.604305194e-01,  9.608566331e-01,  9.612804858e-01,  9.617020765e-01,
-   9.621214043e-01,  9.625384680e-01,  9.629532669e-01,  9.633657998e-01,
-   9.637760658e-01,  9.641840640e-01,  9.645897933e-01,  9.649932529e-01,
-   9.653944417e-01,  9.657933589e-01,  9.661900034e-01,  9.665843745e-01,
-   9.669764710e-01,  9.673662922e-01,  9.677538371e-01,  9.681391047e-01,
-   9.685220943e-01,  9.689028048e-01,  9.692812354e-01,  9.696573851e-01,
-   9.700312532e-01,  9.704028387e-01,  9.707721407e-01,  9.711391584e-01,
-   9.715038910e-01,  9.718663375e-01,  9.722264971e-01,  9.725843689e-01,
-   9.729399522e-01,  9.732932461e-01,  9.736442497e-01,  9.739929622e-01,
-   9.743393828e-01,  9.746835107e-01,  9.750253451e-01,  9.753648851e-01,
-   9.757021300e-01,  9.760370790e-01,  9.763697313e-01,  9.767000861e-01,
-   9.770281427e-01,  9.773539001e-01,  9.776773578e-01,  9.779985149e-01,
-   9.783173707e-01,  9.786339244e-01,  9.789481753e-01,  9.792601226e-01,
-   9.795697657e-01,  9.798771037e-01,  9.801821360e-01,  9.804848618e-01,
-   9.807852804e-01,  9.810833912e-01,  9.813791933e-01,  9.816726862e-01,
-   9.819638691e-01,  9.822527414e-01,  9.825393023e-01,  9.828235512e-01,
-   9.831054874e-01,  9.833851103e-01,  9.836624192e-01,  9.839374134e-01,
-   9.842100924e-01,  9.844804554e-01,  9.847485018e-01,  9.850142310e-01,
-   9.852776424e-01,  9.855387353e-01,  9.857975092e-01,  9.860539633e-01,
-   9.863080972e-01,  9.865599103e-01,  9.868094018e-01,  9.870565713e-01,
-   9.873014182e-01,  9.875439418e-01,  9.877841416e-01,  9.880220171e-01,
-   9.882575677e-01,  9.884907929e-01,  9.887216920e-01,  9.889502645e-01,
-   9.891765100e-01,  9.894004278e-01,  9.896220175e-01,  9.898412785e-01,
-   9.900582103e-01,  9.902728124e-01,  9.904850843e-01,  9.906950254e-01,
-   9.909026354e-01,  9.911079137e-01,  9.913108598e-01,  9.915114733e-01,
-   9.917097537e-01,  9.919057004e-01,  9.920993131e-01,  9.922905913e-01,
-   9.924795346e-01,  9.926661424e-01,  9.928504145e-01,  9.930323502e-01,
-   9.932119492e-01,  9.933892111e-01,  9.935641355e-01,  9.937367219e-01,
-   9.939069700e-01,  9.940748793e-01,  9.942404495e-01,  9.944036801e-01,
-   9.945645707e-01,  9.947231211e-01,  9.948793308e-01,  9.950331994e-01,
-   9.951847267e-01,  9.953339121e-01,  9.954807555e-01,  9.956252564e-01,
-   9.957674145e-01,  9.959072294e-01,  9.960447009e-01,  9.961798286e-01,
-   9.963126122e-01,  9.964430514e-01,  9.965711458e-01,  9.966968952e-01,
-   9.968202993e-01,  9.969413578e-01,  9.970600703e-01,  9.971764367e-01,
-   9.972904567e-01,  9.974021299e-01,  9.975114561e-01,  9.976184351e-01,
-   9.977230666e-01,  9.978253504e-01,  9.979252862e-01,  9.980228738e-01,
-   9.981181129e-01,  9.982110034e-01,  9.983015449e-01,  9.983897374e-01,
-   9.984755806e-01,  9.985590742e-01,  9.986402182e-01,  9.987190122e-01,
-   9.987954562e-01,  9.988695499e-01,  9.989412932e-01,  9.990106859e-01,
-   9.990777278e-01,  9.991424187e-01,  9.992047586e-01,  9.992647473e-01,
-   9.993223846e-01,  9.993776704e-01,  9.994306046e-01,  9.994811870e-01,
-   9.995294175e-01,  9.995752960e-01,  9.996188225e-01,  9.996599967e-01,
-   9.996988187e-01,  9.997352883e-01,  9.997694054e-01,  9.998011699e-01,
-   9.998305818e-01,  9.998576410e-01,  9.998823475e-01,  9.999047011e-01,
-   9.999247018e-01,  9.999423497e-01,  9.999576446e-01,  9.999705864e-01,
-   9.999811753e-01,  9.999894111e-01,  9.999952938e-01,  9.999988235e-01,
-   1.000000000e+00,
-};
-const float lut_4_decades[] = {
-   1.000000000e+00,  1.036632928e+00,  1.074607828e+00,  1.113973860e+00,
-   1.154781985e+00,  1.197085030e+00,  1.240937761e+00,  1.286396945e+00,
-   1.333521432e+00,  1.382372227e+00,  1.433012570e+00,  1.485508017e+00,
-   1.539926526e+00,  1.596338544e+00,  1.654817100e+00,  1.715437896e+00,
-   1.778279410e+00,  1.843422992e+00,  1.910952975e+00,  1.980956779e+00,
-   2.053525026e+00,  2.128751662e+00,  2.206734069e+00,  2.287573200e+00,
-   2.371373706e+00,  2.458244069e+00,  2.548296748e+00,  2.641648320e+00,
-   2.738419634e+00,  2.838735965e+00,  2.942727176e+00,  3.050527890e+00,
-   3.162277660e+00,  3.278121151e+00,  3.398208329e+00,  3.522694651e+00,
-   3.651741273e+00,  3.785515249e+00,  3.924189758e+00,  4.067944321e+00,
-   4.216965034e+00,  4.371444813e+00,  4.531583638e+00,  4.697588817e+00,
-   4.869675252e+00,  5.048065717e+00,  5.232991147e+00,  5.424690937e+00,
-   5.623413252e+00,  5.829415347e+00,  6.042963902e+00,  6.264335367e+00,
-   6.493816316e+00,  6.731703824e+00,  6.978305849e+00,  7.233941627e+00,
-   7.498942093e+00,  7.773650302e+00,  8.058421878e+00,  8.353625470e+00,
-   8.659643234e+00,  8.976871324e+00,  9.305720409e+00,  9.646616199e+00,
-   1.000000000e+01,  1.036632928e+01,  1.074607828e+01,  1.113973860e+01,
-   1.154781985e+01,  1.197085030e+01,  1.240937761e+01,  1.286396945e+01,
-   1.333521432e+01,  1.382372227e+01,  1.433012570e+01,  1.485508017e+01,
-   1.539926526e+01,  1.596338544e+01,  1.654817100e+01,  1.715437896e+01,
-   1.778279410e+01,  1.843422992e+01,  1.910952975e+01,  1.980956779e+01,
-   2.053525026e+01,  2.128751662e+01,  2.206734069e+01,  2.287573200e+01,
-   2.371373706e+01,  2.458244069e+01,  2.548296748e+01,  2.641648320e+01,
-   2.738419634e+01,  2.838735965e+01,  2.942727176e+01,  3.050527890e+01,
-   3.162277660e+01,  3.278121151e+01,  3.398208329e+01,  3.522694651e+01,
-   3.651741273e+01,  3.785515249e+01,  3.924189758e+01,  4.067944321e+01,
-   4.216965034e+01,  4.371444813e+01,  4.531583638e+01,  4.697588817e+01,
-   4.869675252e+01,  5.048065717e+01,  5.232991147e+01,  5.424690937e+01,
-   5.623413252e+01,  5.829415347e+01,  6.042963902e+01,  6.264335367e+01,
-   6.493816316e+01,  6.731703824e+01,  6.978305849e+01,  7.233941627e+01,
-   7.498942093e+01,  7.773650302e+01,  8.058421878e+01,  8.353625470e+01,
-   8.659643234e+01,  8.976871324e+01,  9.305720409e+01,  9.646616199e+01,
-   1.000000000e+02,  1.036632928e+02,  1.074607828e+02,  1.113973860e+02,
-   1.154781985e+02,  1.197085030e+02,  1.240937761e+02,  1.286396945e+02,
-   1.333521432e+02,  1.382372227e+02,  1.433012570e+02,  1.485508017e+02,
-   1.539926526e+02,  1.596338544e+02,  1.654817100e+02,  1.715437896e+02,
-   1.778279410e+02,  1.843422992e+02,  1.910952975e+02,  1.980956779e+02,
-   2.053525026e+02,  2.128751662e+02,  2.206734069e+02,  2.287573200e+02,
-   2.371373706e+02,  2.458244069e+02,  2.548296748e+02,  2.641648320e+02,
-   2.738419634e+02,  2.838735965e+02,  2.942727176e+02,  3.050527890e+02,
-   3.162277660e+02,  3.278121151e+02,  3.398208329e+02,  3.522694651e+02,
-   3.651741273e+02,  3.785515249e+02,  3.924189758e+02,  4.067944321e+02,
-   4.216965034e+02,  4.371444813e+02,  4.531583638e+02,  4.697588817e+02,
-   4.869675252e+02,  5.048065717e+02,  5.232991147e+02,  5.424690937e+02,
-   5.623413252e+02,  5.829415347e+02,  6.042963902e+02,  6.264335367e+02,
-   6.493816316e+02,  6.731703824e+02,  6.978305849e+02,  7.233941627e+02,
-   7.498942093e+02,  7.773650302e+02,  8.058421878e+02,  8.353625470e+02,
-   8.659643234e+02,  8.976871324e+02,  9.305720409e+02,  9.646616199e+02,
-   1.000000000e+03,  1.036632928e+03,  1.074607828e+03,  1.113973860e+03,
-   1.154781985e+03,  1.197085030e+03,  1.240937761e+03,  1.286396945e+03,
-   1.333521432e+03,  1.382372227e+03,  1.433012570e+03,  1.485508017e+03,
-   1.539926526e+03,  1.596338544e+03,  1.654817100e+03,  1.715437896e+03,
-   1.778279410e+03,  1.843422992e+03,  1.910952975e+03,  1.980956779e+03,
-   2.053525026e+03,  2.128751662e+03,  2.206734069e+03,  2.287573200e+03,
-   2.371373706e+03,  2.458244069e+03,  2.548296748e+03,  2.641648320e+03,
-   2.738419634e+03,  2.838735965e+03,  2.942727176e+03,  3.050527890e+03,
-   3.162277660e+03,  3.278121151e+03,  3.398208329e+03,  3.522694651e+03,
-   3.651741273e+03,  3.785515249e+03,  3.924189758e+03,  4.067944321e+03,
-   4.216965034e+03,  4.371444813e+03,  4.531583638e+03,  4.697588817e+03,
-   4.869675252e+03,  5.048065717e+03,  5.232991147e+03,  5.424690937e+03,
-   5.623413252e+03,  5.829415347e+03,  6.042963902e+03,  6.264335367e+03,
-   6.493816316e+03,  6.731703824e+03,  6.978305849e+03,  7.233941627e+03,
-   7.498942093e+03,  7.773650302e+03,  8.058421878e+03,  8.353625470e+03,
-   8.659643234e+03,  8.976871324e+03,  9.305720409e+03,  9.646616199e+03,
-   1.000000000e+04,
-};
-const float lut_svf_shift[] = {
-   2.500000000e-01,  2.408119579e-01,  2.316544611e-01,  2.225575501e-01,
-   2.135502761e-01,  2.046602549e-01,  1.959132760e-01,  1.873329789e-01,
-   1.789406032e-01,  1.707548172e-01,  1.627916233e-01,  1.550643347e-01,
-   1.475836177e-01,  1.403575876e-01,  1.333919506e-01,  1.266901772e-01,
-   1.202537001e-01,  1.140821254e-01,  1.081734480e-01,  1.025242668e-01,
-   9.712999179e-02,  9.198504051e-02,  8.708302003e-02,  8.241689360e-02,
-   7.797913038e-02,  7.376183852e-02,  6.975688172e-02,  6.595598018e-02,
-   6.235079694e-02,  5.893301078e-02,  5.569437701e-02,  5.262677742e-02,
-   4.972226058e-02,  4.697307381e-02,  4.437168789e-02,  4.191081545e-02,
-   3.958342416e-02,  3.738274529e-02,  3.530227864e-02,  3.333579426e-02,
-   3.147733169e-02,  2.972119704e-02,  2.806195849e-02,  2.649444041e-02,
-   2.501371653e-02,  2.361510230e-02,  2.229414676e-02,  2.104662398e-02,
-   1.986852431e-02,  1.875604550e-02,  1.770558386e-02,  1.671372543e-02,
-   1.577723728e-02,  1.489305906e-02,  1.405829467e-02,  1.327020425e-02,
-   1.252619642e-02,  1.182382076e-02,  1.116076060e-02,  1.053482614e-02,
-   9.943947824e-03,  9.386169992e-03,  8.859644866e-03,  8.362626781e-03,
-   7.893466717e-03,  7.450607078e-03,  7.032576744e-03,  6.637986365e-03,
-   6.265523903e-03,  5.913950392e-03,  5.582095932e-03,  5.268855886e-03,
-   4.973187279e-03,  4.694105394e-03,  4.430680542e-03,  4.182035018e-03,
-   3.947340207e-03,  3.725813861e-03,  3.516717519e-03,  3.319354065e-03,
-   3.133065427e-03,  2.957230396e-03,  2.791262569e-03,  2.634608406e-03,
-   2.486745394e-03,  2.347180309e-03,  2.215447582e-03,  2.091107747e-03,
-   1.973745986e-03,  1.862970740e-03,  1.758412418e-03,  1.659722154e-03,
-   1.566570656e-03,  1.478647104e-03,  1.395658114e-03,  1.317326764e-03,
-   1.243391669e-03,  1.173606108e-03,  1.107737206e-03,  1.045565155e-03,
-   9.868824789e-04,  9.314933471e-04,  8.792129165e-04,  8.298667176e-04,
-   7.832900713e-04,  7.393275405e-04,  6.978324110e-04,  6.586662024e-04,
-   6.216982059e-04,  5.868050482e-04,  5.538702800e-04,  5.227839874e-04,
-   4.934424252e-04,  4.657476707e-04,  4.396072968e-04,  4.149340639e-04,
-   3.916456285e-04,  3.696642688e-04,  3.489166247e-04,  3.293334538e-04,
-   3.108493994e-04,  2.934027734e-04,  2.769353496e-04,  2.613921700e-04,
-   2.467213608e-04,  2.328739600e-04,  2.198037532e-04,  2.074671201e-04,
-   1.958228884e-04,  1.848321967e-04,  1.744583648e-04,  1.646667709e-04,
-   1.554247368e-04,  1.467014179e-04,  1.384677010e-04,  1.306961070e-04,
-   1.233606989e-04,  1.164369956e-04,  1.099018897e-04,  1.037335710e-04,
-   9.791145345e-05,  9.241610615e-05,  8.722918894e-05,  8.233339098e-05,
-   7.771237301e-05,  7.335071282e-05,  6.923385378e-05,  6.534805627e-05,
-   6.168035179e-05,  5.821849973e-05,  5.495094649e-05,  5.186678690e-05,
-   4.895572788e-05,  4.620805405e-05,  4.361459529e-05,  4.116669618e-05,
-   3.885618709e-05,  3.667535690e-05,  3.461692730e-05,  3.267402848e-05,
-   3.084017618e-05,  2.910925011e-05,  2.747547345e-05,  2.593339362e-05,
-   2.447786409e-05,  2.310402715e-05,  2.180729775e-05,  2.058334818e-05,
-   1.942809362e-05,  1.833767851e-05,  1.730846370e-05,  1.633701428e-05,
-   1.542008813e-05,  1.455462508e-05,  1.373773675e-05,  1.296669683e-05,
-   1.223893206e-05,  1.155201359e-05,  1.090364889e-05,  1.029167410e-05,
-   9.714046817e-06,  9.168839263e-06,  8.654231857e-06,  8.168507146e-06,
-   7.710044069e-06,  7.277312546e-06,  6.868868378e-06,  6.483348419e-06,
-   6.119466033e-06,  5.776006796e-06,  5.451824445e-06,  5.145837051e-06,
-   4.857023409e-06,  4.584419632e-06,  4.327115929e-06,  4.084253574e-06,
-   3.855022035e-06,  3.638656274e-06,  3.434434189e-06,  3.241674210e-06,
-   3.059733017e-06,  2.888003398e-06,  2.725912223e-06,  2.572918525e-06,
-   2.428511705e-06,  2.292209816e-06,  2.163557965e-06,  2.042126787e-06,
-   1.927511018e-06,  1.819328137e-06,  1.717217095e-06,  1.620837105e-06,
-   1.529866508e-06,  1.444001699e-06,  1.362956111e-06,  1.286459263e-06,
-   1.214255852e-06,  1.146104908e-06,  1.081778982e-06,  1.021063394e-06,
-   9.637555088e-07,  9.096640684e-07,  8.586085474e-07,  8.104185525e-07,
-   7.649332542e-07,  7.220008496e-07,  6.814780557e-07,  6.432296314e-07,
-   6.071279262e-07,  5.730524541e-07,  5.408894912e-07,  5.105316968e-07,
-   4.818777544e-07,  4.548320342e-07,  4.293042737e-07,  4.052092763e-07,
-   3.824666271e-07,  3.610004248e-07,  3.407390278e-07,  3.216148157e-07,
-   3.035639631e-07,  2.865262270e-07,  2.704447456e-07,  2.552658484e-07,
-   2.409388772e-07,  2.274160171e-07,  2.146521368e-07,  2.026046381e-07,
-   1.912333136e-07,  1.805002124e-07,  1.703695139e-07,  1.608074078e-07,
-   1.517819816e-07,  1.432631135e-07,  1.352223728e-07,  1.276329242e-07,
-   1.204694386e-07,
-};
-const float lut_stiffness[] = {
-  -6.250000000e-02, -6.152343750e-02, -6.054687500e-02, -5.957031250e-02,
-  -5.859375000e-02, -5.761718750e-02, -5.664062500e-02, -5.566406250e-02,
-  -5.468750000e-02, -5.371093750e-02, -5.273437500e-02, -5.175781250e-02,
-  -5.078125000e-02, -4.980468750e-02, -4.882812500e-02, -4.785156250e-02,
-  -4.687500000e-02, -4.589843750e-02, -4.492187500e-02, -4.394531250e-02,
-  -4.296875000e-02, -4.199218750e-02, -4.101562500e-02, -4.003906250e-02,
-  -3.906250000e-02, -3.808593750e-02, -3.710937500e-02, -3.613281250e-02,
-  -3.515625000e-02, -3.417968750e-02, -3.320312500e-02, -3.222656250e-02,
-  -3.125000000e-02, -3.027343750e-02, -2.929687500e-02, -2.832031250e-02,
-  -2.734375000e-02, -2.636718750e-02, -2.539062500e-02, -2.441406250e-02,
-  -2.343750000e-02, -2.246093750e-02, -2.148437500e-02, -2.050781250e-02,
-  -1.953125000e-02, -1.855468750e-02, -1.757812500e-02, -1.660156250e-02,
-  -1.562500000e-02, -1.464843750e-02, -1.367187500e-02, -1.269531250e-02,
-  -1.171875000e-02, -1.074218750e-02, -9.765625000e-03, -8.789062500e-03,
-  -7.812500000e-03, -6.835937500e-03, -5.859375000e-03, -4.882812500e-03,
-  -3.906250000e-03, -2.929687500e-03, -1.953125000e-03, -9.765625000e-04,
-   0.000000000e+00,  0.000000000e+00,  0.000000000e+00,  0.000000000e+00,
-   0.000000000e+00,  0.000000000e+00,  0.000000000e+00,  0.000000000e+00,
-   0.000000000e+00,  0.000000000e+00,  0.000000000e+00,  0.000000000e+00,
-   0.000000000e+00,  6.029410294e-05,  3.672617230e-04,  6.835957809e-04,
-   1.009582073e-03,  1.345515115e-03,  1.691698412e-03,  2.048444725e-03,
-   2.416076364e-03,  2.794925468e-03,  3.185334315e-03,  3.587655624e-03,
-   4.002252878e-03,  4.429500650e-03,  4.869784943e-03,  5.323503537e-03,
-   5.791066350e-03,  6.272895808e-03,  6.769427226e-03,  7.281109202e-03,
-   7.808404022e-03,  8.351788076e-03,  8.911752293e-03,  9.488802580e-03,
-   1.008346028e-02,  1.069626264e-02,  1.132776331e-02,  1.197853283e-02,
-   1.264915914e-02,  1.334024813e-02,  1.405242417e-02,  1.478633069e-02,
-   1.554263074e-02,  1.632200761e-02,  1.712516545e-02,  1.795282987e-02,
-   1.880574864e-02,  1.968469234e-02,  2.059045506e-02,  2.152385512e-02,
-   2.248573583e-02,  2.347696619e-02,  2.449844176e-02,  2.555108540e-02,
-   2.663584813e-02,  2.775370999e-02,  2.890568094e-02,  3.009280173e-02,
-   3.131614488e-02,  3.257681565e-02,  3.387595299e-02,  3.521473064e-02,
-   3.659435812e-02,  3.801608189e-02,  3.948118641e-02,  4.099099536e-02,
-   4.254687278e-02,  4.415022437e-02,  4.580249868e-02,  4.750518848e-02,
-   4.925983210e-02,  5.106801479e-02,  5.293137017e-02,  5.485158172e-02,
-   5.683038428e-02,  5.886956562e-02,  6.097096806e-02,  6.313649016e-02,
-   6.536808837e-02,  6.766777886e-02,  7.003763933e-02,  7.247981084e-02,
-   7.499649981e-02,  7.758997998e-02,  8.026259446e-02,  8.301675786e-02,
-   8.585495846e-02,  8.877976048e-02,  9.179380636e-02,  9.489981918e-02,
-   9.810060511e-02,  1.013990559e-01,  1.047981517e-01,  1.083009634e-01,
-   1.119106556e-01,  1.156304895e-01,  1.194638260e-01,  1.234141283e-01,
-   1.274849653e-01,  1.316800149e-01,  1.360030671e-01,  1.404580277e-01,
-   1.450489216e-01,  1.497798965e-01,  1.546552266e-01,  1.596793166e-01,
-   1.648567056e-01,  1.701920711e-01,  1.756902336e-01,  1.813561603e-01,
-   1.871949702e-01,  1.932119385e-01,  1.994125013e-01,  2.058022605e-01,
-   2.123869891e-01,  2.191726361e-01,  2.261653322e-01,  2.333713949e-01,
-   2.407973346e-01,  2.484498605e-01,  2.563358863e-01,  2.644625367e-01,
-   2.728371538e-01,  2.814673039e-01,  2.903607839e-01,  2.995256288e-01,
-   3.089701187e-01,  3.187027863e-01,  3.287324247e-01,  3.390680953e-01,
-   3.497191360e-01,  3.606951697e-01,  3.720061128e-01,  3.836621843e-01,
-   3.956739150e-01,  4.080521572e-01,  4.208080940e-01,  4.339532500e-01,
-   4.474995013e-01,  4.614590865e-01,  4.758446177e-01,  4.906690914e-01,
-   5.059459012e-01,  5.216888491e-01,  5.379121581e-01,  5.546304856e-01,
-   5.718589358e-01,  5.896130741e-01,  6.079089407e-01,  6.267630651e-01,
-   6.461924814e-01,  6.662147434e-01,  6.868479405e-01,  7.081107139e-01,
-   7.300222738e-01,  7.526024164e-01,  7.758715422e-01,  7.998506739e-01,
-   8.245614757e-01,  8.500262730e-01,  8.762680723e-01,  9.033105820e-01,
-   9.311782340e-01,  9.598962059e-01,  9.894904431e-01,  1.000000745e+00,
-   1.000037649e+00,  1.000262504e+00,  1.000964607e+00,  1.002570034e+00,
-   1.005639154e+00,  1.010861180e+00,  1.019043988e+00,  1.031097087e+00,
-   1.048005353e+00,  1.070791059e+00,  1.100461817e+00,  1.137942574e+00,
-   1.183990632e+00,  1.239094135e+00,  1.303356514e+00,  1.376372085e+00,
-   1.457101344e+00,  1.543758274e+00,  1.633725943e+00,  1.723520185e+00,
-   1.808823654e+00,  1.884612937e+00,  1.945398753e+00,  2.000000000e+00,
-   2.000000000e+00,
-};
-const float lut_fm_frequency_quantizer[] = {
-  -1.200000000e+01, -1.200000000e+01, -1.200000000e+01, -1.184000000e+01,
-  -1.184000000e+01, -1.184000000e+01, -1.111000000e+01, -1.038000000e+01,
-  -9.650000000e+00, -8.920000000e+00, -8.190000000e+00, -7.460000000e+00,
-  -6.730000000e+00, -6.000000000e+00, -6.000000000e+00, -6.000000000e+00,
-  -5.545511612e+00, -5.091023223e+00, -4.636534835e+00, -4.182046446e+00,
-  -4.182046446e+00, -4.182046446e+00, -3.659290641e+00, -3.136534835e+00,
-  -2.613779029e+00, -2.091023223e+00, -1.568267417e+00, -1.045511612e+00,
-  -5.227558058e-01,  0.000000000e+00,  0.000000000e+00,  0.000000000e+00,
-   1.600000000e-01,  1.600000000e-01,  1.600000000e-01,  8.900000000e-01,
-   1.620000000e+00,  2.350000000e+00,  3.080000000e+00,  3.810000000e+00,
-   4.540000000e+00,  5.270000000e+00,  6.000000000e+00,  6.000000000e+00,
-   6.000000000e+00,  6.454488388e+00,  6.908976777e+00,  7.363465165e+00,
-   7.817953554e+00,  7.817953554e+00,  7.817953554e+00,  8.285529931e+00,
-   8.753106309e+00,  9.220682687e+00,  9.688259065e+00,  9.688259065e+00,
-   9.688259065e+00,  1.026619430e+01,  1.084412953e+01,  1.142206477e+01,
-   1.200000000e+01,  1.200000000e+01,  1.200000000e+01,  1.216000000e+01,
-   1.216000000e+01,  1.216000000e+01,  1.262977500e+01,  1.309955001e+01,
-   1.356932501e+01,  1.403910002e+01,  1.403910002e+01,  1.403910002e+01,
-   1.490761987e+01,  1.577613972e+01,  1.664465957e+01,  1.751317942e+01,
-   1.751317942e+01,  1.751317942e+01,  1.800000000e+01,  1.800000000e+01,
-   1.800000000e+01,  1.850977500e+01,  1.901955001e+01,  1.901955001e+01,
-   1.901955001e+01,  1.981795355e+01,  1.981795355e+01,  1.981795355e+01,
-   2.066386428e+01,  2.150977500e+01,  2.150977500e+01,  2.150977500e+01,
-   2.213233125e+01,  2.275488750e+01,  2.337744375e+01,  2.400000000e+01,
-   2.400000000e+01,  2.400000000e+01,  2.450977500e+01,  2.501955001e+01,
-   2.501955001e+01,  2.501955001e+01,  2.547403840e+01,  2.592852679e+01,
-   2.638301517e+01,  2.683750356e+01,  2.683750356e+01,  2.683750356e+01,
-   2.735032035e+01,  2.786313714e+01,  2.786313714e+01,  2.786313714e+01,
-   2.839735285e+01,  2.893156857e+01,  2.946578428e+01,  3.000000000e+01,
-   3.000000000e+01,  3.000000000e+01,  3.075000000e+01,  3.150000000e+01,
-   3.225000000e+01,  3.300000000e+01,  3.375000000e+01,  3.450000000e+01,
-   3.525000000e+01,  3.600000000e+01,  3.600000000e+01,  3.600000000e+01,
-   3.600000000e+01,
-};
-
-
-const float* lookup_table_table[] = {
-  lut_sine,
-  lut_4_decades,
-  lut_svf_shift,
-  lut_stiffness,
-  lut_fm_frequency_quantizer,
-};
-
 
 }  // namespace rings
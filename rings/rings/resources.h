@@ -36,6 +36,8 @@
 
 #include "stmlib/stmlib.h"
 
+#include "rings/dsp/lookup_tables.h"
+
 
 
 namespace rings {
@@ -46,23 +48,6 @@ extern const int16_t* lookup_table_int16_table[];
 
 extern const uint32_t* lookup_table_uint32_table[];
 
-extern const float* lookup_table_table[];
-
-extern const float lut_sine[];
-extern const float lut_4_decades[];
-extern const float lut_svf_shift[];
-extern const float lut_stiffness[];
-extern const float lut_fm_frequency_quantizer[];
-constexpr auto LUT_SINE = 0;
-constexpr auto LUT_SINE_SIZE = 5121;
-constexpr auto LUT_4_DECADES = 1;
-constexpr auto LUT_4_DECADES_SIZE = 257;
-constexpr auto LUT_SVF_SHIFT = 2;
-constexpr auto LUT_SVF_SHIFT_SIZE = 257;
-constexpr auto LUT_STIFFNESS = 3;
-constexpr auto LUT_STIFFNESS_SIZE = 257;
-constexpr auto LUT_FM_FREQUENCY_QUANTIZER = 4;
-constexpr auto LUT_FM_FREQUENCY_QUANTIZER_SIZE = 129;
 
 }  // namespace rings
 
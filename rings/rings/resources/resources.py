@@ -65,6 +65,8 @@ target = 'rings'
 types = ['uint8_t', 'uint16_t']
 includes = """
 #include "stmlib/stmlib.h"
+
+#include "rings/dsp/lookup_tables.h"
 """
 
 import lookup_tables
@@ -75,7 +77,5 @@ resources = [
   (lookup_tables.int16_lookup_tables,
    'lookup_table_int16', 'LUT', 'int16_t', int, False),
   (lookup_tables.uint32_lookup_tables,
-   'lookup_table_uint32', 'LUT', 'uint32_t', int, False),
-  (lookup_tables.lookup_tables,
-   'lookup_table', 'LUT', 'float', float, False)
+   'lookup_table_uint32', 'LUT', 'uint32_t', int, False)
 ]
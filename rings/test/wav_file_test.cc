@@ -0,0 +1,110 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Writes WAV files and reads them back: the file holds the header followed
+// by all the frames written.
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "rings/offline/wav_file.h"
+
+using namespace rings;
+using namespace std;
+
+const size_t kNumFrames = 48000;
+const size_t kWavHeaderSize = 44;
+
+static bool TestFormat(WavSampleFormat format, const char* name) {
+  char path[] = "/tmp/wav_file_test_XXXXXX";
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    return false;
+  }
+  close(fd);
+  
+  // Both channels carry the same ramp, so that the mono mix read back is the
+  // ramp itself.
+  vector<float> ramp(kNumFrames);
+  for (size_t i = 0; i < kNumFrames; ++i) {
+    ramp[i] = static_cast<float>(i % 1000) / 1000.0f - 0.5f;
+  }
+  WavWriter writer;
+  bool success = writer.Open(path, 48000, format);
+  for (size_t i = 0; success && i < kNumFrames; i += 512) {
+    size_t size = min(kNumFrames - i, size_t(512));
+    success = writer.Write(&ramp[i], &ramp[i], size);
+  }
+  success = writer.Close() && success;
+  
+  size_t sample_size = format == WAV_SAMPLE_FORMAT_INT16 ? 2 : 4;
+  size_t data_size = kNumFrames * 2 * sample_size;
+  struct stat st;
+  if (!success || stat(path, &st) != 0) {
+    fprintf(stderr, "%s: cannot write the file\n", name);
+    unlink(path);
+    return false;
+  }
+  if (size_t(st.st_size) != kWavHeaderSize + data_size) {
+    fprintf(stderr, "%s: file size %zu, expected %zu\n",
+        name, size_t(st.st_size), kWavHeaderSize + data_size);
+    unlink(path);
+    return false;
+  }
+  
+  WavReader reader;
+  if (!reader.Open(path) || reader.num_frames() != kNumFrames) {
+    fprintf(stderr, "%s: cannot read the file back\n", name);
+    unlink(path);
+    return false;
+  }
+  float tolerance = format == WAV_SAMPLE_FORMAT_INT16 ? 1.0f / 16384.0f : 0.0f;
+  vector<float> read(kNumFrames);
+  size_t position = 0;
+  size_t n;
+  while ((n = reader.Read(&read[position], kNumFrames - position)) != 0) {
+    position += n;
+  }
+  reader.Close();
+  unlink(path);
+  for (size_t i = 0; i < kNumFrames; ++i) {
+    if (fabsf(read[i] - ramp[i]) > tolerance) {
+      fprintf(stderr, "%s: frame %zu is %f, expected %f\n",
+          name, i, read[i], ramp[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  bool success = TestFormat(WAV_SAMPLE_FORMAT_INT16, "int16");
+  success = TestFormat(WAV_SAMPLE_FORMAT_FLOAT, "float") && success;
+  return success ? 0 : 1;
+}
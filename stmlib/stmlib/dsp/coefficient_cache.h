@@ -0,0 +1,101 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Change detection for coefficients derived from slowly varying parameters.
+//
+// Filter banks and envelopes recompute their coefficients (tan, powf,
+// exponentials...) from a handful of parameters at each block, even though
+// the parameters rarely move. CoefficientCache remembers the parameters the
+// coefficients were last computed from, and tells whether one of them has
+// changed since then. By default the comparison is exact, so the cache does
+// not change the output. Callers which tolerate some drift can give a
+// relative tolerance per parameter; since the comparison is made with the
+// values the coefficients were computed from, slow drifts are still
+// followed.
+
+#ifndef STMLIB_DSP_COEFFICIENT_CACHE_H_
+#define STMLIB_DSP_COEFFICIENT_CACHE_H_
+
+#include "stmlib/stmlib.h"
+
+#include <cmath>
+
+namespace stmlib {
+
+template<size_t num_parameters>
+class CoefficientCache {
+ public:
+  CoefficientCache() { }
+  ~CoefficientCache() { }
+  
+  void Init() {
+    for (size_t i = 0; i < num_parameters; ++i) {
+      tolerance_[i] = 0.0f;
+    }
+    Invalidate();
+  }
+  
+  // Relative tolerances, per parameter. 1e-4 is 0.17 cent on a frequency.
+  void Init(const float (&tolerances)[num_parameters]) {
+    for (size_t i = 0; i < num_parameters; ++i) {
+      tolerance_[i] = tolerances[i];
+    }
+    Invalidate();
+  }
+  
+  inline void Invalidate() {
+    valid_ = false;
+  }
+  
+  // Returns true, and remembers the new parameters, when the coefficients
+  // must be recomputed.
+  inline bool Update(const float (&parameters)[num_parameters]) {
+    if (valid_) {
+      bool changed = false;
+      for (size_t i = 0; i < num_parameters; ++i) {
+        float error = fabsf(parameters[i] - parameters_[i]);
+        changed |= error > tolerance_[i] * fabsf(parameters_[i]);
+      }
+      if (!changed) {
+        return false;
+      }
+    }
+    for (size_t i = 0; i < num_parameters; ++i) {
+      parameters_[i] = parameters[i];
+    }
+    valid_ = true;
+    return true;
+  }
+  
+ private:
+  float parameters_[num_parameters];
+  float tolerance_[num_parameters];
+  bool valid_;
+  
+  DISALLOW_COPY_AND_ASSIGN(CoefficientCache);
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_COEFFICIENT_CACHE_H_
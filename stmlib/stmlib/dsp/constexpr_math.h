@@ -0,0 +1,226 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Compile-time math, for generating lookup tables with constexpr functions
+// rather than with offline scripts.
+//
+// Everything is computed in double precision with range reduction followed by
+// Taylor series, which is accurate to a few ulps - way more than what is
+// needed for float tables.
+
+#ifndef STMLIB_DSP_CONSTEXPR_MATH_H_
+#define STMLIB_DSP_CONSTEXPR_MATH_H_
+
+#include <stddef.h>
+
+namespace stmlib {
+
+namespace constexpr_math {
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kLn2 = 0.69314718055994530942;
+
+constexpr double Abs(double x) {
+  return x < 0.0 ? -x : x;
+}
+
+constexpr double Sqrt(double x) {
+  if (x <= 0.0) {
+    return 0.0;
+  }
+  double y = x > 1.0 ? x : 1.0;
+  for (int i = 0; i < 64; ++i) {
+    double next = 0.5 * (y + x / y);
+    if (next == y) {
+      break;
+    }
+    y = next;
+  }
+  return y;
+}
+
+constexpr double Exp(double x) {
+  // x = k * ln(2) + r, with |r| <= ln(2) / 2.
+  int k = static_cast<int>(x / kLn2 + (x < 0.0 ? -0.5 : 0.5));
+  double r = x - k * kLn2;
+  double sum = 1.0;
+  double term = 1.0;
+  for (int n = 1; n < 30 && sum + term != sum; ++n) {
+    term *= r / n;
+    sum += term;
+  }
+  for (; k > 0; --k) {
+    sum *= 2.0;
+  }
+  for (; k < 0; ++k) {
+    sum *= 0.5;
+  }
+  return sum;
+}
+
+constexpr double Log(double x) {
+  // x = m * 2^e, with m in [sqrt(1/2), sqrt(2)).
+  int e = 0;
+  while (x >= 1.41421356237309504880) {
+    x *= 0.5;
+    ++e;
+  }
+  while (x < 0.70710678118654752440) {
+    x *= 2.0;
+    --e;
+  }
+  // log(m) = 2 atanh((m - 1) / (m + 1)).
+  double s = (x - 1.0) / (x + 1.0);
+  double s2 = s * s;
+  double sum = 0.0;
+  double power = s;
+  for (int n = 0; n < 40 && sum + power != sum; ++n) {
+    sum += power / (2 * n + 1);
+    power *= s2;
+  }
+  return 2.0 * sum + e * kLn2;
+}
+
+constexpr double Pow(double base, double exponent) {
+  return Exp(exponent * Log(base));
+}
+
+constexpr double Log2(double x) {
+  return Log(x) / kLn2;
+}
+
+constexpr double Sin(double x) {
+  // Reduce to [-pi, pi], then to [-pi/2, pi/2].
+  double turns = x / (2.0 * kPi);
+  long long k = static_cast<long long>(turns + (turns < 0.0 ? -0.5 : 0.5));
+  x -= k * 2.0 * kPi;
+  if (x > 0.5 * kPi) {
+    x = kPi - x;
+  } else if (x < -0.5 * kPi) {
+    x = -kPi - x;
+  }
+  double x2 = x * x;
+  double sum = 0.0;
+  double term = x;
+  for (int n = 1; n < 40 && sum + term != sum; n += 2) {
+    sum += term;
+    term *= -x2 / ((n + 1) * (n + 2));
+  }
+  return sum;
+}
+
+constexpr double Cos(double x) {
+  return Sin(x + 0.5 * kPi);
+}
+
+constexpr double Atan(double x) {
+  if (x < 0.0) {
+    return -Atan(-x);
+  }
+  if (x > 1.0) {
+    return 0.5 * kPi - Atan(1.0 / x);
+  }
+  // Halve the argument twice: atan(x) = 2 atan(x / (1 + sqrt(1 + x^2))).
+  double scale = 1.0;
+  for (int i = 0; i < 2; ++i) {
+    x = x / (1.0 + Sqrt(1.0 + x * x));
+    scale *= 2.0;
+  }
+  double x2 = x * x;
+  double sum = 0.0;
+  double power = x;
+  for (int n = 0; n < 40 && sum + power != sum; ++n) {
+    sum += (n & 1 ? -power : power) / (2 * n + 1);
+    power *= x2;
+  }
+  return scale * sum;
+}
+
+}  // namespace constexpr_math
+
+// Fixed-size table filled at compile time by a generator function. The
+// generator is called with each index in [0, size).
+template<size_t size>
+struct LookupTable {
+  float values[size];
+};
+
+template<size_t size, typename Generator>
+constexpr LookupTable<size> MakeLookupTable(Generator generator) {
+  LookupTable<size> table = { };
+  for (size_t i = 0; i < size; ++i) {
+    table.values[i] = static_cast<float>(generator(i));
+  }
+  return table;
+}
+
+}  // namespace stmlib
+
+// Expand to the n values of a table starting at index i, to initialize an
+// array from it. A table with a size that is not a power of two is copied by
+// pieces:
+//
+//   const float lut_foo[257] = {
+//     STMLIB_LOOKUP_TABLE_VALUES_256(foo, 0),
+//     STMLIB_LOOKUP_TABLE_VALUES_1(foo, 256)
+//   };
+#define STMLIB_LOOKUP_TABLE_VALUES_1(table, i) (table).values[i]
+#define STMLIB_LOOKUP_TABLE_VALUES_2(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_1(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_1(table, (i) + 1)
+#define STMLIB_LOOKUP_TABLE_VALUES_4(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_2(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_2(table, (i) + 2)
+#define STMLIB_LOOKUP_TABLE_VALUES_8(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_4(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_4(table, (i) + 4)
+#define STMLIB_LOOKUP_TABLE_VALUES_16(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_8(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_8(table, (i) + 8)
+#define STMLIB_LOOKUP_TABLE_VALUES_32(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_16(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_16(table, (i) + 16)
+#define STMLIB_LOOKUP_TABLE_VALUES_64(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_32(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_32(table, (i) + 32)
+#define STMLIB_LOOKUP_TABLE_VALUES_128(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_64(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_64(table, (i) + 64)
+#define STMLIB_LOOKUP_TABLE_VALUES_256(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_128(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_128(table, (i) + 128)
+#define STMLIB_LOOKUP_TABLE_VALUES_512(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_256(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_256(table, (i) + 256)
+#define STMLIB_LOOKUP_TABLE_VALUES_1024(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_512(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_512(table, (i) + 512)
+#define STMLIB_LOOKUP_TABLE_VALUES_2048(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_1024(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_1024(table, (i) + 1024)
+#define STMLIB_LOOKUP_TABLE_VALUES_4096(table, i) \
+  STMLIB_LOOKUP_TABLE_VALUES_2048(table, i), \
+  STMLIB_LOOKUP_TABLE_VALUES_2048(table, (i) + 2048)
+
+#endif  // STMLIB_DSP_CONSTEXPR_MATH_H_
@@ -30,13 +30,16 @@
 #define STMLIB_DSP_DELAY_LINE_H_
 
 #include "stmlib/stmlib.h"
+#include "stmlib/dsp/denormal.h"
 #include "stmlib/dsp/dsp.h"
+#include "stmlib/dsp/sample_storage.h"
 
 #include <algorithm>
 
 namespace stmlib {
 
-template<typename T, size_t max_delay>
+// Samples are computed as T and stored as S, see sample_storage.h.
+template<typename T, size_t max_delay, typename S = T>
 class DelayLine {
  public:
   DelayLine() { }
@@ -47,7 +50,7 @@ class DelayLine {
   }
 
   void Reset() {
-    std::fill(&line_[0], &line_[max_delay], T(0));
+    std::fill(&line_[0], &line_[max_delay], Storage::Store(T(0)));
     delay_ = 1;
     write_ptr_ = 0;
   }
@@ -57,13 +60,13 @@ class DelayLine {
   }
 
   inline void Write(const T sample) {
-    line_[write_ptr_] = sample;
+    line_[write_ptr_] = Storage::Store(sample);
     write_ptr_ = (write_ptr_ - 1 + max_delay) % max_delay;
   }
   
   inline const T Allpass(const T sample, size_t delay, const T coefficient) {
-    T read = line_[(write_ptr_ + delay) % max_delay];
-    T write = sample + coefficient * read;
+    T read = Load((write_ptr_ + delay) % max_delay);
+    T write = FlushDenormal(sample + coefficient * read);
     Write(write);
     return -write * coefficient + read;
   }
@@ -74,27 +77,27 @@ class DelayLine {
   }
   
   inline const T Read() const {
-    return line_[(write_ptr_ + delay_) % max_delay];
+    return Load((write_ptr_ + delay_) % max_delay);
   }
   
   inline const T Read(size_t delay) const {
-    return line_[(write_ptr_ + delay) % max_delay];
+    return Load((write_ptr_ + delay) % max_delay);
   }
 
   inline const T Read(float delay) const {
     MAKE_INTEGRAL_FRACTIONAL(delay)
-    const T a = line_[(write_ptr_ + delay_integral) % max_delay];
-    const T b = line_[(write_ptr_ + delay_integral + 1) % max_delay];
+    const T a = Load((write_ptr_ + delay_integral) % max_delay);
+    const T b = Load((write_ptr_ + delay_integral + 1) % max_delay);
     return a + (b - a) * delay_fractional;
   }
   
   inline const T ReadHermite(float delay) const {
     MAKE_INTEGRAL_FRACTIONAL(delay)
     int32_t t = (write_ptr_ + delay_integral + max_delay);
-    const T xm1 = line_[(t - 1) % max_delay];
-    const T x0 = line_[(t) % max_delay];
-    const T x1 = line_[(t + 1) % max_delay];
-    const T x2 = line_[(t + 2) % max_delay];
+    const T xm1 = Load((t - 1) % max_delay);
+    const T x0 = Load((t) % max_delay);
+    const T x1 = Load((t + 1) % max_delay);
+    const T x2 = Load((t + 2) % max_delay);
     const float c = (x1 - xm1) * 0.5f;
     const float v = x0 - x1;
     const float w = c + v;
@@ -105,9 +108,15 @@ class DelayLine {
   }
 
  private:
+  typedef SampleStorage<S> Storage;
+
+  inline const T Load(size_t index) const {
+    return Storage::Load(line_[index]);
+  }
+
   size_t write_ptr_;
   size_t delay_;
-  T line_[max_delay];
+  S line_[max_delay];
   
   DISALLOW_COPY_AND_ASSIGN(DelayLine);
 };
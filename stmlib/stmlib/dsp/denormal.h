@@ -0,0 +1,121 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Protection against subnormal numbers.
+//
+// Recursive filters and feedback delay lines decay toward zero after a note,
+// and most FPUs are much slower on subnormal numbers. ScopedFlushDenormals
+// enables the flush-to-zero mode of the FPU (and denormals-are-zero on x86)
+// for the lifetime of the object, and is meant to be instantiated at the
+// entry of the audio processing functions.
+//
+// On targets where this mode cannot be set, or when STMLIB_FLUSH_DENORMALS is
+// defined, FlushDenormal() flushes the values which are fed back in the filters
+// and delay lines instead. Otherwise it does nothing.
+
+#ifndef STMLIB_DSP_DENORMAL_H_
+#define STMLIB_DSP_DENORMAL_H_
+
+#include "stmlib/stmlib.h"
+
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define STMLIB_HAS_FLUSH_TO_ZERO
+#elif defined(__aarch64__) || (defined(__ARM_FP) && !defined(__SOFTFP__))
+#define STMLIB_HAS_FLUSH_TO_ZERO
+#endif
+
+#ifndef STMLIB_HAS_FLUSH_TO_ZERO
+#define STMLIB_FLUSH_DENORMALS
+#endif
+
+namespace stmlib {
+
+class ScopedFlushDenormals {
+ public:
+  ScopedFlushDenormals() {
+#if defined(__SSE__) || defined(_M_X64)
+    // FTZ (bit 15) and DAZ (bit 6).
+    state_ = _mm_getcsr();
+    _mm_setcsr(state_ | 0x8040);
+#elif defined(__aarch64__)
+    // FZ (bit 24) of FPCR.
+    uint64_t fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    state_ = fpcr;
+    fpcr |= 1 << 24;
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#elif defined(__ARM_FP) && !defined(__SOFTFP__)
+    // FZ (bit 24) of FPSCR.
+    uint32_t fpscr;
+    __asm__ __volatile__("vmrs %0, fpscr" : "=r"(fpscr));
+    state_ = fpscr;
+    fpscr |= 1 << 24;
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"(fpscr));
+#endif
+  }
+
+  ~ScopedFlushDenormals() {
+#if defined(__SSE__) || defined(_M_X64)
+    _mm_setcsr(state_);
+#elif defined(__aarch64__)
+    uint64_t fpcr = state_;
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#elif defined(__ARM_FP) && !defined(__SOFTFP__)
+    uint32_t fpscr = state_;
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"(fpscr));
+#endif
+  }
+
+ private:
+#if defined(__aarch64__)
+  uint64_t state_;
+#else
+  uint32_t state_;
+#endif
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedFlushDenormals);
+};
+
+// Values below -400dB are flushed, well before the products computed from
+// them become subnormal.
+inline float FlushDenormal(float x) {
+#ifdef STMLIB_FLUSH_DENORMALS
+  return fabsf(x) < 1e-20f ? 0.0f : x;
+#else
+  return x;
+#endif  // STMLIB_FLUSH_DENORMALS
+}
+
+// For code templated on the sample type: integers are never subnormal.
+template<typename T>
+inline T FlushDenormal(T x) {
+  return x;
+}
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_DENORMAL_H_
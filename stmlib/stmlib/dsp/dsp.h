@@ -34,7 +34,7 @@
 #include <cmath>
 #include <math.h>
 
-#include <crack/audio/MathContext.h>
+#include "stmlib/dsp/math_policy.h"
 
 namespace stmlib
 {
@@ -76,6 +76,25 @@ namespace stmlib
 		return a + (b - a) * index_fractional;
 	}
 
+	// sin(2 pi phase) for phase >= 0, without table lookup so that loops
+	// calling it can be vectorized. The phase is folded to [-1/4, 1/4] and the
+	// sine is evaluated with its Taylor series up to x^11 (error < 3e-7).
+	inline float SinePolynomial(float phase) {
+		phase -= static_cast<float>(static_cast<int32_t>(phase));
+		float t = phase - 0.5f;
+		t = t > 0.25f ? 0.5f - t : t;
+		t = t < -0.25f ? -0.5f - t : t;
+		float const x = t * 6.28318530718f;
+		float const x2 = x * x;
+		float s = -1.0f / 39916800.0f;
+		s = s * x2 + 1.0f / 362880.0f;
+		s = s * x2 - 1.0f / 5040.0f;
+		s = s * x2 + 1.0f / 120.0f;
+		s = s * x2 - 1.0f / 6.0f;
+		s = s * x2 + 1.0f;
+		return -x * s;
+	}
+
 	inline float SmoothStep(float value) {
 		return value * value * (3.0f - 2.0f * value);
 	}
@@ -107,9 +126,8 @@ namespace stmlib
 		return x * (27.0f + x * x) / (27.0f + 9.0f * x * x);
 	}
 
+	template<typename math = DefaultMath>
 	inline float SoftClip(float x) {
-		using math = crack::audio::StdContext;
-
 		return math::clamp(SoftLimit(x), -1.0f, 1.0f);
 	}
 
@@ -125,9 +143,8 @@ namespace stmlib
 		return static_cast<uint16_t>(clamp_i32(x, 0, 65535));
 	}
 
+	template<typename math = DefaultMath>
 	inline float Sqrt(float x) {
-		using math = crack::audio::StdContext;
-
 		return math::sqrt0(x);
 	}
 
@@ -31,6 +31,7 @@
 #define STMLIB_DSP_FILTER_H_
 
 #include "stmlib/stmlib.h"
+#include "stmlib/dsp/denormal.h"
 
 #include <cmath>
 #include <algorithm>
@@ -83,6 +84,12 @@ class DCBlocker {
     y_ = y;
   }
   
+  // See stmlib/dsp/denormal.h.
+  inline void FlushDenormals() {
+    x_ = FlushDenormal(x_);
+    y_ = FlushDenormal(y_);
+  }
+  
  private:
   float pole_;
   float x_;
@@ -106,9 +113,10 @@ class OnePole {
   template<FrequencyApproximation approximation>
   static inline float tan(float f) {
     if constexpr (approximation == FREQUENCY_EXACT) {
-      // Clip coefficient to about 100.
+      // Clip coefficient to about 100. The tangent is the one of the math
+      // policy, see stmlib/dsp/math_policy.h.
       f = f < 0.497f ? f : 0.497f;
-      return tanf(M_PI_F * f);
+      return DefaultMath::tan(M_PI_F * f);
     } else if constexpr (approximation == FREQUENCY_DIRTY) {
       // Optimized for frequencies below 8kHz.
       const float a = 3.736e-01f * M_PI_POW_3;
@@ -188,6 +196,12 @@ class Svf {
     state_1_ = state_2_ = 0.0f;
   }
   
+  // See stmlib/dsp/denormal.h.
+  inline void FlushDenormals() {
+    state_1_ = FlushDenormal(state_1_);
+    state_2_ = FlushDenormal(state_2_);
+  }
+  
   // Copy settings from another filter.
   inline void set(const Svf& f) {
     g_ = f.g();
@@ -0,0 +1,153 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Block kernels compiled for several instruction sets, selected at runtime.
+
+#include "stmlib/dsp/kernels.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "stmlib/dsp/dsp.h"
+#include "stmlib/dsp/filter.h"
+#include "stmlib/utils/cpu_features.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STMLIB_KERNELS_X86
+#include <immintrin.h>
+#endif  // __GNUC__
+
+static_assert(
+    stmlib::FILTER_MODE_HIGH_PASS + 1 == stmlib::kNumSvfModes,
+    "The svf kernel tables are indexed by FilterMode");
+
+// Baseline instruction set of the target.
+#define STMLIB_KERNELS_NAMESPACE baseline
+#if defined(__aarch64__) || defined(__ARM_NEON)
+#define STMLIB_KERNELS_NAME "neon"
+#elif defined(__SSE2__) || defined(_M_X64)
+#define STMLIB_KERNELS_NAME "sse2"
+#else
+#define STMLIB_KERNELS_NAME "generic"
+#endif  // __aarch64__
+#define STMLIB_KERNELS_CPU_FEATURES 0
+#define STMLIB_KERNELS_WIDTH 4
+#include "stmlib/dsp/kernels_impl.h"
+#undef STMLIB_KERNELS_NAMESPACE
+#undef STMLIB_KERNELS_NAME
+#undef STMLIB_KERNELS_CPU_FEATURES
+#undef STMLIB_KERNELS_WIDTH
+
+#ifdef STMLIB_KERNELS_X86
+
+// AVX2, with fused multiply-adds and half precision conversions (Haswell and
+// later, Zen and later).
+#ifdef __clang__
+#pragma clang attribute push( \
+    __attribute__((target("avx2,fma,f16c"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,fma,f16c")
+#endif  // __clang__
+#define STMLIB_KERNELS_NAMESPACE avx2
+#define STMLIB_KERNELS_NAME "avx2"
+#define STMLIB_KERNELS_CPU_FEATURES \
+    (CPU_FEATURE_AVX | CPU_FEATURE_AVX2 | CPU_FEATURE_FMA | CPU_FEATURE_F16C)
+#define STMLIB_KERNELS_WIDTH 8
+#define STMLIB_KERNELS_F16C
+#include "stmlib/dsp/kernels_impl.h"
+#undef STMLIB_KERNELS_NAMESPACE
+#undef STMLIB_KERNELS_NAME
+#undef STMLIB_KERNELS_CPU_FEATURES
+#undef STMLIB_KERNELS_WIDTH
+#undef STMLIB_KERNELS_F16C
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif  // __clang__
+
+#endif  // STMLIB_KERNELS_X86
+
+namespace stmlib {
+
+std::atomic<const Kernels*> selected_kernels(NULL);
+
+namespace {
+
+const Kernels* const variants[] = {
+#ifdef STMLIB_KERNELS_X86
+  &avx2::table,
+#endif  // STMLIB_KERNELS_X86
+  &baseline::table
+};
+
+const size_t kNumVariants = sizeof(variants) / sizeof(variants[0]);
+
+const Kernels* FindKernels(const char* name) {
+  for (size_t i = 0; i < kNumVariants; ++i) {
+    if (!HasCpuFeatures(variants[i]->cpu_features)) {
+      continue;
+    }
+    if (!name || !strcmp(name, variants[i]->name)) {
+      return variants[i];
+    }
+  }
+  return NULL;
+}
+
+}  // namespace
+
+size_t num_kernel_variants() {
+  return kNumVariants;
+}
+
+const Kernels& kernel_variant(size_t index) {
+  return *variants[index];
+}
+
+bool SelectKernels(const char* name) {
+  const Kernels* k = FindKernels(name);
+  if (!k) {
+    return false;
+  }
+  selected_kernels.store(k, std::memory_order_release);
+  return true;
+}
+
+const Kernels& ResolveKernels() {
+  const char* name = getenv("STMLIB_KERNELS");
+  const Kernels* k = name ? FindKernels(name) : NULL;
+  if (!k) {
+    k = FindKernels(NULL);
+  }
+  // Threads racing here all come to the same choice, and a variant selected
+  // with SelectKernels() in the meantime is kept.
+  const Kernels* expected = NULL;
+  selected_kernels.compare_exchange_strong(
+      expected, k, std::memory_order_acq_rel);
+  return *selected_kernels.load(std::memory_order_acquire);
+}
+
+}  // namespace stmlib
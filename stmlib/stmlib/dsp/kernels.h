@@ -0,0 +1,120 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Block kernels compiled for several instruction sets, selected at runtime.
+//
+// The library is compiled for the baseline instruction set of its target
+// (SSE2 on x86-64, NEON on ARMv8), so that a single binary runs on every
+// machine. The kernels below are compiled once more for the wider vector
+// units of recent x86 CPUs (AVX2 with FMA and F16C), and the best variant
+// supported by the host is selected on the first call to kernels(). The
+// STMLIB_KERNELS environment variable forces a variant by name, and
+// SelectKernels() does the same for benchmarks.
+//
+// The kernels are reached through a table of function pointers, so they are
+// only used on blocks of samples or banks of filters, where the cost of the
+// indirect call is amortized. Per-sample code, and single recursive filters
+// which have nothing to gain from wider registers, stay inline.
+
+#ifndef STMLIB_DSP_KERNELS_H_
+#define STMLIB_DSP_KERNELS_H_
+
+#include "stmlib/stmlib.h"
+#include "stmlib/dsp/sample_storage.h"
+
+#include <atomic>
+
+namespace stmlib {
+
+// The svf_bank tables are indexed by FilterMode (see stmlib/dsp/filter.h).
+const size_t kNumSvfModes = 4;
+
+// The arrays of an SvfBank hold a multiple of kSvfBankPadding filters, so
+// that every variant processes whole registers.
+const size_t kSvfBankPadding = 8;
+
+// A bank of SVFs fed by the same input, one array per variable. r_plus_g
+// holds r + g. The filters past size, up to the next multiple of
+// kSvfBankPadding, must be muted: zero coefficients, gain and state. The
+// arrays must not overlap.
+struct SvfBank {
+  size_t size;
+  const float* g;
+  const float* r_plus_g;
+  const float* h;
+  const float* gain;
+  float* state_1;
+  float* state_2;
+};
+
+struct Kernels {
+  // Name of the variant, and the CPU features it requires.
+  const char* name;
+  uint32_t cpu_features;
+  
+  // Sum of the outputs of the filters of the bank, weighted by their gains,
+  // written to out or added to out. in and out can be the same buffer.
+  void (*svf_bank[kNumSvfModes])(
+      const SvfBank& bank,
+      const float* in,
+      float* out,
+      size_t size);
+  void (*svf_bank_add[kNumSvfModes])(
+      const SvfBank& bank,
+      const float* in,
+      float* out,
+      size_t size);
+  
+  // Conversions between the storage formats of stmlib/dsp/sample_storage.h.
+  void (*float_to_int16)(const float* in, int16_t* out, size_t size);
+  void (*int16_to_float)(const int16_t* in, float* out, size_t size);
+  void (*float_to_half)(const float* in, Half* out, size_t size);
+  void (*half_to_float)(const Half* in, float* out, size_t size);
+  
+  // out[i] += gain * in[i].
+  void (*mix)(const float* in, float gain, float* out, size_t size);
+};
+
+// Compiled variants, from the most to the least demanding. The last one only
+// requires the baseline instruction set.
+size_t num_kernel_variants();
+const Kernels& kernel_variant(size_t index);
+
+// Selects a variant by name, or the best variant supported by the host when
+// name is NULL. Returns false, and keeps the current selection, when the
+// variant does not exist or is not supported by the host.
+bool SelectKernels(const char* name);
+
+const Kernels& ResolveKernels();
+
+extern std::atomic<const Kernels*> selected_kernels;
+
+inline const Kernels& kernels() {
+  const Kernels* k = selected_kernels.load(std::memory_order_acquire);
+  return k ? *k : ResolveKernels();
+}
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_KERNELS_H_
@@ -0,0 +1,246 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bodies of the block kernels of stmlib/dsp/kernels.h.
+//
+// This file is included by kernels.cc once per variant, between the pragmas
+// which select the instruction set of the variant, and with the following
+// macros defined:
+//
+// - STMLIB_KERNELS_NAMESPACE: namespace receiving the functions and the table.
+// - STMLIB_KERNELS_NAME: name of the variant.
+// - STMLIB_KERNELS_CPU_FEATURES: CPU features required by the variant.
+// - STMLIB_KERNELS_WIDTH: number of floats in a vector register.
+// - STMLIB_KERNELS_F16C: defined when the F16C instructions are available.
+//
+// The loops are written over chunks of STMLIB_KERNELS_WIDTH elements, so that
+// the compiler vectorizes them without having to work out an epilogue.
+//
+// No include guard, on purpose.
+
+namespace stmlib {
+
+namespace STMLIB_KERNELS_NAMESPACE {
+
+const size_t kWidth = STMLIB_KERNELS_WIDTH;
+
+template<FilterMode mode>
+inline float SvfOutput(float hp, float bp, float lp, float r) {
+  if constexpr (mode == FILTER_MODE_LOW_PASS) {
+    return lp;
+  } else if constexpr (mode == FILTER_MODE_BAND_PASS) {
+    return bp;
+  } else if constexpr (mode == FILTER_MODE_BAND_PASS_NORMALIZED) {
+    return bp * r;
+  } else {
+    return hp;
+  }
+}
+
+// The restrict qualifiers of the arguments tell the compiler that the state
+// arrays do not overlap the coefficients.
+template<FilterMode mode>
+inline float SvfBankSample(
+    size_t n,
+    float in,
+    const float* __restrict g,
+    const float* __restrict r_plus_g,
+    const float* __restrict h,
+    const float* __restrict gain,
+    float* __restrict state_1,
+    float* __restrict state_2) {
+  float sum[kWidth];
+  for (size_t k = 0; k < kWidth; ++k) {
+    sum[k] = 0.0f;
+  }
+  for (size_t i = 0; i < n; i += kWidth) {
+    for (size_t k = 0; k < kWidth; ++k) {
+      const size_t j = i + k;
+      const float hp = (in - r_plus_g[j] * state_1[j] - state_2[j]) * h[j];
+      const float bp = g[j] * hp + state_1[j];
+      state_1[j] = g[j] * hp + bp;
+      const float lp = g[j] * bp + state_2[j];
+      state_2[j] = g[j] * bp + lp;
+      sum[k] += gain[j] * SvfOutput<mode>(hp, bp, lp, r_plus_g[j] - g[j]);
+    }
+  }
+  // Pairwise reduction of the lanes.
+  for (size_t width = kWidth / 2; width; width /= 2) {
+    for (size_t k = 0; k < width; ++k) {
+      sum[k] += sum[k + width];
+    }
+  }
+  return sum[0];
+}
+
+template<FilterMode mode, bool add>
+void ProcessSvfBank(
+    const SvfBank& bank,
+    const float* in,
+    float* out,
+    size_t size) {
+  // The bank is padded with muted filters up to a whole number of registers.
+  const size_t n = (bank.size + kWidth - 1) / kWidth * kWidth;
+  while (size--) {
+    const float value = SvfBankSample<mode>(
+        n,
+        *in++,
+        bank.g,
+        bank.r_plus_g,
+        bank.h,
+        bank.gain,
+        bank.state_1,
+        bank.state_2);
+    if (add) {
+      *out++ += value;
+    } else {
+      *out++ = value;
+    }
+  }
+}
+
+template<FilterMode mode>
+void SvfBankWrite(
+    const SvfBank& bank,
+    const float* in,
+    float* out,
+    size_t size) {
+  ProcessSvfBank<mode, false>(bank, in, out, size);
+}
+
+template<FilterMode mode>
+void SvfBankAdd(
+    const SvfBank& bank,
+    const float* in,
+    float* out,
+    size_t size) {
+  ProcessSvfBank<mode, true>(bank, in, out, size);
+}
+
+inline int16_t FloatToInt16Sample(float x) {
+  return Clip16(static_cast<int32_t>(x * 32768.0f));
+}
+
+void FloatToInt16(const float* in, int16_t* out, size_t size) {
+  size_t i = 0;
+  for (; i + kWidth <= size; i += kWidth) {
+    for (size_t k = 0; k < kWidth; ++k) {
+      out[i + k] = FloatToInt16Sample(in[i + k]);
+    }
+  }
+  for (; i < size; ++i) {
+    out[i] = FloatToInt16Sample(in[i]);
+  }
+}
+
+void Int16ToFloat(const int16_t* in, float* out, size_t size) {
+  size_t i = 0;
+  for (; i + kWidth <= size; i += kWidth) {
+    for (size_t k = 0; k < kWidth; ++k) {
+      out[i + k] = static_cast<float>(in[i + k]) / 32768.0f;
+    }
+  }
+  for (; i < size; ++i) {
+    out[i] = static_cast<float>(in[i]) / 32768.0f;
+  }
+}
+
+void FloatToHalf(const float* in, Half* out, size_t size) {
+  size_t i = 0;
+#ifdef STMLIB_KERNELS_F16C
+  for (; i + 8 <= size; i += 8) {
+    const __m128i h = _mm256_cvtps_ph(
+        _mm256_loadu_ps(&in[i]), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), h);
+  }
+  for (; i < size; ++i) {
+    out[i].bits = _cvtss_sh(in[i], _MM_FROUND_TO_NEAREST_INT);
+  }
+#else
+  for (; i < size; ++i) {
+    out[i].bits = FloatToHalfBits(in[i]);
+  }
+#endif  // STMLIB_KERNELS_F16C
+}
+
+void HalfToFloat(const Half* in, float* out, size_t size) {
+  size_t i = 0;
+#ifdef STMLIB_KERNELS_F16C
+  for (; i + 8 <= size; i += 8) {
+    const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+    _mm256_storeu_ps(&out[i], _mm256_cvtph_ps(h));
+  }
+  for (; i < size; ++i) {
+    out[i] = _cvtsh_ss(in[i].bits);
+  }
+#else
+  for (; i < size; ++i) {
+    out[i] = HalfBitsToFloat(in[i].bits);
+  }
+#endif  // STMLIB_KERNELS_F16C
+}
+
+void Mix(const float* in, float gain, float* out, size_t size) {
+  size_t i = 0;
+  for (; i + kWidth <= size; i += kWidth) {
+    // Loading the chunk first tells the compiler that the stores do not feed
+    // the loads.
+    float x[kWidth];
+    for (size_t k = 0; k < kWidth; ++k) {
+      x[k] = in[i + k];
+    }
+    for (size_t k = 0; k < kWidth; ++k) {
+      out[i + k] += gain * x[k];
+    }
+  }
+  for (; i < size; ++i) {
+    out[i] += gain * in[i];
+  }
+}
+
+const Kernels table = {
+  STMLIB_KERNELS_NAME,
+  STMLIB_KERNELS_CPU_FEATURES,
+  {
+    &SvfBankWrite<FILTER_MODE_LOW_PASS>,
+    &SvfBankWrite<FILTER_MODE_BAND_PASS>,
+    &SvfBankWrite<FILTER_MODE_BAND_PASS_NORMALIZED>,
+    &SvfBankWrite<FILTER_MODE_HIGH_PASS>
+  },
+  {
+    &SvfBankAdd<FILTER_MODE_LOW_PASS>,
+    &SvfBankAdd<FILTER_MODE_BAND_PASS>,
+    &SvfBankAdd<FILTER_MODE_BAND_PASS_NORMALIZED>,
+    &SvfBankAdd<FILTER_MODE_HIGH_PASS>
+  },
+  &FloatToInt16,
+  &Int16ToFloat,
+  &FloatToHalf,
+  &HalfToFloat,
+  &Mix
+};
+
+}  // namespace STMLIB_KERNELS_NAMESPACE
+
+}  // namespace stmlib
@@ -0,0 +1,133 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Compile-time generators for the lookup tables shared by several modules.
+// They follow the python code that was used to generate them offline.
+
+#ifndef STMLIB_DSP_LOOKUP_TABLE_GENERATORS_H_
+#define STMLIB_DSP_LOOKUP_TABLE_GENERATORS_H_
+
+#include "stmlib/dsp/constexpr_math.h"
+
+namespace stmlib {
+
+namespace lookup_table_generators {
+
+using namespace constexpr_math;
+
+// Sine, with an extra quarter period for cosine lookups.
+template<size_t period>
+constexpr LookupTable<period + period / 4 + 1> Sine() {
+  return MakeLookupTable<period + period / 4 + 1>(
+      [](size_t i) { return Sin(2.0 * kPi * double(i) / double(period)); }
+  );
+}
+
+// Quantizer for FM frequencies.
+constexpr LookupTable<129> FmFrequencyQuantizer() {
+  double const cents_16 = Pow(2.0, 16.0 / 1200.0);
+  double const ratios[] = {
+    0.5, 0.5 * cents_16,
+    Sqrt(2.0) / 2, kPi / 4, 1.0, 1.0 * cents_16, Sqrt(2.0),
+    kPi / 2, 7.0 / 4, 2, 2 * cents_16, 9.0 / 4, 11.0 / 4,
+    2 * Sqrt(2.0), 3, kPi, Sqrt(3.0) * 2, 4, Sqrt(2.0) * 3,
+    kPi * 3 / 2, 5, Sqrt(2.0) * 4, 8
+  };
+  size_t const num_ratios = sizeof(ratios) / sizeof(ratios[0]);
+
+  double scale[129] = { };
+  size_t size = 0;
+  for (size_t i = 0; i < num_ratios; ++i) {
+    double const ratio = 12 * Log2(ratios[i]);
+    scale[size++] = ratio;
+    scale[size++] = ratio;
+    scale[size++] = ratio;
+  }
+
+  while (size < 128) {
+    size_t gap = 0;
+    for (size_t i = 1; i < size - 1; ++i) {
+      if (scale[i + 1] - scale[i] > scale[gap + 1] - scale[gap]) {
+        gap = i;
+      }
+    }
+    for (size_t i = size; i > gap + 1; --i) {
+      scale[i] = scale[i - 1];
+    }
+    scale[gap + 1] = (scale[gap] + scale[gap + 2]) / 2;
+    ++size;
+  }
+  scale[128] = scale[127];
+
+  return MakeLookupTable<129>(
+      [&scale](size_t i) { return scale[i]; }
+  );
+}
+
+// Stiffness (partial detuning) for modal and additive synthesis.
+template<size_t size>
+constexpr LookupTable<size + 1> Stiffness() {
+  return MakeLookupTable<size + 1>([](size_t i) {
+    double g = double(i) / double(size);
+    if (i >= size - 1) {
+      return 2.0;
+    } else if (g < 0.25) {
+      g = 0.25 - g;
+      return -g * 0.25;
+    } else if (g < 0.3) {
+      return 0.0;
+    } else if (g < 0.9) {
+      g -= 0.3;
+      g /= 0.6;
+      return 0.01 * Pow(10.0, g * 2.005) - 0.01;
+    } else {
+      g -= 0.9;
+      g /= 0.1;
+      g *= g;
+      return 1.5 - Cos(g * kPi) / 2.0;
+    }
+  });
+}
+
+// Semitones to frequency ratio, integral part (-128 to 128 semitones).
+template<size_t size>
+constexpr LookupTable<size> PitchRatioHigh() {
+  return MakeLookupTable<size>([](size_t i) {
+    return Pow(2.0, (double(i) - 128.0) / 12.0);
+  });
+}
+
+// Semitones to frequency ratio, fractional part (1/256th of semitone steps).
+template<size_t size>
+constexpr LookupTable<size> PitchRatioLow() {
+  return MakeLookupTable<size>([](size_t i) {
+    return Pow(2.0, double(i) / 256.0 / 12.0);
+  });
+}
+
+}  // namespace lookup_table_generators
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_LOOKUP_TABLE_GENERATORS_H_
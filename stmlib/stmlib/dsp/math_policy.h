@@ -0,0 +1,130 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Math policies.
+//
+// The clamps, square roots, exponentials and tangents of the DSP code go
+// through a policy class, so that each product can pick a point on the
+// accuracy/speed curve at compile time:
+//
+// - ExactMath: crack::audio::StdContext, with the IEEE-exact functions of the
+//   standard library.
+// - FastMath: clamps built from min/max, which compile to branchless
+//   instructions, and polynomial or rational approximations of sqrt (about
+//   5e-6 relative error), exp2 (1e-5, or 0.01 cent) and tan (1e-3 close to
+//   pi/2, much less in the audio range).
+//
+// Classes and functions take the policy as a template parameter defaulting to
+// DefaultMath, which is ExactMath unless the build defines STMLIB_FAST_MATH.
+
+#ifndef STMLIB_DSP_MATH_POLICY_H_
+#define STMLIB_DSP_MATH_POLICY_H_
+
+#include <inttypes.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include <crack/audio/AudioConversions.h>
+#include <crack/audio/MathContext.h>
+
+namespace stmlib {
+
+struct ExactMath : public crack::audio::StdContext {
+  static inline float exp2(float x) {
+    return std::exp2(x);
+  }
+  
+  static inline float tan(float x) {
+    return std::tan(x);
+  }
+  
+  static inline float note_to_frequency(float note, float a4) {
+    return crack::audio::conversions::midiToFrequency(note, a4);
+  }
+};
+
+struct FastMath {
+  template<typename T, typename A, typename B>
+  static inline T clamp(T value, A min, B max) {
+    return std::min(std::max(value, static_cast<T>(min)), static_cast<T>(max));
+  }
+  
+  template<typename T>
+  static inline T min(T a, T b) {
+    return std::min(a, b);
+  }
+  
+  template<typename T>
+  static inline T max(T a, T b) {
+    return std::max(a, b);
+  }
+  
+  // Square root, 0 for negative numbers. x * 1 / sqrt(x), with two Newton
+  // iterations on the classic initial guess of 1 / sqrt(x).
+  static inline float sqrt0(float x) {
+    x = std::max(x, 0.0f);
+    const uint32_t i = 0x5f3759df - (std::bit_cast<uint32_t>(x) >> 1);
+    float y = std::bit_cast<float>(i);
+    const float half_x = 0.5f * x;
+    y *= 1.5f - half_x * y * y;
+    y *= 1.5f - half_x * y * y;
+    return x * y;
+  }
+  
+  // The integral part goes into the exponent, the fractional part through a
+  // 4th order polynomial fitted on [0, 1).
+  static inline float exp2(float x) {
+    x = clamp(x, -126.0f, 127.0f);
+    int32_t integral = static_cast<int32_t>(x);
+    integral -= static_cast<int32_t>(x < static_cast<float>(integral));
+    const float f = x - static_cast<float>(integral);
+    const float p = 1.0f + f * (6.93133993e-01f + f * (2.40647048e-01f + \
+        f * (5.34410293e-02f + f * 1.27631139e-02f)));
+    const uint32_t exponent = static_cast<uint32_t>(integral + 127) << 23;
+    return p * std::bit_cast<float>(exponent);
+  }
+  
+  // Pade approximant, for 0 <= x < pi / 2.
+  static inline float tan(float x) {
+    const float x2 = x * x;
+    return x * (945.0f - x2 * (105.0f - x2)) / \
+        (945.0f - x2 * (420.0f - 15.0f * x2));
+  }
+  
+  static inline float note_to_frequency(float note, float a4) {
+    return a4 * exp2((note - 69.0f) * (1.0f / 12.0f));
+  }
+};
+
+#ifdef STMLIB_FAST_MATH
+typedef FastMath DefaultMath;
+#else
+typedef ExactMath DefaultMath;
+#endif  // STMLIB_FAST_MATH
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_MATH_POLICY_H_
@@ -0,0 +1,165 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Storage formats for delay lines.
+//
+// A delay line can keep its samples in a narrower format than the one it
+// computes with, to save memory and memory bandwidth. SampleStorage<S>
+// converts between the storage format S and float:
+//
+// - float: no conversion.
+// - Half: IEEE 754 binary16. 11 bits of precision, range +/- 65504.
+// - BFloat16: the 16 upper bits of a float. 8 bits of precision, full range.
+// - int16_t: the fixed point format of FORMAT_16_BIT in the FxEngine, clipped
+//   to [-1, 1).
+//
+// The fp16 conversions use the F16C instructions on x86 or the half precision
+// type of ARM compilers when available, and bit manipulations otherwise.
+
+#ifndef STMLIB_DSP_SAMPLE_STORAGE_H_
+#define STMLIB_DSP_SAMPLE_STORAGE_H_
+
+#include "stmlib/stmlib.h"
+#include "stmlib/dsp/dsp.h"
+
+#include <bit>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace stmlib {
+
+struct Half {
+  uint16_t bits;
+};
+
+struct BFloat16 {
+  uint16_t bits;
+};
+
+inline uint16_t FloatToHalfBits(float value) {
+#if defined(__F16C__)
+  return _cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT);
+#elif defined(__ARM_FP16_FORMAT_IEEE)
+  __fp16 h = value;
+  return std::bit_cast<uint16_t>(h);
+#else
+  uint32_t x = std::bit_cast<uint32_t>(value);
+  uint32_t sign = (x >> 16) & 0x8000;
+  x &= 0x7fffffff;
+  if (x >= 0x47800000) {
+    // Overflow to infinity, or NaN.
+    return sign | (x > 0x7f800000 ? 0x7e00 : 0x7c00);
+  } else if (x < 0x38800000) {
+    // Subnormal half. Adding 0.5f aligns the mantissa so that its low bits
+    // are the value in units of 2^-24, rounded by the FPU.
+    float aligned = std::bit_cast<float>(x) + 0.5f;
+    return sign | (std::bit_cast<uint32_t>(aligned) - 0x3f000000);
+  } else {
+    // Rebias the exponent and round the mantissa to nearest even.
+    x += 0xc8000fff + ((x >> 13) & 1);
+    return sign | (x >> 13);
+  }
+#endif  // __F16C__
+}
+
+inline float HalfBitsToFloat(uint16_t bits) {
+#if defined(__F16C__)
+  return _cvtsh_ss(bits);
+#elif defined(__ARM_FP16_FORMAT_IEEE)
+  return std::bit_cast<__fp16>(bits);
+#else
+  uint32_t x = static_cast<uint32_t>(bits & 0x7fff) << 13;
+  uint32_t exponent = x & 0x0f800000;
+  x += (127 - 15) << 23;
+  if (exponent == 0x0f800000) {
+    // Infinity or NaN.
+    x += (128 - 16) << 23;
+  } else if (exponent == 0) {
+    // Subnormal half: renormalize.
+    x += 1 << 23;
+    x = std::bit_cast<uint32_t>(
+        std::bit_cast<float>(x) - std::bit_cast<float>(uint32_t(113 << 23)));
+  }
+  return std::bit_cast<float>(x | (static_cast<uint32_t>(bits & 0x8000) << 16));
+#endif  // __F16C__
+}
+
+template<typename S>
+struct SampleStorage {
+  static inline S Load(S value) {
+    return value;
+  }
+  
+  static inline S Store(S value) {
+    return value;
+  }
+};
+
+template<>
+struct SampleStorage<Half> {
+  static inline float Load(Half value) {
+    return HalfBitsToFloat(value.bits);
+  }
+  
+  static inline Half Store(float value) {
+    Half h = { FloatToHalfBits(value) };
+    return h;
+  }
+};
+
+template<>
+struct SampleStorage<BFloat16> {
+  static inline float Load(BFloat16 value) {
+    return std::bit_cast<float>(static_cast<uint32_t>(value.bits) << 16);
+  }
+  
+  static inline BFloat16 Store(float value) {
+    uint32_t x = std::bit_cast<uint32_t>(value);
+    if ((x & 0x7fffffff) > 0x7f800000) {
+      // Keep NaNs quiet, rounding could turn them into infinities.
+      BFloat16 nan = { static_cast<uint16_t>((x >> 16) | 0x40) };
+      return nan;
+    }
+    x += 0x7fff + ((x >> 16) & 1);
+    BFloat16 b = { static_cast<uint16_t>(x >> 16) };
+    return b;
+  }
+};
+
+template<>
+struct SampleStorage<int16_t> {
+  static inline float Load(int16_t value) {
+    return static_cast<float>(value) / 32768.0f;
+  }
+  
+  static inline int16_t Store(float value) {
+    return Clip16(static_cast<int32_t>(value * 32768.0f));
+  }
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_DSP_SAMPLE_STORAGE_H_
@@ -29,6 +29,8 @@
 #ifndef STMLIB_DSP_UNITS_H_
 #define STMLIB_DSP_UNITS_H_
 
+#include <bit>
+
 #include "stmlib/stmlib.h"
 #include "stmlib/dsp/dsp.h"
 
@@ -45,6 +47,28 @@ inline float SemitonesToRatio(float semitones) {
       lut_pitch_ratio_low[static_cast<int32_t>(pitch_fractional * 256.0f)];
 }
 
+// Same as SemitonesToRatio() without table lookups, for loops which need to
+// be vectorized. The fractional octave is centered on 0 and 2^x is evaluated
+// with its Taylor series up to x^6 (relative error < 1e-6).
+inline float SemitonesToRatioPolynomial(float semitones) {
+  float octaves = semitones * (1.0f / 12.0f);
+  octaves = octaves < -126.0f ? -126.0f : octaves;
+  octaves = octaves > 126.0f ? 126.0f : octaves;
+  float integral = static_cast<float>(static_cast<int32_t>(octaves));
+  integral = integral > octaves ? integral - 1.0f : integral;
+  const float x = (octaves - integral - 0.5f) * 0.69314718056f;
+  float y = 1.0f / 720.0f;
+  y = y * x + 1.0f / 120.0f;
+  y = y * x + 1.0f / 24.0f;
+  y = y * x + 1.0f / 6.0f;
+  y = y * x + 0.5f;
+  y = y * x + 1.0f;
+  y = y * x + 1.0f;
+  const float scale = std::bit_cast<float>(
+      static_cast<uint32_t>(static_cast<int32_t>(integral) + 127) << 23);
+  return y * scale * 1.41421356237f;
+}
+
 inline float SemitonesToRatioSafe(float semitones) {
   float scale = 1.0f;
   while (semitones > 120.0f) {
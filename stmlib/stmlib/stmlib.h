@@ -28,7 +28,7 @@
 #include <inttypes.h>
 #include <stddef.h>
 
-#include <crack/audio/MathContext.h>
+#include "stmlib/dsp/math_policy.h"
 
 #ifndef NULL
 #define NULL 0
@@ -40,7 +40,7 @@
 
 #define CLIP(x) if (x < -32767) x = -32767; if (x > 32767) x = 32767;
 
-#define CONSTRAIN(var, min, max) var = crack::audio::StdContext::clamp(var, min, max)
+#define CONSTRAIN(var, min, max) var = stmlib::DefaultMath::clamp(var, min, max)
 
 #define JOIN(lhs, rhs)    JOIN_1(lhs, rhs)
 #define JOIN_1(lhs, rhs)  JOIN_2(lhs, rhs)
@@ -83,6 +83,12 @@ inline void StaticAssertImplementation() {
  
 namespace stmlib {
 
+// Used to keep data written by different threads on different cache lines.
+const size_t kCacheLineSize = 64;
+
+// Alignment of buffers processed with aligned vector loads and stores.
+const size_t kVectorAlignment = 32;
+
 typedef union {
   uint16_t value;
   uint8_t bytes[2];
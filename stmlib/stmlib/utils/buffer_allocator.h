@@ -24,7 +24,14 @@
 //
 // -----------------------------------------------------------------------------
 //
-// Stream buffer for serialization.
+// Bump allocator carving buffers out of a block of RAM.
+//
+// Allocations are aligned on alignof(T), or on a larger alignment when one is
+// given (kCacheLineSize, kVectorAlignment). The allocator records the largest
+// amount of memory it has ever handed out and the number of allocations which
+// did not fit; both are only cleared by Init(), so they can be checked once
+// everything has been allocated. A Frame releases everything allocated while
+// it is in scope.
 
 #ifndef STMLIB_UTILS_BUFFER_ALLOCATOR_H_
 #define STMLIB_UTILS_BUFFER_ALLOCATOR_H_
@@ -42,9 +49,35 @@ class BufferAllocator {
     Init(buffer, size);
   }
   
+  // Saves the state of the allocator, and restores it when going out of
+  // scope. Frames must be closed in the reverse order they were opened.
+  class Frame {
+   public:
+    explicit Frame(BufferAllocator* allocator)
+        : allocator_(allocator),
+          next_(allocator->next_),
+          free_(allocator->free_) { }
+    ~Frame() {
+      allocator_->next_ = next_;
+      allocator_->free_ = free_;
+    }
+    
+    // Bytes allocated since the frame was opened, padding included.
+    inline size_t used() const { return free_ - allocator_->free_; }
+    
+   private:
+    BufferAllocator* allocator_;
+    uint8_t* next_;
+    size_t free_;
+    
+    DISALLOW_COPY_AND_ASSIGN(Frame);
+  };
+  
   inline void Init(void* buffer, size_t size) {
     buffer_ = static_cast<uint8_t*>(buffer);
     size_ = size;
+    high_water_mark_ = 0;
+    num_failures_ = 0;
     Free();
   }
 
@@ -55,13 +88,24 @@ class BufferAllocator {
   
   template<typename T>
   inline T* Allocate(size_t size) {
+    return Allocate<T>(size, alignof(T));
+  }
+  
+  // alignment must be a power of 2, and at least alignof(T).
+  template<typename T>
+  inline T* Allocate(size_t size, size_t alignment) {
+    size_t padding = this->padding(alignment);
     size_t size_bytes = sizeof(T) * size;
-    if (size_bytes <= free_) {
-      T* start = static_cast<T*>(static_cast<void*>(next_));
-      next_ += size_bytes;
-      free_ -= size_bytes;
+    if (padding <= free_ && size_bytes <= free_ - padding) {
+      T* start = static_cast<T*>(static_cast<void*>(next_ + padding));
+      next_ += padding + size_bytes;
+      free_ -= padding + size_bytes;
+      if (used() > high_water_mark_) {
+        high_water_mark_ = used();
+      }
       return start;
     } else {
+      ++num_failures_;
       return NULL;
     }
   }
@@ -72,16 +116,35 @@ class BufferAllocator {
   }
   
   inline size_t free() const { return free_; }
+  
+  // Bytes left for an allocation aligned on alignment.
+  inline size_t free(size_t alignment) const {
+    size_t padding = this->padding(alignment);
+    return padding <= free_ ? free_ - padding : 0;
+  }
+  
+  inline size_t used() const { return size_ - free_; }
+  inline size_t high_water_mark() const { return high_water_mark_; }
+  inline size_t num_failures() const { return num_failures_; }
+  inline size_t size() const { return size_; }
+  inline void* buffer() const { return buffer_; }
 
  private:
+  inline size_t padding(size_t alignment) const {
+    size_t misalignment = reinterpret_cast<uintptr_t>(next_) & (alignment - 1);
+    return misalignment ? alignment - misalignment : 0;
+  }
+  
   uint8_t* next_;
   uint8_t* buffer_;
   size_t free_;
   size_t size_;
+  size_t high_water_mark_;
+  size_t num_failures_;
 
   DISALLOW_COPY_AND_ASSIGN(BufferAllocator);
 };
 
 }  // namespace stmlib
 
-#endif   // STMLIB_UTILS_STREAM_BUFFER_H_
+#endif   // STMLIB_UTILS_BUFFER_ALLOCATOR_H_
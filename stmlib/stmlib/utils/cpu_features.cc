@@ -0,0 +1,106 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Detection of the instruction set extensions of the host CPU.
+
+#include "stmlib/utils/cpu_features.h"
+
+#include <cstring>
+
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#endif
+
+namespace stmlib {
+
+namespace {
+
+const char* const feature_names[CPU_FEATURE_LAST] = {
+  "sse2",
+  "sse4.1",
+  "avx",
+  "avx2",
+  "fma",
+  "f16c",
+  "avx512f",
+  "avx512vl",
+  "neon",
+  "neon-fp16"
+};
+
+uint32_t DetectCpuFeatures() {
+  uint32_t features = 0;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  // GCC and clang also check that the OS saves the AVX registers.
+  __builtin_cpu_init();
+  features |= __builtin_cpu_supports("sse2") ? CPU_FEATURE_SSE2 : 0;
+  features |= __builtin_cpu_supports("sse4.1") ? CPU_FEATURE_SSE4_1 : 0;
+  features |= __builtin_cpu_supports("avx") ? CPU_FEATURE_AVX : 0;
+  features |= __builtin_cpu_supports("avx2") ? CPU_FEATURE_AVX2 : 0;
+  features |= __builtin_cpu_supports("fma") ? CPU_FEATURE_FMA : 0;
+  features |= __builtin_cpu_supports("f16c") ? CPU_FEATURE_F16C : 0;
+  features |= __builtin_cpu_supports("avx512f") ? CPU_FEATURE_AVX512F : 0;
+  features |= __builtin_cpu_supports("avx512vl") ? CPU_FEATURE_AVX512VL : 0;
+#elif defined(__aarch64__)
+  // NEON is part of the base ARMv8-A instruction set.
+  features |= CPU_FEATURE_NEON;
+#if defined(__linux__) && defined(HWCAP_ASIMDHP)
+  features |= (getauxval(AT_HWCAP) & HWCAP_ASIMDHP) ? CPU_FEATURE_NEON_FP16 : 0;
+#endif  // __linux__
+#elif defined(__ARM_NEON)
+  features |= CPU_FEATURE_NEON;
+#endif
+  return features;
+}
+
+}  // namespace
+
+uint32_t cpu_features() {
+  static const uint32_t features = DetectCpuFeatures();
+  return features;
+}
+
+void FormatCpuFeatures(uint32_t features, char* buffer, size_t size) {
+  if (!size) {
+    return;
+  }
+  buffer[0] = '\0';
+  size_t length = 0;
+  for (int i = 0; i < CPU_FEATURE_LAST; ++i) {
+    if (!(features & (1 << i))) {
+      continue;
+    }
+    size_t name_length = strlen(feature_names[i]);
+    if (length + (length ? 1 : 0) + name_length + 1 > size) {
+      break;
+    }
+    if (length) {
+      buffer[length++] = ' ';
+    }
+    memcpy(&buffer[length], feature_names[i], name_length + 1);
+    length += name_length;
+  }
+}
+
+}  // namespace stmlib
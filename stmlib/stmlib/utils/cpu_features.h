@@ -1,6 +1,4 @@
-// Copyright 2015 Emilie Gillet.
-//
-// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+// Copyright 2026 Intrets.
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -8,10 +6,10 @@
 // to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
 // copies of the Software, and to permit persons to whom the Software is
 // furnished to do so, subject to the following conditions:
-// 
+//
 // The above copyright notice and this permission notice shall be included in
 // all copies or substantial portions of the Software.
-// 
+//
 // THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
 // IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
 // FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -19,57 +17,50 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
-// 
+//
 // See http://creativecommons.org/licenses/MIT/ for more information.
 //
 // -----------------------------------------------------------------------------
 //
-// Voice for the string synth easter egg.
+// Detection of the instruction set extensions of the host CPU.
+//
+// The features are probed once, on the first call to cpu_features(), and
+// include the support of the extended registers by the operating system.
+// They are used to pick among the variants of the block kernels compiled for
+// several instruction sets, see stmlib/dsp/kernels.h.
 
-#ifndef RINGS_DSP_STRING_SYNTH_VOICE_H_
-#define RINGS_DSP_STRING_SYNTH_VOICE_H_
+#ifndef STMLIB_UTILS_CPU_FEATURES_H_
+#define STMLIB_UTILS_CPU_FEATURES_H_
 
 #include "stmlib/stmlib.h"
 
-#include "rings/dsp/string_synth_oscillator.h"
+namespace stmlib {
+
+enum CpuFeature {
+  CPU_FEATURE_SSE2 = 1 << 0,
+  CPU_FEATURE_SSE4_1 = 1 << 1,
+  CPU_FEATURE_AVX = 1 << 2,
+  CPU_FEATURE_AVX2 = 1 << 3,
+  CPU_FEATURE_FMA = 1 << 4,
+  CPU_FEATURE_F16C = 1 << 5,
+  CPU_FEATURE_AVX512F = 1 << 6,
+  CPU_FEATURE_AVX512VL = 1 << 7,
+  CPU_FEATURE_NEON = 1 << 8,
+  CPU_FEATURE_NEON_FP16 = 1 << 9,
+  CPU_FEATURE_LAST = 10
+};
 
-namespace rings {
+// Bitmask of CpuFeature.
+uint32_t cpu_features();
 
-template<size_t num_harmonics>
-class StringSynthVoice {
- public:
-  StringSynthVoice() { }
-  ~StringSynthVoice() { }
-  
-  void Init() {
-    for (size_t i = 0; i < num_harmonics; ++i) {
-      oscillator_[i].Init();
-    }
-  }
-  
-  void Render(
-      float frequency,
-      const float* amplitudes,
-      size_t summed_harmonics,
-      float* out,
-      size_t size) {
-    oscillator_[0].template Render<OSCILLATOR_SHAPE_DARK_SQUARE, true>(
-        frequency, amplitudes[0], amplitudes[1], out, size);
-    amplitudes += 2;
-    
-    for (size_t i = 1; i < summed_harmonics; ++i) {
-      frequency *= 2.0f;
-      oscillator_[i].template Render<OSCILLATOR_SHAPE_BRIGHT_SQUARE, false>(
-          frequency, amplitudes[0], amplitudes[1], out, size);
-      amplitudes += 2;
-    }
-  }
+inline bool HasCpuFeatures(uint32_t features) {
+  return (cpu_features() & features) == features;
+}
 
- private:
-  StringSynthOscillator oscillator_[num_harmonics];
-  DISALLOW_COPY_AND_ASSIGN(StringSynthVoice);
-};
+// Space separated list of the features in the mask, for logs and benchmark
+// reports. Writes at most size bytes, including the terminating zero.
+void FormatCpuFeatures(uint32_t features, char* buffer, size_t size);
 
-}  // namespace rings
+}  // namespace stmlib
 
-#endif  // RINGS_DSP_STRING_SYNTH_VOICE_H_
+#endif  // STMLIB_UTILS_CPU_FEATURES_H_
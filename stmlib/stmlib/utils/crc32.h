@@ -40,7 +40,13 @@
  * CRC32 code derived from work by Gary S. Brown.
  */
 
-static uint32_t crc32_tab[] = {
+#ifndef STMLIB_UTILS_CRC32_H_
+#define STMLIB_UTILS_CRC32_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+static const uint32_t crc32_tab[] = {
 	0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
 	0xe963a535, 0x9e6495a3,	0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
 	0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
@@ -86,7 +92,7 @@ static uint32_t crc32_tab[] = {
 	0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 };
 
-uint32_t crc32(uint32_t crc, const void *buf, size_t size) {
+static inline uint32_t crc32(uint32_t crc, const void *buf, size_t size) {
 	const uint8_t *p;
 
 	p = static_cast<const uint8_t*>(buf);
@@ -97,3 +103,5 @@ uint32_t crc32(uint32_t crc, const void *buf, size_t size) {
 
 	return crc ^ ~0U;
 }
+
+#endif  // STMLIB_UTILS_CRC32_H_
@@ -0,0 +1,344 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Instrumentation of the audio rendering code.
+
+#include "stmlib/utils/profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "stmlib/utils/spsc_queue.h"
+
+namespace stmlib {
+
+using namespace std;
+
+namespace {
+
+// Durations below 8 ticks have their own bin, the others are binned by 1/8th
+// of octave, up to 2^32 ticks.
+const size_t kNumHistogramBins = 30 * 8;
+
+// A queue is claimed by the first event of a thread, and released when the
+// thread exits. The collector empties a released queue before it can be
+// claimed again.
+enum ProfileThreadState {
+  PROFILE_THREAD_FREE,
+  PROFILE_THREAD_CLAIMED,
+  PROFILE_THREAD_ACTIVE,
+  PROFILE_THREAD_RELEASED
+};
+
+struct ProfileThread {
+  SpscQueue<ProfileEvent, kProfileQueueSize> queue;
+  atomic<uint8_t> state;
+};
+
+struct StageHistogram {
+  uint64_t count;
+  uint64_t sum;
+  uint32_t max;
+  uint64_t max_start;
+  uint64_t bins[kNumHistogramBins];
+};
+
+// Writer side.
+ProfileThread threads[kMaxProfileThreads];
+atomic<uint64_t> dropped_events(0);
+thread_local int32_t thread_index = -1;
+
+// Kept apart from thread_index, so that recording an event does not go
+// through the initialization check of a thread_local with a destructor.
+struct ProfileThreadRelease {
+  ~ProfileThreadRelease() {
+    if (thread_index >= 0) {
+      threads[thread_index].state.store(
+          PROFILE_THREAD_RELEASED, memory_order_release);
+    }
+  }
+};
+
+thread_local ProfileThreadRelease thread_release;
+
+// Stage registry.
+mutex stages_mutex;
+const char* stage_names[kMaxProfileStages];
+atomic<size_t> num_stages(0);
+uint64_t origin_ticks;
+chrono::steady_clock::time_point origin_time;
+
+// Collector side.
+StageHistogram histograms[kMaxProfileStages];
+vector<ProfileEvent> trace;
+size_t trace_size = 65536;
+uint64_t trace_count = 0;
+
+// Returns -1 when all the queues are in use.
+int32_t ClaimThread() {
+  for (size_t i = 0; i < kMaxProfileThreads; ++i) {
+    uint8_t expected = PROFILE_THREAD_FREE;
+    if (threads[i].state.compare_exchange_strong(
+            expected, PROFILE_THREAD_CLAIMED, memory_order_acquire)) {
+      threads[i].queue.Init();
+      threads[i].state.store(PROFILE_THREAD_ACTIVE, memory_order_release);
+      // Constructs the guard which releases the queue at thread exit.
+      static_cast<void>(&thread_release);
+      return i;
+    }
+  }
+  return -1;
+}
+
+inline size_t HistogramBin(uint32_t duration) {
+  if (duration < 8) {
+    return duration;
+  }
+  int32_t octave = 31 - __builtin_clz(duration);
+  return (octave - 2) * 8 + ((duration >> (octave - 3)) & 7);
+}
+
+inline uint32_t HistogramBinUpperBound(size_t bin) {
+  if (bin < 8) {
+    return bin;
+  }
+  int32_t shift = bin / 8 - 1;
+  uint64_t upper = ((9 + bin % 8) << shift) - 1;
+  return min(upper, static_cast<uint64_t>(0xffffffff));
+}
+
+double ticks_per_us() {
+#if defined(__x86_64__) || defined(__i386__)
+  // The TSC runs at a constant rate on all the CPUs this code runs on, which
+  // is measured against the steady clock since the first stage registration.
+  chrono::steady_clock::time_point now = chrono::steady_clock::now();
+  if (now - origin_time < chrono::milliseconds(10)) {
+    this_thread::sleep_for(chrono::milliseconds(10));
+  }
+  uint64_t ticks = ReadProfileTimestamp();
+  now = chrono::steady_clock::now();
+  double us = chrono::duration<double, micro>(now - origin_time).count();
+  return static_cast<double>(ticks - origin_ticks) / us;
+#elif defined(__aarch64__)
+  uint64_t frequency;
+  __asm__ volatile("mrs %0, cntfrq_el0" : "=r" (frequency));
+  return static_cast<double>(frequency) * 1e-6;
+#else
+  return 1000.0;
+#endif
+}
+
+void CollectEvent(const ProfileEvent& e) {
+  if (e.stage >= num_stages.load(memory_order_acquire)) {
+    return;
+  }
+  StageHistogram& h = histograms[e.stage];
+  ++h.count;
+  h.sum += e.duration;
+  if (e.duration >= h.max) {
+    h.max = e.duration;
+    h.max_start = e.start;
+  }
+  ++h.bins[HistogramBin(e.duration)];
+  
+  if (trace_size) {
+    if (trace.size() != trace_size) {
+      trace.resize(trace_size);
+    }
+    trace[trace_count % trace_size] = e;
+    ++trace_count;
+  }
+}
+
+void WriteJsonString(FILE* fp, const char* s) {
+  fputc('"', fp);
+  for (; *s; ++s) {
+    if (*s == '"' || *s == '\\') {
+      fputc('\\', fp);
+    }
+    fputc(*s, fp);
+  }
+  fputc('"', fp);
+}
+
+}  // namespace
+
+ProfileStage RegisterProfileStage(const char* name) {
+  lock_guard<mutex> lock(stages_mutex);
+  size_t n = num_stages.load(memory_order_relaxed);
+  if (n == 0) {
+    origin_ticks = ReadProfileTimestamp();
+    origin_time = chrono::steady_clock::now();
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!strcmp(stage_names[i], name)) {
+      return i;
+    }
+  }
+  if (n == kMaxProfileStages) {
+    return kMaxProfileStages;
+  }
+  stage_names[n] = name;
+  num_stages.store(n + 1, memory_order_release);
+  return n;
+}
+
+void RecordProfileEvent(ProfileStage stage, uint64_t start, uint64_t end) {
+  if (thread_index < 0) {
+    thread_index = ClaimThread();
+    if (thread_index < 0) {
+      dropped_events.fetch_add(1, memory_order_relaxed);
+      return;
+    }
+  }
+  ProfileEvent e;
+  e.start = start;
+  e.duration = static_cast<uint32_t>(min(end - start,
+      static_cast<uint64_t>(0xffffffff)));
+  e.stage = stage;
+  e.thread = thread_index;
+  if (!threads[thread_index].queue.TryWrite(e)) {
+    dropped_events.fetch_add(1, memory_order_relaxed);
+  }
+}
+
+void CollectProfileEvents() {
+  for (size_t i = 0; i < kMaxProfileThreads; ++i) {
+    uint8_t state = threads[i].state.load(memory_order_acquire);
+    if (state != PROFILE_THREAD_ACTIVE && state != PROFILE_THREAD_RELEASED) {
+      continue;
+    }
+    ProfileEvent events[256];
+    size_t read;
+    while ((read = threads[i].queue.TryRead(events, 256)) != 0) {
+      for (size_t j = 0; j < read; ++j) {
+        CollectEvent(events[j]);
+      }
+    }
+    if (state == PROFILE_THREAD_RELEASED) {
+      threads[i].state.store(PROFILE_THREAD_FREE, memory_order_release);
+    }
+  }
+}
+
+void ResetProfile() {
+  CollectProfileEvents();
+  memset(histograms, 0, sizeof(histograms));
+  trace_count = 0;
+  dropped_events.store(0, memory_order_relaxed);
+}
+
+void set_profile_trace_size(size_t size) {
+  trace_size = size;
+  trace.clear();
+  trace_count = 0;
+}
+
+uint64_t profile_dropped_events() {
+  return dropped_events.load(memory_order_relaxed);
+}
+
+size_t GetProfileStats(ProfileStats* stats, size_t max_stats) {
+  size_t n = num_stages.load(memory_order_acquire);
+  double us_per_tick = 1.0 / ticks_per_us();
+  size_t num_stats = 0;
+  for (size_t i = 0; i < n && num_stats < max_stats; ++i) {
+    const StageHistogram& h = histograms[i];
+    if (!h.count) {
+      continue;
+    }
+    ProfileStats& s = stats[num_stats++];
+    s.name = stage_names[i];
+    s.count = h.count;
+    s.mean = static_cast<double>(h.sum) / h.count * us_per_tick;
+    
+    uint64_t p50_count = (h.count + 1) / 2;
+    uint64_t p99_count = h.count - h.count / 100;
+    uint64_t cumulated = 0;
+    s.p50 = s.p99 = 0.0;
+    for (size_t bin = 0; bin < kNumHistogramBins; ++bin) {
+      uint64_t previous = cumulated;
+      cumulated += h.bins[bin];
+      double upper_bound = min(HistogramBinUpperBound(bin), h.max);
+      if (previous < p50_count && cumulated >= p50_count) {
+        s.p50 = upper_bound * us_per_tick;
+      }
+      if (previous < p99_count && cumulated >= p99_count) {
+        s.p99 = upper_bound * us_per_tick;
+        break;
+      }
+    }
+    s.max = h.max * us_per_tick;
+    s.max_time = static_cast<int64_t>(h.max_start - origin_ticks) * \
+        us_per_tick;
+  }
+  return num_stats;
+}
+
+void WriteProfileReport(FILE* fp) {
+  CollectProfileEvents();
+  ProfileStats stats[kMaxProfileStages];
+  size_t n = GetProfileStats(stats, kMaxProfileStages);
+  fprintf(fp, "%-32s %10s %10s %10s %10s %10s %12s\n",
+      "stage", "count", "mean us", "p50 us", "p99 us", "max us", "max at us");
+  for (size_t i = 0; i < n; ++i) {
+    const ProfileStats& s = stats[i];
+    fprintf(fp, "%-32s %10llu %10.3f %10.3f %10.3f %10.3f %12.1f\n",
+        s.name, static_cast<unsigned long long>(s.count),
+        s.mean, s.p50, s.p99, s.max, s.max_time);
+  }
+  uint64_t dropped = profile_dropped_events();
+  if (dropped) {
+    fprintf(fp, "%llu events dropped\n",
+        static_cast<unsigned long long>(dropped));
+  }
+}
+
+bool WriteChromeTrace(FILE* fp) {
+  CollectProfileEvents();
+  double us_per_tick = 1.0 / ticks_per_us();
+  uint64_t count = min(trace_count, static_cast<uint64_t>(trace_size));
+  
+  fprintf(fp, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+  for (uint64_t i = trace_count - count; i < trace_count; ++i) {
+    const ProfileEvent& e = trace[i % trace_size];
+    fprintf(fp, "{\"name\":");
+    WriteJsonString(fp, stage_names[e.stage]);
+    fprintf(fp,
+        ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+        e.thread,
+        static_cast<int64_t>(e.start - origin_ticks) * us_per_tick,
+        e.duration * us_per_tick,
+        i + 1 == trace_count ? "" : ",");
+  }
+  fprintf(fp, "]}\n");
+  return !ferror(fp);
+}
+
+}  // namespace stmlib
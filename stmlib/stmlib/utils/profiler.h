@@ -0,0 +1,168 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Instrumentation of the audio rendering code.
+//
+// Building with STMLIB_PROFILE turns the STMLIB_PROFILE_SCOPE() macros into
+// scoped timers; without it they expand to nothing. A timer reads the cycle
+// counter (rdtsc, or cntvct_el0 on ARM) when it is created and destroyed, and
+// pushes the event into a wait-free single producer, single consumer queue
+// owned by the calling thread. Events are dropped when the queue is full.
+//
+// A non real-time thread calls CollectProfileEvents() periodically to empty
+// the queues. Collected events are accumulated into per-stage histograms of
+// durations (WriteProfileReport() prints the count, p50, p99 and maximum of
+// each stage) and the most recent ones are kept for WriteChromeTrace(), whose
+// output can be opened in chrome://tracing or Perfetto.
+
+#ifndef STMLIB_UTILS_PROFILER_H_
+#define STMLIB_UTILS_PROFILER_H_
+
+#include "stmlib/stmlib.h"
+
+#include <cstdio>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <chrono>
+#endif
+
+namespace stmlib {
+
+typedef uint16_t ProfileStage;
+
+struct ProfileEvent {
+  uint64_t start;
+  uint32_t duration;
+  ProfileStage stage;
+  uint16_t thread;
+};
+
+struct ProfileStats {
+  const char* name;
+  uint64_t count;
+  // In microseconds. The percentiles are read from a histogram with 1/8
+  // octave bins, so they are rounded up by at most 9%.
+  double mean;
+  double p50;
+  double p99;
+  double max;
+  // Start of the slowest event, in microseconds on the time base of the
+  // Chrome trace.
+  double max_time;
+};
+
+const size_t kMaxProfileStages = 128;
+const size_t kMaxProfileThreads = 16;
+const size_t kProfileQueueSize = 8192;
+
+inline uint64_t ReadProfileTimestamp() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t value;
+  __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r" (value));
+  return value;
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Returns the id of the stage with this name, registering it on the first
+// call. Takes a lock: the macros call it once per call site.
+ProfileStage RegisterProfileStage(const char* name);
+
+// Wait-free. The first call from a thread claims a queue for it, which is
+// released when the thread exits and reused by the next thread once it has
+// been emptied. The events of a thread which finds no free queue, when more
+// than kMaxProfileThreads threads are recording, are dropped. Threads which
+// use the same queue one after the other share its id in the Chrome trace.
+void RecordProfileEvent(ProfileStage stage, uint64_t start, uint64_t end);
+
+// Collector side. These functions must be called from a single thread, which
+// should not be a real-time thread.
+void CollectProfileEvents();
+void ResetProfile();
+
+// Sets the number of recent events kept for the trace (default: 65536).
+void set_profile_trace_size(size_t size);
+
+// Number of events lost because a queue was full or too many threads
+// recorded events.
+uint64_t profile_dropped_events();
+
+// Fills stats with the statistics of the stages which have recorded events,
+// and returns their number.
+size_t GetProfileStats(ProfileStats* stats, size_t max_stats);
+
+// Collects the pending events and writes one line of statistics per stage.
+void WriteProfileReport(FILE* fp);
+
+// Collects the pending events and writes the recent events in the Chrome
+// trace event format. Returns false on write errors.
+bool WriteChromeTrace(FILE* fp);
+
+class ProfileScope {
+ public:
+  explicit ProfileScope(ProfileStage stage) : stage_(stage) {
+    start_ = ReadProfileTimestamp();
+  }
+  
+  ~ProfileScope() {
+    RecordProfileEvent(stage_, start_, ReadProfileTimestamp());
+  }
+  
+ private:
+  ProfileStage stage_;
+  uint64_t start_;
+  
+  DISALLOW_COPY_AND_ASSIGN(ProfileScope);
+};
+
+}  // namespace stmlib
+
+#ifdef STMLIB_PROFILE
+
+// Times the rest of the enclosing block. name must be a string literal.
+#define STMLIB_PROFILE_SCOPE(name) \
+  static const stmlib::ProfileStage JOIN(profile_stage_, __LINE__) = \
+      stmlib::RegisterProfileStage(name); \
+  stmlib::ProfileScope JOIN(profile_scope_, __LINE__)( \
+      JOIN(profile_stage_, __LINE__))
+
+// Same, with a stage id registered by the caller, for call sites shared by
+// several stages.
+#define STMLIB_PROFILE_STAGE_SCOPE(stage) \
+  stmlib::ProfileScope JOIN(profile_scope_, __LINE__)(stage)
+
+#else
+
+#define STMLIB_PROFILE_SCOPE(name)
+#define STMLIB_PROFILE_STAGE_SCOPE(stage)
+
+#endif  // STMLIB_PROFILE
+
+#endif  // STMLIB_UTILS_PROFILER_H_
@@ -35,6 +35,9 @@ namespace stmlib {
 
 class Random {
  public:
+  // Initial state of the generator of each thread.
+  static const uint32_t kDefaultSeed = 0x21;
+
   static inline uint32_t state() { return rng_state_; }
 
   static inline void Seed(uint32_t seed) {
@@ -55,11 +58,36 @@ class Random {
   }
 
  private:
-  static uint32_t rng_state_;
+  // One generator per thread, so that voices rendered on different threads
+  // neither race nor depend on each other.
+  static thread_local uint32_t rng_state_;
 
   DISALLOW_COPY_AND_ASSIGN(Random);
 };
 
+// Runs the generator of the thread from the state of an instance for the
+// duration of a scope, so that the sequence an instance draws does not depend
+// on the other instances rendered by the thread, and can be saved with it.
+class ScopedRandomState {
+ public:
+  explicit ScopedRandomState(uint32_t* state) {
+    state_ = state;
+    thread_state_ = Random::state();
+    Random::Seed(*state);
+  }
+
+  ~ScopedRandomState() {
+    *state_ = Random::state();
+    Random::Seed(thread_state_);
+  }
+
+ private:
+  uint32_t* state_;
+  uint32_t thread_state_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedRandomState);
+};
+
 }  // namespace stmlib
 
 #endif  // STMLIB_UTILS_RANDOM_H_
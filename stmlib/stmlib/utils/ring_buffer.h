@@ -25,6 +25,10 @@
 // -----------------------------------------------------------------------------
 //
 // Basic ringbuffer template
+//
+// Meant for a single core (main loop and interrupt handlers): the indices are
+// volatile but not atomic, and Write()/Read() spin until there is room or
+// data. Use SpscQueue (spsc_queue.h) to pass data between threads.
 
 #ifndef STMLIB_UTILS_RING_BUFFER_H_
 #define STMLIB_UTILS_RING_BUFFER_H_
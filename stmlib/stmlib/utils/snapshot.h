@@ -0,0 +1,308 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Snapshot of the state of a DSP object: an image of the object itself, and of
+// the memory buffer ("arena") it allocates its delay lines from.
+//
+// Layout: SnapshotHeader, one SnapshotPointer record per pointer held by the
+// object, object image, arena image. The CRC covers the records and the images.
+//
+// The object lists the pointers it holds (SnapshotPointers). In the object
+// image, a pointer into the object or into the arena is replaced by its offset
+// from the beginning of it, and Restore() rebases it, so that a snapshot can be
+// restored into another instance, in another process, or after the arena has
+// been rebuilt. The other pointers (ROM tables, wavetable banks, reverb busses,
+// vtables) are zeroed in the image, and the instance restored into keeps its
+// own. The arena only holds plain data.
+//
+// A snapshot can be restored into an instance of the same binary, set up like
+// the one it was taken from, with an arena of the same size.
+
+#ifndef STMLIB_UTILS_SNAPSHOT_H_
+#define STMLIB_UTILS_SNAPSHOT_H_
+
+#include "stmlib/stmlib.h"
+
+#include <cstring>
+
+#include "stmlib/utils/crc32.h"
+#include "stmlib/utils/stream_buffer.h"
+
+namespace stmlib {
+
+enum SnapshotPointerBase {
+  SNAPSHOT_POINTER_NULL,
+  SNAPSHOT_POINTER_OBJECT,
+  SNAPSHOT_POINTER_ARENA,
+  SNAPSHOT_POINTER_EXTERNAL
+};
+
+struct SnapshotHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t header_size;
+  uint32_t object_size;
+  uint32_t arena_size;
+  uint32_t num_pointers;
+  uint32_t crc;
+};
+
+struct SnapshotPointer {
+  uint32_t location;  // Offset of the pointer in the object.
+  uint32_t base;  // SnapshotPointerBase.
+};
+
+// Locations of the pointers held by an object, in the order the object lists
+// them.
+class SnapshotPointers {
+ public:
+  static const size_t kMaxPointers = 128;
+
+  SnapshotPointers() : size_(0) { }
+  ~SnapshotPointers() { }
+
+  template<typename T>
+  inline void Add(T* const* pointer) {
+    AddLocation(pointer);
+  }
+
+  // The vtable pointer of a polymorphic object, which the Itanium and
+  // Microsoft C++ ABIs store at the beginning of the object.
+  inline void AddVtable(const void* object) {
+    AddLocation(object);
+  }
+
+  inline size_t size() const { return size_; }
+  inline const void* location(size_t index) const { return location_[index]; }
+
+ private:
+  inline void AddLocation(const void* location) {
+    if (size_ < kMaxPointers) {
+      location_[size_] = location;
+    }
+    ++size_;
+  }
+
+  const void* location_[kMaxPointers];
+  size_t size_;
+
+  DISALLOW_COPY_AND_ASSIGN(SnapshotPointers);
+};
+
+class Snapshot {
+ public:
+  static inline size_t size(
+      size_t object_size,
+      size_t arena_size,
+      const SnapshotPointers& pointers) {
+    return sizeof(SnapshotHeader) + \
+        pointers.size() * sizeof(SnapshotPointer) + \
+        object_size + arena_size;
+  }
+
+  // Returns the number of bytes written, or 0 if the buffer is too small, or if
+  // a pointer is not in the object.
+  static size_t Save(
+      uint32_t magic,
+      uint16_t version,
+      const void* object,
+      size_t object_size,
+      const void* arena,
+      size_t arena_size,
+      const SnapshotPointers& pointers,
+      void* buffer,
+      size_t buffer_size) {
+    const size_t num_pointers = pointers.size();
+    if (num_pointers > SnapshotPointers::kMaxPointers ||
+        buffer_size < size(object_size, arena_size, pointers)) {
+      return 0;
+    }
+    const uint8_t* object_bytes = static_cast<const uint8_t*>(object);
+
+    StreamBuffer<0> stream;
+    stream.Init(buffer, buffer_size);
+    stream.Seek(sizeof(SnapshotHeader));
+    uintptr_t offsets[SnapshotPointers::kMaxPointers];
+    SnapshotPointer records[SnapshotPointers::kMaxPointers];
+    for (size_t i = 0; i < num_pointers; ++i) {
+      size_t location;
+      if (!Locate(pointers.location(i), object, object_size, &location)) {
+        return 0;
+      }
+      const void* pointer;
+      memcpy(&pointer, object_bytes + location, sizeof(pointer));
+      records[i].location = location;
+      records[i].base = Rebase(
+          pointer, object, object_size, arena, arena_size, &offsets[i]);
+      stream.Write(records[i]);
+    }
+    uint8_t* object_image = stream.mutable_bytes() + stream.position();
+    stream.Write(object, object_size);
+    stream.Write(arena, arena_size);
+    for (size_t i = 0; i < num_pointers; ++i) {
+      memcpy(
+          object_image + records[i].location,
+          &offsets[i],
+          sizeof(offsets[i]));
+    }
+
+    SnapshotHeader header;
+    header.magic = magic;
+    header.version = version;
+    header.header_size = sizeof(SnapshotHeader);
+    header.object_size = object_size;
+    header.arena_size = arena_size;
+    header.num_pointers = num_pointers;
+    header.crc = crc32(
+        0,
+        stream.bytes() + sizeof(SnapshotHeader),
+        stream.position() - sizeof(SnapshotHeader));
+    memcpy(stream.mutable_bytes(), &header, sizeof(header));
+    return stream.position();
+  }
+
+  // Returns false, and leaves the object untouched, if the snapshot is from a
+  // different version, or from an object or arena with a different layout.
+  static bool Restore(
+      uint32_t magic,
+      uint16_t version,
+      void* object,
+      size_t object_size,
+      void* arena,
+      size_t arena_size,
+      const SnapshotPointers& pointers,
+      const void* buffer,
+      size_t buffer_size) {
+    const size_t num_pointers = pointers.size();
+    if (num_pointers > SnapshotPointers::kMaxPointers ||
+        buffer_size < size(object_size, arena_size, pointers)) {
+      return false;
+    }
+    uint8_t* object_bytes = static_cast<uint8_t*>(object);
+    uint8_t* arena_bytes = static_cast<uint8_t*>(arena);
+
+    StreamBuffer<0> stream;
+    stream.Init(const_cast<void*>(buffer), buffer_size);
+    
+    SnapshotHeader header;
+    stream.Read(&header);
+    if (header.magic != magic ||
+        header.version != version ||
+        header.header_size != sizeof(SnapshotHeader) ||
+        header.object_size != object_size ||
+        header.arena_size != arena_size ||
+        header.num_pointers != num_pointers) {
+      return false;
+    }
+    const size_t payload_size = size(object_size, arena_size, pointers) - \
+        sizeof(SnapshotHeader);
+    if (crc32(0, stream.bytes() + stream.position(), payload_size) != \
+        header.crc) {
+      return false;
+    }
+
+    // The pointers must be held at the same places by both objects.
+    SnapshotPointer records[SnapshotPointers::kMaxPointers];
+    void* external[SnapshotPointers::kMaxPointers];
+    for (size_t i = 0; i < num_pointers; ++i) {
+      stream.Read(&records[i]);
+      size_t location;
+      if (!Locate(pointers.location(i), object, object_size, &location) ||
+          location != records[i].location ||
+          records[i].base > SNAPSHOT_POINTER_EXTERNAL) {
+        return false;
+      }
+      memcpy(&external[i], object_bytes + location, sizeof(external[i]));
+    }
+    
+    stream.Read(object, object_size);
+    stream.Read(arena, arena_size);
+
+    for (size_t i = 0; i < num_pointers; ++i) {
+      uint8_t* location = object_bytes + records[i].location;
+      uintptr_t offset;
+      memcpy(&offset, location, sizeof(offset));
+      void* pointer = NULL;
+      switch (records[i].base) {
+        case SNAPSHOT_POINTER_OBJECT:
+          pointer = object_bytes + offset;
+          break;
+        case SNAPSHOT_POINTER_ARENA:
+          pointer = arena_bytes + offset;
+          break;
+        case SNAPSHOT_POINTER_EXTERNAL:
+          pointer = external[i];
+          break;
+      }
+      memcpy(location, &pointer, sizeof(pointer));
+    }
+    return true;
+  }
+
+ private:
+  static inline bool Locate(
+      const void* location,
+      const void* object,
+      size_t object_size,
+      size_t* offset) {
+    uintptr_t l = reinterpret_cast<uintptr_t>(location);
+    uintptr_t o = reinterpret_cast<uintptr_t>(object);
+    if (l < o || l + sizeof(void*) > o + object_size) {
+      return false;
+    }
+    *offset = l - o;
+    return true;
+  }
+
+  // Pointers to the end of the object or of the arena are rebased too.
+  static inline SnapshotPointerBase Rebase(
+      const void* pointer,
+      const void* object,
+      size_t object_size,
+      const void* arena,
+      size_t arena_size,
+      uintptr_t* offset) {
+    uintptr_t p = reinterpret_cast<uintptr_t>(pointer);
+    uintptr_t o = reinterpret_cast<uintptr_t>(object);
+    uintptr_t a = reinterpret_cast<uintptr_t>(arena);
+    *offset = 0;
+    if (!pointer) {
+      return SNAPSHOT_POINTER_NULL;
+    } else if (p >= o && p <= o + object_size) {
+      *offset = p - o;
+      return SNAPSHOT_POINTER_OBJECT;
+    } else if (arena && p >= a && p <= a + arena_size) {
+      *offset = p - a;
+      return SNAPSHOT_POINTER_ARENA;
+    } else {
+      return SNAPSHOT_POINTER_EXTERNAL;
+    }
+  }
+
+  DISALLOW_COPY_AND_ASSIGN(Snapshot);
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_UTILS_SNAPSHOT_H_
@@ -0,0 +1,157 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Lock-free single producer, single consumer queue.
+//
+// One thread writes (for example a control thread sending note events), one
+// thread reads (the audio thread). None of the calls block: TryWrite() fails
+// when the queue is full and TryRead() fails when it is empty. The indices
+// are only written by one side each and are kept on separate cache lines,
+// along with the reader's copy of the write index and the writer's copy of
+// the read index, so that the two sides only touch each other's cache line
+// when their copy is exhausted.
+
+#ifndef STMLIB_UTILS_SPSC_QUEUE_H_
+#define STMLIB_UTILS_SPSC_QUEUE_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace stmlib {
+
+template<typename T, size_t size>
+class SpscQueue {
+ public:
+  SpscQueue() { }
+  ~SpscQueue() { }
+  
+  // Not thread-safe: call before the two threads start using the queue.
+  void Init() {
+    write_ptr_.store(0, std::memory_order_relaxed);
+    read_ptr_.store(0, std::memory_order_relaxed);
+    cached_read_ptr_ = 0;
+    cached_write_ptr_ = 0;
+  }
+  
+  inline size_t capacity() const { return size; }
+  
+  // Writer side.
+  
+  inline size_t writable() const {
+    return size - (write_ptr_.load(std::memory_order_relaxed) -
+        read_ptr_.load(std::memory_order_acquire));
+  }
+  
+  inline bool TryWrite(const T& value) {
+    size_t w = write_ptr_.load(std::memory_order_relaxed);
+    if (w - cached_read_ptr_ == size) {
+      cached_read_ptr_ = read_ptr_.load(std::memory_order_acquire);
+      if (w - cached_read_ptr_ == size) {
+        return false;
+      }
+    }
+    buffer_[w % size] = value;
+    write_ptr_.store(w + 1, std::memory_order_release);
+    return true;
+  }
+  
+  // Writes as many elements as possible, up to num_elements. Returns the
+  // number of elements written.
+  inline size_t TryWrite(const T* source, size_t num_elements) {
+    size_t w = write_ptr_.load(std::memory_order_relaxed);
+    if (w - cached_read_ptr_ + num_elements > size) {
+      cached_read_ptr_ = read_ptr_.load(std::memory_order_acquire);
+    }
+    num_elements = std::min(num_elements, size - (w - cached_read_ptr_));
+    
+    size_t start = w % size;
+    size_t written = std::min(num_elements, size - start);
+    std::copy(source, source + written, &buffer_[start]);
+    std::copy(source + written, source + num_elements, &buffer_[0]);
+    write_ptr_.store(w + num_elements, std::memory_order_release);
+    return num_elements;
+  }
+  
+  // Reader side.
+  
+  inline size_t readable() const {
+    return write_ptr_.load(std::memory_order_acquire) -
+        read_ptr_.load(std::memory_order_relaxed);
+  }
+  
+  inline bool TryRead(T* value) {
+    size_t r = read_ptr_.load(std::memory_order_relaxed);
+    if (r == cached_write_ptr_) {
+      cached_write_ptr_ = write_ptr_.load(std::memory_order_acquire);
+      if (r == cached_write_ptr_) {
+        return false;
+      }
+    }
+    *value = buffer_[r % size];
+    read_ptr_.store(r + 1, std::memory_order_release);
+    return true;
+  }
+  
+  // Reads as many elements as possible, up to num_elements. Returns the
+  // number of elements read.
+  inline size_t TryRead(T* destination, size_t num_elements) {
+    size_t r = read_ptr_.load(std::memory_order_relaxed);
+    if (cached_write_ptr_ - r < num_elements) {
+      cached_write_ptr_ = write_ptr_.load(std::memory_order_acquire);
+    }
+    num_elements = std::min(num_elements, cached_write_ptr_ - r);
+    
+    size_t start = r % size;
+    size_t read = std::min(num_elements, size - start);
+    std::copy(&buffer_[start], &buffer_[start + read], destination);
+    std::copy(&buffer_[0], &buffer_[num_elements - read], destination + read);
+    read_ptr_.store(r + num_elements, std::memory_order_release);
+    return num_elements;
+  }
+  
+ private:
+  // The indices count the elements written and read since Init(). They wrap
+  // around at 2^N, which is a multiple of size.
+  STATIC_ASSERT(
+      size != 0 && (size & (size - 1)) == 0,
+      "size must be a power of 2");
+  
+  // Written by the writer.
+  alignas(kCacheLineSize) std::atomic<size_t> write_ptr_;
+  size_t cached_read_ptr_;
+  
+  // Written by the reader.
+  alignas(kCacheLineSize) std::atomic<size_t> read_ptr_;
+  size_t cached_write_ptr_;
+  
+  alignas(kCacheLineSize) T buffer_[size];
+  
+  DISALLOW_COPY_AND_ASSIGN(SpscQueue);
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_UTILS_SPSC_QUEUE_H_
@@ -93,6 +93,74 @@ class StreamBuffer {
   DISALLOW_COPY_AND_ASSIGN(StreamBuffer);
 };
 
+// Same interface, over a buffer owned by the caller.
+template<>
+class StreamBuffer<0> {
+ public:
+  StreamBuffer() { Init(NULL, 0); }
+  
+  void Init(void* buffer, size_t size) {
+    buffer_ = static_cast<uint8_t*>(buffer);
+    size_ = size;
+    ptr_ = 0;
+  }
+  
+  inline size_t position() const {
+    return ptr_;
+  }
+
+  inline size_t size() const {
+    return size_;
+  }
+
+  inline const uint8_t* bytes() const {
+    return buffer_;
+  }
+
+  inline uint8_t* mutable_bytes() {
+    return buffer_;
+  }
+
+  void Write(const void* data, size_t size) {
+    if (ptr_ + size > size_) {
+      return;
+    }
+    memcpy(&buffer_[ptr_], data, size);
+    ptr_ += size;
+  }
+  
+  template<typename T>
+  void Write(const T& value) {
+    Write(&value, sizeof(T));
+  }
+
+  void Read(void* data, size_t size) {
+    if (ptr_ + size > size_) {
+      return;
+    }
+    memcpy(data, &buffer_[ptr_], size);
+    ptr_ += size;
+  }
+
+  template<typename T>
+  void Read(T* value) {
+    Read((void*)value, sizeof(T));
+  }
+  
+  inline void Seek(size_t position) {
+    ptr_ = position;
+  }
+  
+  inline void Rewind() { Seek(0); }
+
+ private:
+  uint8_t* buffer_;
+  size_t size_;
+  size_t ptr_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamBuffer);
+};
+
 }  // namespace stmlib
 
 #endif   // STMLIB_UTILS_STREAM_BUFFER_H_
@@ -0,0 +1,115 @@
+// Copyright 2026 Intrets.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Triple buffer holding the latest value written by one thread, for another
+// thread to read. Typically the control thread publishes a Patch and the
+// audio thread picks the most recent one at the beginning of each block.
+//
+// Neither side ever waits, and the reader never sees a partially written
+// value: the writer fills a back buffer and swaps it with the middle buffer,
+// the reader swaps the middle buffer with its front buffer when a new value
+// has been published. Values published between two reads are skipped.
+
+#ifndef STMLIB_UTILS_TRIPLE_BUFFER_H_
+#define STMLIB_UTILS_TRIPLE_BUFFER_H_
+
+#include "stmlib/stmlib.h"
+
+#include <atomic>
+
+namespace stmlib {
+
+template<typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() { }
+  ~TripleBuffer() { }
+  
+  // Not thread-safe: call before the two threads start using the buffer.
+  void Init(const T& value) {
+    for (int32_t i = 0; i < 3; ++i) {
+      slot_[i].value = value;
+    }
+    back_ = 0;
+    middle_.store(1, std::memory_order_relaxed);
+    front_ = 2;
+  }
+  
+  // Writer side.
+  
+  // Buffer to fill before calling Publish(). It still holds an older value.
+  inline T* mutable_back() { return &slot_[back_].value; }
+  
+  inline void Publish() {
+    back_ = middle_.exchange(
+        back_ | kDirty, std::memory_order_acq_rel) & kIndexMask;
+  }
+  
+  inline void Write(const T& value) {
+    *mutable_back() = value;
+    Publish();
+  }
+  
+  // Reader side.
+  
+  // Makes the latest published value the front buffer. Returns false if
+  // nothing has been published since the last call.
+  inline bool Update() {
+    if (!(middle_.load(std::memory_order_relaxed) & kDirty)) {
+      return false;
+    }
+    front_ = middle_.exchange(
+        front_, std::memory_order_acq_rel) & kIndexMask;
+    return true;
+  }
+  
+  inline const T& front() const { return slot_[front_].value; }
+  
+  inline const T& Read() {
+    Update();
+    return front();
+  }
+  
+ private:
+  // The middle index is exchanged between the two sides; a flag tells if it
+  // holds a value that the reader has not seen yet.
+  static const uint32_t kIndexMask = 3;
+  static const uint32_t kDirty = 4;
+  
+  struct alignas(kCacheLineSize) Slot {
+    T value;
+  };
+  
+  Slot slot_[3];
+  
+  alignas(kCacheLineSize) uint32_t back_;
+  alignas(kCacheLineSize) std::atomic<uint32_t> middle_;
+  alignas(kCacheLineSize) uint32_t front_;
+  
+  DISALLOW_COPY_AND_ASSIGN(TripleBuffer);
+};
+
+}  // namespace stmlib
+
+#endif  // STMLIB_UTILS_TRIPLE_BUFFER_H_